@@ -1,7 +1,10 @@
 package cache
 
 import (
+	"container/list"
+	"errors"
 	"sync"
+	"sync/atomic"
 	"time"
 )
 
@@ -9,56 +12,451 @@ import (
 type CacheEntry struct {
 	Data      interface{}
 	Timestamp time.Time
+
+	key  string
+	elem *list.Element // position in its shard's LRU list
+	size int64         // approximate bytes, including derived values
+
+	// load produced Data, if it came from GetOrLoad. It is reused to refresh
+	// the entry once it is stale.
+	load LoadFunc
+	// hits counts reads since the entry was stored
+	hits atomic.Int64
+	// derived holds values computed from Data by Derived, by name
+	derived sync.Map
+}
+
+// LoadFunc produces the value for a key that is not in the cache, usually by
+// calling an upstream API
+type LoadFunc func() (interface{}, error)
+
+// Expirer is implemented by cached values that stop being valid on their
+// own, such as the next race once it has started. An expired value is not
+// served, fresh or stale.
+type Expirer interface {
+	Expired() bool
+}
+
+// errLoadPanicked is what callers waiting on a load get if the load panics
+var errLoadPanicked = errors.New("cache: load panicked")
+
+// call is a load in progress. Callers that miss the same key while it runs
+// wait on done and share its result.
+type call struct {
+	done chan struct{}
+	val  interface{}
+	err  error
+}
+
+// Options configures a cache. Entries are fresh for Timeout. After that,
+// an entry that came from GetOrLoad is still served until StaleTimeout, and
+// the first stale read refreshes it in the background. If the refresh fails
+// the stale value keeps being served, so an upstream outage shorter than
+// StaleTimeout - Timeout is not seen by clients.
+type Options struct {
+	// Timeout is how long an entry is fresh (the soft TTL)
+	Timeout time.Duration
+	// StaleTimeout is how long an entry may be served at all (the hard TTL).
+	// A value no greater than Timeout disables stale serving.
+	StaleTimeout time.Duration
+	// RefreshInterval is how often the background refresher looks for
+	// popular entries that will go stale before its next pass and reloads
+	// them early. Zero disables the refresher.
+	RefreshInterval time.Duration
+	// PopularHits is how many reads an entry needs since it was stored to be
+	// refreshed ahead of expiry
+	PopularHits int64
+
+	// MaxEntries and MaxBytes bound the cache. Once either is exceeded the
+	// least recently used entries are evicted. Sizes are estimates, see
+	// Sizer. Zero means no limit.
+	MaxEntries int
+	MaxBytes   int64
+	// SweepInterval is how often entries past StaleTimeout are removed.
+	// Expired entries are also dropped when a read finds them. Zero
+	// disables the sweep.
+	SweepInterval time.Duration
+	// Shards is how many independently locked parts the cache is split
+	// into, 16 if zero. The limits apply to each shard in proportion, so
+	// LRU order is kept per shard rather than across the whole cache.
+	Shards int
+}
+
+// Stats counts cache reads and background refreshes
+type Stats struct {
+	Hits          uint64 // fresh value served
+	StaleHits     uint64 // stale value served while it is refreshed
+	Misses        uint64 // nothing usable cached
+	Refreshes     uint64 // background refreshes started
+	RefreshErrors uint64 // background refreshes that failed
+	Evictions     uint64 // entries removed to stay within the limits
+	Expirations   uint64 // expired entries removed
+	Entries       int    // entries currently stored
+	Bytes         int64  // approximate size of the stored entries
 }
 
 // Cache is a thread-safe cache store for API responses
 type Cache struct {
-	mu      sync.RWMutex
-	store   map[string]CacheEntry
-	timeout time.Duration
+	shards       []shard
+	shardEntries int
+	shardBytes   int64
+	timeout      time.Duration
+	stale        time.Duration
+
+	loadMu sync.Mutex
+	loads  map[string]*call
+
+	// Background refresher settings, stopped by Close
+	popularHits int64
+	stop        chan struct{}
+	stopOnce    sync.Once
+
+	hits, staleHits, misses  atomic.Uint64
+	refreshes, refreshErrors atomic.Uint64
+	evictions, expirations   atomic.Uint64
 }
 
-// NewCache creates a new cache with the specified timeout duration
+// NewCache creates a new cache with the specified timeout duration. Entries
+// are never served stale and there is no background refresh.
 func NewCache(timeout time.Duration) *Cache {
-	return &Cache{
-		store:   make(map[string]CacheEntry),
-		timeout: timeout,
+	return NewCacheWithOptions(Options{Timeout: timeout})
+}
+
+// NewCacheWithOptions creates a cache configured by opts. If opts enables the
+// background refresher or sweep, Close stops them.
+func NewCacheWithOptions(opts Options) *Cache {
+	shards := opts.Shards
+	if shards <= 0 {
+		shards = defaultShards
+	}
+	c := &Cache{
+		shards:      make([]shard, shards),
+		timeout:     opts.Timeout,
+		stale:       opts.StaleTimeout,
+		loads:       make(map[string]*call),
+		popularHits: opts.PopularHits,
+		stop:        make(chan struct{}),
+	}
+	for i := range c.shards {
+		c.shards[i].reset()
+	}
+	if opts.MaxEntries > 0 {
+		c.shardEntries = (opts.MaxEntries + shards - 1) / shards
+	}
+	if opts.MaxBytes > 0 {
+		c.shardBytes = (opts.MaxBytes + int64(shards) - 1) / int64(shards)
 	}
+	if c.stale < c.timeout {
+		c.stale = c.timeout
+	}
+	if opts.RefreshInterval > 0 {
+		go c.refreshPopular(opts.RefreshInterval)
+	}
+	if opts.SweepInterval > 0 {
+		go c.sweepExpired(opts.SweepInterval)
+	}
+	return c
 }
 
-// Get retrieves a value from the cache if it exists and is not stale
-func (c *Cache) Get(key string) (interface{}, bool) {
-	c.mu.RLock()
-	defer c.mu.RUnlock()
+// Close stops the background refresher and sweep, if there are any
+func (c *Cache) Close() {
+	c.stopOnce.Do(func() { close(c.stop) })
+}
 
-	entry, exists := c.store[key]
+// Stats returns the counts since the cache was created and its current size
+func (c *Cache) Stats() Stats {
+	stats := Stats{
+		Hits:          c.hits.Load(),
+		StaleHits:     c.staleHits.Load(),
+		Misses:        c.misses.Load(),
+		Refreshes:     c.refreshes.Load(),
+		RefreshErrors: c.refreshErrors.Load(),
+		Evictions:     c.evictions.Load(),
+		Expirations:   c.expirations.Load(),
+	}
+	for i := range c.shards {
+		s := &c.shards[i]
+		s.mu.Lock()
+		stats.Entries += len(s.entries)
+		stats.Bytes += s.bytes
+		s.mu.Unlock()
+	}
+	return stats
+}
+
+// expired reports whether entry can no longer be served at age. Stale
+// entries are only served if they can be refreshed, and no entry is served
+// once its value has expired (see Expirer).
+func (c *Cache) expired(entry *CacheEntry, age time.Duration) bool {
+	if age > c.stale || (age > c.timeout && entry.load == nil) {
+		return true
+	}
+	expirer, ok := entry.Data.(Expirer)
+	return ok && expirer.Expired()
+}
+
+// lookup returns the entry for key if it can be served, and whether it is
+// stale. A served entry becomes the most recently used in its shard, an
+// expired one is removed.
+func (c *Cache) lookup(key string) (entry *CacheEntry, stale bool) {
+	s := c.shardFor(key)
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	entry, exists := s.entries[key]
 	if !exists {
 		return nil, false
 	}
 
-	// Check if the entry is stale
-	if time.Since(entry.Timestamp) > c.timeout {
+	age := time.Since(entry.Timestamp)
+	if c.expired(entry, age) {
+		s.remove(entry)
+		c.expirations.Add(1)
+		return nil, false
+	}
+	s.lru.MoveToFront(entry.elem)
+	return entry, age > c.timeout
+}
+
+// Get retrieves a value from the cache if it exists and has not expired. A
+// stale value is returned as well, and refreshed in the background.
+func (c *Cache) Get(key string) (interface{}, bool) {
+	entry, stale := c.lookup(key)
+	if entry == nil {
+		c.misses.Add(1)
 		return nil, false
 	}
 
+	entry.hits.Add(1)
+	if stale {
+		c.staleHits.Add(1)
+		c.refresh(key, entry.load)
+	} else {
+		c.hits.Add(1)
+	}
 	return entry.Data, true
 }
 
 // Set stores a value in the cache with the current timestamp
 func (c *Cache) Set(key string, value interface{}) {
-	c.mu.Lock()
-	defer c.mu.Unlock()
+	c.set(key, value, nil)
+}
 
-	c.store[key] = CacheEntry{
+func (c *Cache) set(key string, value interface{}, load LoadFunc) {
+	entry := &CacheEntry{
 		Data:      value,
 		Timestamp: time.Now(),
+		key:       key,
+		size:      entryOverhead + int64(len(key)) + approxSize(value),
+		load:      load,
+	}
+
+	s := c.shardFor(key)
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	s.add(entry)
+	if evicted := s.evict(c.shardEntries, c.shardBytes); evicted > 0 {
+		c.evictions.Add(uint64(evicted))
 	}
 }
 
 // Clear removes all entries from the cache
 func (c *Cache) Clear() {
-	c.mu.Lock()
-	defer c.mu.Unlock()
+	for i := range c.shards {
+		s := &c.shards[i]
+		s.mu.Lock()
+		s.reset()
+		s.mu.Unlock()
+	}
+}
+
+// sweep removes every expired entry
+func (c *Cache) sweep() {
+	for i := range c.shards {
+		s := &c.shards[i]
+		s.mu.Lock()
+		now := time.Now()
+		for _, entry := range s.entries {
+			if c.expired(entry, now.Sub(entry.Timestamp)) {
+				s.remove(entry)
+				c.expirations.Add(1)
+			}
+		}
+		s.mu.Unlock()
+	}
+}
+
+// sweepExpired runs sweep every interval until the cache is closed
+func (c *Cache) sweepExpired(interval time.Duration) {
+	ticker := time.NewTicker(interval)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-c.stop:
+			return
+		case <-ticker.C:
+			c.sweep()
+		}
+	}
+}
+
+// Derived returns a value computed from the entry for key, such as its
+// encoded form, calling derive on the first request for each name. Derived
+// values belong to the entry and are dropped when it is replaced, so they
+// never outlive the value they came from. ok is false if key has no entry
+// that can be served; stats and refreshes are left to Get.
+func (c *Cache) Derived(key, name string, derive func(value interface{}) (interface{}, error)) (derived interface{}, ok bool, err error) {
+	entry, _ := c.lookup(key)
+	if entry == nil {
+		return nil, false, nil
+	}
+	if derived, exists := entry.derived.Load(name); exists {
+		return derived, true, nil
+	}
+
+	// Concurrent first requests may each derive the value; one result is kept
+	derived, err = derive(entry.Data)
+	if err != nil {
+		return nil, true, err
+	}
+	derived, loaded := entry.derived.LoadOrStore(name, derived)
+	if sizer, ok := derived.(Sizer); ok && !loaded {
+		c.grow(entry, int64(sizer.Size()))
+	}
+	return derived, true, nil
+}
+
+// grow adds n bytes to entry's size, evicting other entries if that takes
+// its shard over the limit
+func (c *Cache) grow(entry *CacheEntry, n int64) {
+	s := c.shardFor(entry.key)
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	if s.entries[entry.key] != entry {
+		// Replaced or evicted since it was looked up
+		return
+	}
+	entry.size += n
+	s.bytes += n
+	if evicted := s.evict(c.shardEntries, c.shardBytes); evicted > 0 {
+		c.evictions.Add(uint64(evicted))
+	}
+}
+
+// GetOrLoad returns the cached value for key, calling load to produce it on a
+// miss. Only one load per key runs at a time: callers that miss while it is
+// in flight wait for it and get the same value or error. A successful result
+// is cached along with load, which later refreshes it once it is stale. An
+// error is not cached, so the next miss tries again. cached reports whether
+// the value was served from the cache without waiting on a load.
+func (c *Cache) GetOrLoad(key string, load LoadFunc) (value interface{}, cached bool, err error) {
+	if value, exists := c.Get(key); exists {
+		return value, true, nil
+	}
 
-	c.store = make(map[string]CacheEntry)
+	c.loadMu.Lock()
+	// The value may have been stored while we waited for the lock
+	if entry, _ := c.lookup(key); entry != nil {
+		c.loadMu.Unlock()
+		return entry.Data, true, nil
+	}
+	if inflight, ok := c.loads[key]; ok {
+		c.loadMu.Unlock()
+		<-inflight.done
+		return inflight.val, false, inflight.err
+	}
+	current := &call{done: make(chan struct{})}
+	c.loads[key] = current
+	c.loadMu.Unlock()
+
+	c.run(key, current, load)
+	return current.val, false, current.err
+}
+
+// run performs the load for key registered as current and stores its result
+func (c *Cache) run(key string, current *call, load LoadFunc) {
+	finished := false
+	defer func() {
+		if !finished {
+			// load panicked; the panic carries on in this goroutine
+			current.err = errLoadPanicked
+		}
+		c.loadMu.Lock()
+		delete(c.loads, key)
+		c.loadMu.Unlock()
+		close(current.done)
+	}()
+
+	current.val, current.err = load()
+	finished = true
+	if current.err == nil {
+		c.set(key, current.val, load)
+	}
+}
+
+// refresh reloads key in the background unless a load for it is already in
+// flight. The current entry stays in place until the load succeeds.
+func (c *Cache) refresh(key string, load LoadFunc) {
+	c.loadMu.Lock()
+	if _, ok := c.loads[key]; ok {
+		c.loadMu.Unlock()
+		return
+	}
+	current := &call{done: make(chan struct{})}
+	c.loads[key] = current
+	c.loadMu.Unlock()
+
+	c.refreshes.Add(1)
+	go func() {
+		defer func() {
+			// Nobody is waiting on a background refresh, so a panic is
+			// counted as a failure rather than taking the server down
+			recover()
+			if current.err != nil {
+				c.refreshErrors.Add(1)
+			}
+		}()
+		c.run(key, current, load)
+	}()
+}
+
+// refreshPopular reloads popular entries that would go stale before its
+// next pass, so their readers never see a stale value
+func (c *Cache) refreshPopular(interval time.Duration) {
+	ticker := time.NewTicker(interval)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-c.stop:
+			return
+		case <-ticker.C:
+		}
+
+		type due struct {
+			key  string
+			load LoadFunc
+		}
+		var refresh []due
+		for i := range c.shards {
+			s := &c.shards[i]
+			s.mu.Lock()
+			for key, entry := range s.entries {
+				if entry.load == nil || entry.hits.Load() < c.popularHits {
+					continue
+				}
+				if time.Since(entry.Timestamp)+interval >= c.timeout {
+					refresh = append(refresh, due{key, entry.load})
+				}
+			}
+			s.mu.Unlock()
+		}
+
+		for _, d := range refresh {
+			c.refresh(d.key, d.load)
+		}
+	}
 }
@@ -1,7 +1,11 @@
 package cache
 
 import (
+	"errors"
+	"fmt"
+	"strings"
 	"sync"
+	"sync/atomic"
 	"testing"
 	"time"
 )
@@ -206,3 +210,389 @@ func TestCacheFormula1RaceData(t *testing.T) {
 		t.Errorf("Expected nil after expiration, got %v", val)
 	}
 }
+
+func TestGetOrLoadCoalescesConcurrentMisses(t *testing.T) {
+	c := NewCache(time.Minute)
+	var loads int32
+	release := make(chan struct{})
+
+	load := func() (interface{}, error) {
+		atomic.AddInt32(&loads, 1)
+		<-release
+		return "value", nil
+	}
+
+	var wg sync.WaitGroup
+	results := make([]interface{}, 1000)
+	for i := range results {
+		i := i
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			val, _, err := c.GetOrLoad("key", load)
+			if err != nil {
+				t.Errorf("Unexpected error: %v", err)
+			}
+			results[i] = val
+		}()
+	}
+
+	// Let the callers pile up behind the first load before it finishes
+	time.Sleep(50 * time.Millisecond)
+	close(release)
+	wg.Wait()
+
+	if loads != 1 {
+		t.Errorf("Expected 1 load, got %d", loads)
+	}
+	for i, val := range results {
+		if val != "value" {
+			t.Fatalf("Caller %d got %v", i, val)
+		}
+	}
+
+	if val, cached, _ := c.GetOrLoad("key", load); !cached || val != "value" {
+		t.Errorf("Expected cached value after load, got %v (cached %v)", val, cached)
+	}
+}
+
+func TestGetOrLoadDoesNotCacheErrors(t *testing.T) {
+	c := NewCache(time.Minute)
+	failure := errors.New("upstream down")
+
+	if _, _, err := c.GetOrLoad("key", func() (interface{}, error) { return nil, failure }); err != failure {
+		t.Errorf("Expected upstream error, got %v", err)
+	}
+	if _, exists := c.Get("key"); exists {
+		t.Errorf("Expected failed load not to be cached")
+	}
+
+	val, cached, err := c.GetOrLoad("key", func() (interface{}, error) { return "value", nil })
+	if err != nil || cached || val != "value" {
+		t.Errorf("Expected a fresh load after a failure, got %v, %v, %v", val, cached, err)
+	}
+}
+
+func TestGetOrLoadPanicReleasesWaiters(t *testing.T) {
+	c := NewCache(time.Minute)
+	started := make(chan struct{})
+
+	go func() {
+		defer func() { recover() }()
+		c.GetOrLoad("key", func() (interface{}, error) {
+			close(started)
+			time.Sleep(20 * time.Millisecond)
+			panic("boom")
+		})
+	}()
+
+	<-started
+	if _, _, err := c.GetOrLoad("key", func() (interface{}, error) { return "value", nil }); err == nil {
+		t.Errorf("Expected waiter to get an error when the load panics")
+	}
+}
+
+func TestGetOrLoadServesStaleWhileRefreshing(t *testing.T) {
+	c := NewCacheWithOptions(Options{Timeout: 50 * time.Millisecond, StaleTimeout: time.Second})
+	var loads int32
+	release := make(chan struct{})
+	load := func() (interface{}, error) {
+		if atomic.AddInt32(&loads, 1) > 1 {
+			<-release
+		}
+		return fmt.Sprintf("value%d", atomic.LoadInt32(&loads)), nil
+	}
+
+	if val, cached, _ := c.GetOrLoad("key", load); cached || val != "value1" {
+		t.Fatalf("Expected first load, got %v (cached %v)", val, cached)
+	}
+	time.Sleep(100 * time.Millisecond)
+
+	// Stale reads return at once and start a single refresh between them
+	for i := 0; i < 10; i++ {
+		if val, cached, err := c.GetOrLoad("key", load); err != nil || !cached || val != "value1" {
+			t.Fatalf("Expected stale value1, got %v (cached %v, err %v)", val, cached, err)
+		}
+	}
+	close(release)
+	time.Sleep(20 * time.Millisecond)
+
+	if atomic.LoadInt32(&loads) != 2 {
+		t.Errorf("Expected 1 background refresh, got %d loads", atomic.LoadInt32(&loads)-1)
+	}
+	if val, exists := c.Get("key"); !exists || val != "value2" {
+		t.Errorf("Expected refreshed value2, got %v", val)
+	}
+
+	stats := c.Stats()
+	if stats.Misses != 1 || stats.StaleHits != 10 || stats.Hits != 1 || stats.Refreshes != 1 {
+		t.Errorf("Expected 1 miss, 10 stale hits, 1 hit and 1 refresh, got %+v", stats)
+	}
+}
+
+func TestStaleValueSurvivesFailedRefresh(t *testing.T) {
+	c := NewCacheWithOptions(Options{Timeout: 20 * time.Millisecond, StaleTimeout: 200 * time.Millisecond})
+	c.GetOrLoad("key", func() (interface{}, error) { return "value", nil })
+	time.Sleep(40 * time.Millisecond)
+
+	failing := func() (interface{}, error) { return nil, errors.New("upstream down") }
+	c.refresh("key", failing)
+	time.Sleep(20 * time.Millisecond)
+	if val, cached, err := c.GetOrLoad("key", failing); err != nil || !cached || val != "value" {
+		t.Errorf("Expected stale value while upstream is down, got %v, %v, %v", val, cached, err)
+	}
+	time.Sleep(20 * time.Millisecond)
+	if stats := c.Stats(); stats.RefreshErrors == 0 {
+		t.Errorf("Expected failed refreshes to be counted, got %+v", stats)
+	}
+
+	// Past the hard TTL the entry is gone and the error reaches the caller
+	time.Sleep(200 * time.Millisecond)
+	if _, _, err := c.GetOrLoad("key", failing); err == nil {
+		t.Errorf("Expected an error once the stale value expired")
+	}
+}
+
+func TestSetValuesAreNotServedStale(t *testing.T) {
+	c := NewCacheWithOptions(Options{Timeout: 20 * time.Millisecond, StaleTimeout: time.Second})
+	c.Set("key", "value")
+	time.Sleep(40 * time.Millisecond)
+	if _, exists := c.Get("key"); exists {
+		t.Errorf("Expected a Set value to expire at the timeout, it has no load to refresh it")
+	}
+}
+
+func TestPopularKeysRefreshAhead(t *testing.T) {
+	c := NewCacheWithOptions(Options{
+		Timeout:         100 * time.Millisecond,
+		StaleTimeout:    time.Second,
+		RefreshInterval: 20 * time.Millisecond,
+		PopularHits:     3,
+	})
+	defer c.Close()
+
+	var popular, quiet int32
+	c.GetOrLoad("popular", func() (interface{}, error) { return atomic.AddInt32(&popular, 1), nil })
+	c.GetOrLoad("quiet", func() (interface{}, error) { return atomic.AddInt32(&quiet, 1), nil })
+	for i := 0; i < 3; i++ {
+		c.Get("popular")
+	}
+
+	time.Sleep(150 * time.Millisecond)
+	if atomic.LoadInt32(&popular) < 2 {
+		t.Errorf("Expected popular key to be refreshed before it expired")
+	}
+	if atomic.LoadInt32(&quiet) != 1 {
+		t.Errorf("Expected quiet key to be left to expire, got %d loads", atomic.LoadInt32(&quiet))
+	}
+	if _, stale := c.lookup("popular"); stale {
+		t.Errorf("Expected popular key to still be fresh")
+	}
+}
+
+func TestLRUEvictsLeastRecentlyUsed(t *testing.T) {
+	c := NewCacheWithOptions(Options{Timeout: time.Minute, MaxEntries: 3, Shards: 1})
+	c.Set("a", "1")
+	c.Set("b", "2")
+	c.Set("c", "3")
+	c.Get("a") // b is now the least recently used
+	c.Set("d", "4")
+
+	if _, exists := c.Get("b"); exists {
+		t.Errorf("Expected least recently used key to be evicted")
+	}
+	for _, key := range []string{"a", "c", "d"} {
+		if _, exists := c.Get(key); !exists {
+			t.Errorf("Expected %s to be kept", key)
+		}
+	}
+	if stats := c.Stats(); stats.Entries != 3 || stats.Evictions != 1 {
+		t.Errorf("Expected 3 entries and 1 eviction, got %+v", stats)
+	}
+}
+
+func TestMaxBytesEvicts(t *testing.T) {
+	value := strings.Repeat("x", 1000)
+	limit := int64(3 * (entryOverhead + 1 + len(value)))
+	c := NewCacheWithOptions(Options{Timeout: time.Minute, MaxBytes: limit, Shards: 1})
+	for _, key := range []string{"a", "b", "c", "d", "e"} {
+		c.Set(key, value)
+	}
+
+	stats := c.Stats()
+	if stats.Entries != 3 || stats.Bytes > limit {
+		t.Errorf("Expected 3 entries within %d bytes, got %+v", limit, stats)
+	}
+	if _, exists := c.Get("a"); exists {
+		t.Errorf("Expected oldest entry to be evicted")
+	}
+
+	// Replacing a key does not count it twice
+	c.Set("e", value)
+	if stats := c.Stats(); stats.Entries != 3 || stats.Bytes != limit {
+		t.Errorf("Expected replaced entry to keep the size at %d bytes, got %+v", limit, stats)
+	}
+}
+
+func TestSweepRemovesExpiredEntries(t *testing.T) {
+	c := NewCacheWithOptions(Options{Timeout: 20 * time.Millisecond, StaleTimeout: 60 * time.Millisecond})
+	c.Set("plain", "value")
+	c.GetOrLoad("loaded", func() (interface{}, error) { return "value", nil })
+	time.Sleep(40 * time.Millisecond)
+
+	// Past the timeout only the entry that can be refreshed is kept
+	c.sweep()
+	if stats := c.Stats(); stats.Entries != 1 || stats.Expirations != 1 {
+		t.Errorf("Expected the Set entry to be swept, got %+v", stats)
+	}
+
+	time.Sleep(40 * time.Millisecond)
+	c.sweep()
+	if stats := c.Stats(); stats.Entries != 0 || stats.Bytes != 0 {
+		t.Errorf("Expected an empty cache past the stale timeout, got %+v", stats)
+	}
+}
+
+// stampede has devices goroutines request the same missing key at the same
+// moment from an upstream that takes latency to answer, and returns how many
+// upstream calls were made.
+func stampede(devices int, latency time.Duration, get func(c *Cache, load LoadFunc)) int32 {
+	c := NewCache(time.Minute)
+	var calls int32
+	load := func() (interface{}, error) {
+		atomic.AddInt32(&calls, 1)
+		time.Sleep(latency)
+		return "value", nil
+	}
+
+	start := make(chan struct{})
+	var wg sync.WaitGroup
+	wg.Add(devices)
+	for i := 0; i < devices; i++ {
+		go func() {
+			defer wg.Done()
+			<-start
+			get(c, load)
+		}()
+	}
+	close(start)
+	wg.Wait()
+	return calls
+}
+
+func benchmarkStampede(b *testing.B, get func(c *Cache, load LoadFunc)) {
+	for _, devices := range []int{100, 1000, 5000} {
+		devices := devices
+		b.Run(fmt.Sprintf("devices=%d", devices), func(b *testing.B) {
+			var calls int64
+			for i := 0; i < b.N; i++ {
+				calls += int64(stampede(devices, 5*time.Millisecond, get))
+			}
+			b.ReportMetric(float64(calls)/float64(b.N), "upstream/op")
+		})
+	}
+}
+
+// BenchmarkStampedeGetSet is the old handler pattern: check the cache, call
+// upstream on a miss, then store the result.
+func BenchmarkStampedeGetSet(b *testing.B) {
+	benchmarkStampede(b, func(c *Cache, load LoadFunc) {
+		if _, exists := c.Get("key"); exists {
+			return
+		}
+		if val, err := load(); err == nil {
+			c.Set("key", val)
+		}
+	})
+}
+
+func BenchmarkStampedeGetOrLoad(b *testing.B) {
+	benchmarkStampede(b, func(c *Cache, load LoadFunc) {
+		c.GetOrLoad("key", load)
+	})
+}
+
+// parallelKeys is the key space of the parallel benchmarks, roughly the
+// distinct weather, quote, news and race keys of a large fleet
+var parallelKeys = func() []string {
+	keys := make([]string, 1024)
+	for i := range keys {
+		keys[i] = fmt.Sprintf("weather:location-%d", i)
+	}
+	return keys
+}()
+
+// benchmarkParallel runs reads from all CPUs against a full cache, with one
+// write for every writeEvery reads.
+func benchmarkParallel(b *testing.B, c *Cache, writeEvery int) {
+	for _, key := range parallelKeys {
+		c.Set(key, key)
+	}
+	var seed atomic.Uint32
+	b.ReportAllocs()
+	b.ResetTimer()
+	b.RunParallel(func(pb *testing.PB) {
+		n := int(seed.Add(7919))
+		for pb.Next() {
+			n++
+			key := parallelKeys[n%len(parallelKeys)]
+			if writeEvery > 0 && n%writeEvery == 0 {
+				c.Set(key, key)
+			} else {
+				c.Get(key)
+			}
+		}
+	})
+}
+
+func BenchmarkParallelGet(b *testing.B) {
+	for _, shards := range []int{1, defaultShards} {
+		b.Run(fmt.Sprintf("shards=%d", shards), func(b *testing.B) {
+			benchmarkParallel(b, NewCacheWithOptions(Options{Timeout: time.Minute, Shards: shards}), 0)
+		})
+	}
+}
+
+func BenchmarkParallelGetSet(b *testing.B) {
+	for _, shards := range []int{1, defaultShards} {
+		b.Run(fmt.Sprintf("shards=%d", shards), func(b *testing.B) {
+			benchmarkParallel(b, NewCacheWithOptions(Options{Timeout: time.Minute, Shards: shards}), 10)
+		})
+	}
+}
+
+// BenchmarkParallelEviction keeps the cache at its limit so every write
+// evicts
+func BenchmarkParallelEviction(b *testing.B) {
+	c := NewCacheWithOptions(Options{Timeout: time.Minute, MaxEntries: len(parallelKeys) / 2})
+	benchmarkParallel(b, c, 2)
+}
+
+// expiring is a value that stops being valid once expired is set
+type expiring struct {
+	expired atomic.Bool
+}
+
+func (e *expiring) Expired() bool {
+	return e.expired.Load()
+}
+
+func TestExpiredValuesAreNotServed(t *testing.T) {
+	c := NewCacheWithOptions(Options{Timeout: time.Minute, StaleTimeout: time.Hour})
+	value := &expiring{}
+	c.GetOrLoad("key", func() (interface{}, error) { return value, nil })
+	if _, exists := c.Get("key"); !exists {
+		t.Fatalf("Expected the value to be served until it expires")
+	}
+
+	// Fresh or not, an expired value is a miss and is loaded again
+	value.expired.Store(true)
+	loads := 0
+	val, cached, _ := c.GetOrLoad("key", func() (interface{}, error) {
+		loads++
+		return "next", nil
+	})
+	if cached || loads != 1 || val != "next" {
+		t.Errorf("Expected the expired value to be loaded again, got %v, cached %v, %d loads", val, cached, loads)
+	}
+}
@@ -0,0 +1,101 @@
+package cache
+
+import (
+	"container/list"
+	"encoding/json"
+	"sync"
+)
+
+const (
+	// defaultShards is how many independently locked parts a cache is split
+	// into unless Options says otherwise
+	defaultShards = 16
+	// entryOverhead approximates what an entry costs besides its key and
+	// value: the CacheEntry itself, its map slot and its LRU list element
+	entryOverhead = 160
+)
+
+// Sizer is implemented by cached or derived values that know roughly how
+// many bytes they hold
+type Sizer interface {
+	Size() int
+}
+
+// approxSize estimates the memory held by a cached value. Values are API
+// responses, so anything that is not a Sizer, string or []byte is measured
+// by its JSON encoding. That costs one encode per Set, which happens once
+// per upstream call.
+func approxSize(value interface{}) int64 {
+	switch v := value.(type) {
+	case nil:
+		return 0
+	case Sizer:
+		return int64(v.Size())
+	case string:
+		return int64(len(v))
+	case []byte:
+		return int64(len(v))
+	}
+
+	data, err := json.Marshal(value)
+	if err != nil {
+		return 0
+	}
+	return int64(len(data))
+}
+
+// shard is one independently locked part of the cache. The front of lru is
+// the most recently used entry.
+type shard struct {
+	mu      sync.Mutex
+	entries map[string]*CacheEntry
+	lru     list.List
+	bytes   int64
+}
+
+func (s *shard) reset() {
+	s.entries = make(map[string]*CacheEntry)
+	s.lru.Init()
+	s.bytes = 0
+}
+
+// shardFor returns the shard that holds key, picked by an FNV-1a hash
+func (c *Cache) shardFor(key string) *shard {
+	h := uint32(2166136261)
+	for i := 0; i < len(key); i++ {
+		h ^= uint32(key[i])
+		h *= 16777619
+	}
+	return &c.shards[h%uint32(len(c.shards))]
+}
+
+// add stores entry, replacing any entry with the same key. The caller holds
+// s.mu.
+func (s *shard) add(entry *CacheEntry) {
+	if old, exists := s.entries[entry.key]; exists {
+		s.remove(old)
+	}
+	entry.elem = s.lru.PushFront(entry)
+	s.entries[entry.key] = entry
+	s.bytes += entry.size
+}
+
+// remove drops entry from the shard. The caller holds s.mu.
+func (s *shard) remove(entry *CacheEntry) {
+	delete(s.entries, entry.key)
+	s.lru.Remove(entry.elem)
+	s.bytes -= entry.size
+}
+
+// evict removes least recently used entries until the shard is within its
+// limits, and returns how many it removed. The most recently used entry is
+// always kept, even if it alone is over the byte limit. The caller holds
+// s.mu.
+func (s *shard) evict(maxEntries int, maxBytes int64) int {
+	evicted := 0
+	for s.lru.Len() > 1 && ((maxEntries > 0 && s.lru.Len() > maxEntries) || (maxBytes > 0 && s.bytes > maxBytes)) {
+		s.remove(s.lru.Back().Value.(*CacheEntry))
+		evicted++
+	}
+	return evicted
+}
@@ -0,0 +1,150 @@
+package calendar
+
+import (
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"sync"
+	"time"
+
+	"daysync/api/models"
+)
+
+// Race is a calendar race with its session times parsed. A time is zero if
+// the session is missing from the file or is not valid RFC3339.
+type Race struct {
+	models.Race
+	Q1     time.Time
+	Q2     time.Time
+	Sprint time.Time
+	Start  time.Time
+}
+
+// Index is a parsed season calendar. Races are kept in file order, with a
+// second view sorted by start time for next race lookups. An Index is never
+// modified after it is built, so it can be shared between requests.
+type Index struct {
+	Year  int
+	Races []Race
+
+	// byStart holds the races with a valid start time, earliest first
+	byStart []*Race
+}
+
+// ParseError reports a calendar file that could be read but not parsed
+type ParseError struct {
+	File string
+	Err  error
+}
+
+func (e *ParseError) Error() string {
+	return fmt.Sprintf("parsing %s: %v", e.File, e.Err)
+}
+
+func (e *ParseError) Unwrap() error {
+	return e.Err
+}
+
+// parseTime parses an RFC3339 session time, zero if it is not valid
+func parseTime(value string) time.Time {
+	t, err := time.Parse(time.RFC3339, value)
+	if err != nil {
+		return time.Time{}
+	}
+	return t
+}
+
+// NewIndex parses the session times of every race in calendar and sorts the
+// races by start time
+func NewIndex(calendar models.Calendar) *Index {
+	index := &Index{Year: calendar.Year, Races: make([]Race, len(calendar.Races))}
+	for i, race := range calendar.Races {
+		index.Races[i] = Race{
+			Race:   race,
+			Q1:     parseTime(race.Sessions.Q1),
+			Q2:     parseTime(race.Sessions.Q2),
+			Sprint: parseTime(race.Sessions.Sprint),
+			Start:  parseTime(race.Sessions.Race),
+		}
+		if !index.Races[i].Start.IsZero() {
+			index.byStart = append(index.byStart, &index.Races[i])
+		}
+	}
+
+	sort.SliceStable(index.byStart, func(i, j int) bool {
+		return index.byStart[i].Start.Before(index.byStart[j].Start)
+	})
+	return index
+}
+
+// Next returns the first race that starts after now, or nil if the season is
+// over
+func (ix *Index) Next(now time.Time) *Race {
+	i := sort.Search(len(ix.byStart), func(i int) bool {
+		return ix.byStart[i].Start.After(now)
+	})
+	if i == len(ix.byStart) {
+		return nil
+	}
+	return ix.byStart[i]
+}
+
+// storeEntry is a loaded calendar file and the file state it was loaded from
+type storeEntry struct {
+	index   *Index
+	modTime time.Time
+	size    int64
+}
+
+// Store loads calendar files from a directory on first use and keeps them in
+// memory. A file is reloaded when its modification time or size changes, so
+// updated calendars are picked up without a restart.
+type Store struct {
+	dir string
+
+	mu    sync.RWMutex
+	files map[string]storeEntry
+}
+
+// NewStore creates a store for the calendar files in dir
+func NewStore(dir string) *Store {
+	return &Store{
+		dir:   dir,
+		files: make(map[string]storeEntry),
+	}
+}
+
+// Get returns the index for file, loading it if it has not been loaded yet
+// or has changed since. Read errors are returned as is, parse errors as a
+// *ParseError.
+func (s *Store) Get(file string) (*Index, error) {
+	path := filepath.Join(s.dir, file)
+	info, err := os.Stat(path)
+	if err != nil {
+		return nil, err
+	}
+
+	s.mu.RLock()
+	entry, exists := s.files[file]
+	s.mu.RUnlock()
+	if exists && entry.modTime.Equal(info.ModTime()) && entry.size == info.Size() {
+		return entry.index, nil
+	}
+
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, err
+	}
+	var calendar models.Calendar
+	if err := json.Unmarshal(data, &calendar); err != nil {
+		return nil, &ParseError{File: file, Err: err}
+	}
+
+	entry = storeEntry{index: NewIndex(calendar), modTime: info.ModTime(), size: info.Size()}
+	s.mu.Lock()
+	s.files[file] = entry
+	s.mu.Unlock()
+	return entry.index, nil
+}
@@ -0,0 +1,89 @@
+package calendar
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"daysync/api/models"
+)
+
+func race(round int, start string) models.Race {
+	return models.Race{Round: round, Sessions: models.Sessions{Race: start}}
+}
+
+func TestIndexNextUsesStartOrder(t *testing.T) {
+	index := NewIndex(models.Calendar{Year: 2025, Races: []models.Race{
+		race(1, "2025-03-02T15:00:00+07:00"),
+		race(3, "2025-04-13T14:00:00-05:00"),
+		race(2, "2025-03-16T15:00:00-03:00"),
+		race(4, "TBC"),
+	}})
+
+	if len(index.Races) != 4 || index.Races[1].Round != 3 {
+		t.Errorf("Expected races to stay in file order, got %v", index.Races)
+	}
+
+	tests := []struct {
+		now   string
+		round int
+	}{
+		{"2025-01-01T00:00:00Z", 1},
+		{"2025-03-02T08:00:00Z", 2}, // race 1 starts at exactly this time
+		{"2025-03-20T00:00:00Z", 3},
+		{"2025-05-01T00:00:00Z", 0},
+	}
+	for _, test := range tests {
+		now, _ := time.Parse(time.RFC3339, test.now)
+		next := index.Next(now)
+		if test.round == 0 {
+			if next != nil {
+				t.Errorf("At %s expected no next race, got round %d", test.now, next.Round)
+			}
+			continue
+		}
+		if next == nil || next.Round != test.round {
+			t.Errorf("At %s expected round %d, got %v", test.now, test.round, next)
+		}
+	}
+}
+
+func TestStoreReloadsChangedFile(t *testing.T) {
+	dir := t.TempDir()
+	path := filepath.Join(dir, "test.json")
+	if err := os.WriteFile(path, []byte(`{"year": 2025, "races": []}`), 0644); err != nil {
+		t.Fatal(err)
+	}
+
+	store := NewStore(dir)
+	first, err := store.Get("test.json")
+	if err != nil || first.Year != 2025 {
+		t.Fatalf("Expected 2025 calendar, got %v, %v", first, err)
+	}
+	if again, _ := store.Get("test.json"); again != first {
+		t.Errorf("Expected unchanged file to be served from memory")
+	}
+
+	data := []byte(`{"year": 2026, "races": [{"round": 1, "sessions": {"race": "2026-03-01T15:00:00Z"}}]}`)
+	if err := os.WriteFile(path, data, 0644); err != nil {
+		t.Fatal(err)
+	}
+	updated, err := store.Get("test.json")
+	if err != nil || updated.Year != 2026 || len(updated.Races) != 1 {
+		t.Errorf("Expected reloaded 2026 calendar, got %v, %v", updated, err)
+	}
+
+	if err := os.WriteFile(path, []byte(`{"year":`), 0644); err != nil {
+		t.Fatal(err)
+	}
+	if _, err := store.Get("test.json"); err == nil {
+		t.Errorf("Expected parse error for invalid file")
+	} else if _, ok := err.(*ParseError); !ok {
+		t.Errorf("Expected *ParseError, got %T", err)
+	}
+
+	if _, err := store.Get("missing.json"); err == nil {
+		t.Errorf("Expected error for missing file")
+	}
+}
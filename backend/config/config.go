@@ -12,6 +12,11 @@ type Config struct {
 	APINinjasKey  string `yaml:"api_ninjas_key"`
 	GNewsAPIKey   string `yaml:"gnews_api_key"`
 	CacheTimeout  int    `yaml:"cache_timeout_minutes"` // Cache timeout in minutes
+	CacheStale    int    `yaml:"cache_stale_minutes"`   // How long past the timeout stale data may be served
+	CacheRefresh  int    `yaml:"cache_refresh_hits"`    // Hits after which an entry is refreshed before it expires
+	CacheEntries  int    `yaml:"cache_max_entries"`     // Most entries the cache holds
+	CacheMB       int    `yaml:"cache_max_mb"`          // Approximate memory limit of the cache in megabytes
+	LogLevel      string `yaml:"log_level"`             // "info", or "debug" to log every request
 }
 
 var cfg Config
@@ -55,3 +60,42 @@ func GetCacheTimeout() time.Duration {
 	}
 	return time.Duration(cfg.CacheTimeout) * time.Minute
 }
+
+// GetCacheStaleTimeout returns how long after the cache timeout an entry may
+// still be served while it is refreshed
+func GetCacheStaleTimeout() time.Duration {
+	if cfg.CacheStale == 0 {
+		return 2 * time.Hour // Default to 2 hours if not configured
+	}
+	return time.Duration(cfg.CacheStale) * time.Minute
+}
+
+// GetCacheRefreshHits returns how many hits make an entry popular enough to
+// be refreshed before it expires
+func GetCacheRefreshHits() int {
+	if cfg.CacheRefresh == 0 {
+		return 5
+	}
+	return cfg.CacheRefresh
+}
+
+// GetCacheMaxEntries returns how many entries the cache may hold
+func GetCacheMaxEntries() int {
+	if cfg.CacheEntries == 0 {
+		return 10000
+	}
+	return cfg.CacheEntries
+}
+
+// GetCacheMaxBytes returns the approximate memory limit of the cache
+func GetCacheMaxBytes() int64 {
+	if cfg.CacheMB == 0 {
+		return 64 << 20 // Default to 64 MB if not configured
+	}
+	return int64(cfg.CacheMB) << 20
+}
+
+// DebugLogging reports whether every request should be logged
+func DebugLogging() bool {
+	return cfg.LogLevel == "debug"
+}
@@ -0,0 +1,211 @@
+package handlers
+
+import (
+	"encoding/json"
+	"net/http/httptest"
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"daysync/api/calendar"
+	"daysync/api/models"
+)
+
+// useTestCalendars points the calendar handlers at the repo's data directory
+// and pins the clock to before the 2025 seasons end
+func useTestCalendars(tb testing.TB) {
+	oldCalendars, oldNow := calendars, timeNow
+	calendars = calendar.NewStore(filepath.Join("..", "data"))
+	timeNow = func() time.Time {
+		return time.Date(2025, time.June, 1, 0, 0, 0, 0, time.UTC)
+	}
+	tb.Cleanup(func() {
+		calendars, timeNow = oldCalendars, oldNow
+	})
+	apiCache.Clear()
+}
+
+func TestNextRaceIsNotServedOnceStarted(t *testing.T) {
+	useTestCalendars(t)
+	first, _, err := getNextRace("motogp", "UTC")
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	// Still within the cache timeout, but the race has started
+	start := first.(*upcomingRace).start
+	timeNow = func() time.Time { return start.Add(time.Minute) }
+	next, _, err := getNextRace("motogp", "UTC")
+	if err != nil {
+		t.Fatal(err)
+	}
+	if next.(*upcomingRace).Name == first.(*upcomingRace).Name {
+		t.Errorf("Expected the race after %s once it started", first.(*upcomingRace).Name)
+	}
+}
+
+func TestGetNextMotoGPRace(t *testing.T) {
+	useTestCalendars(t)
+
+	rec := httptest.NewRecorder()
+	GetNextMotoGPRace(rec, httptest.NewRequest("GET", "/api/motogpnextrace?timezone=ACDT", nil))
+	if rec.Code != 200 {
+		t.Fatalf("Expected 200, got %d: %s", rec.Code, rec.Body.String())
+	}
+
+	var race models.Race
+	if err := json.Unmarshal(rec.Body.Bytes(), &race); err != nil {
+		t.Fatalf("Unexpected response %q: %v", rec.Body.String(), err)
+	}
+	if race.Round != 8 || race.Sessions.Race != "8th June 2025 at 21:30" {
+		t.Errorf("Expected round 8 on 8th June at 21:30 ACDT, got round %d on %s", race.Round, race.Sessions.Race)
+	}
+
+	rec = httptest.NewRecorder()
+	GetNextMotoGPRace(rec, httptest.NewRequest("GET", "/api/motogpnextrace?timezone=XYZ", nil))
+	if rec.Code != 400 {
+		t.Errorf("Expected 400 for unknown timezone, got %d", rec.Code)
+	}
+}
+
+func TestGetFormula1SeasonConvertsTimes(t *testing.T) {
+	useTestCalendars(t)
+
+	rec := httptest.NewRecorder()
+	GetFormula1Season(rec, httptest.NewRequest("GET", "/api/formula1?timezone=UTC", nil))
+	if rec.Code != 200 {
+		t.Fatalf("Expected 200, got %d: %s", rec.Code, rec.Body.String())
+	}
+
+	var season models.Calendar
+	if err := json.Unmarshal(rec.Body.Bytes(), &season); err != nil {
+		t.Fatalf("Unexpected response %q: %v", rec.Body.String(), err)
+	}
+	if len(season.Races) == 0 {
+		t.Fatalf("Expected races in season")
+	}
+	for _, race := range season.Races {
+		if _, err := time.Parse(time.RFC3339, race.Sessions.Race); err != nil {
+			continue
+		}
+		if race.Sessions.Race[len(race.Sessions.Race)-1] != 'Z' {
+			t.Errorf("Expected %s race time in UTC, got %s", race.Name, race.Sessions.Race)
+		}
+	}
+}
+
+func TestGetMotoGPSeasonStarts(t *testing.T) {
+	useTestCalendars(t)
+
+	// The query the firmware stores the calendar from
+	url := "/api/motogp?fields=races.name,races.date,races.starts"
+	rec := httptest.NewRecorder()
+	GetMotoGPSeason(rec, httptest.NewRequest("GET", url, nil))
+	if rec.Code != 200 {
+		t.Fatalf("Expected 200, got %d: %s", rec.Code, rec.Body.String())
+	}
+
+	var season models.Calendar
+	if err := json.Unmarshal(rec.Body.Bytes(), &season); err != nil {
+		t.Fatalf("Unexpected response %q: %v", rec.Body.String(), err)
+	}
+	var found bool
+	for _, race := range season.Races {
+		if race.Round != 0 || race.Circuit != "" {
+			t.Fatalf("Expected only the requested fields, got %+v", race)
+		}
+		if race.Name == "Gran Premio de Aragón" {
+			found = race.Starts != nil && race.Starts.Race == time.Date(2025, time.June, 8, 12, 0, 0, 0, time.UTC).Unix()
+		}
+	}
+	if !found {
+		t.Errorf("Expected the Aragon race start in %s", rec.Body.String())
+	}
+
+	// Unchanged calendars are not sent again
+	req := httptest.NewRequest("GET", url, nil)
+	req.Header.Set("If-None-Match", rec.Header().Get("ETag"))
+	rec = httptest.NewRecorder()
+	GetMotoGPSeason(rec, req)
+	if rec.Code != 304 {
+		t.Errorf("Expected 304 for a matching ETag, got %d", rec.Code)
+	}
+}
+
+// loadNextRaceFromFile is how next race lookups worked before calendars were
+// indexed: read and unmarshal the file, then parse race times until one is in
+// the future. Kept as the baseline for BenchmarkNextRace.
+func loadNextRaceFromFile(file string, now time.Time) (*models.Race, error) {
+	data, err := os.ReadFile(filepath.Join("..", "data", file))
+	if err != nil {
+		return nil, err
+	}
+	var season models.Calendar
+	if err := json.Unmarshal(data, &season); err != nil {
+		return nil, err
+	}
+
+	var nextRace *models.Race
+	for i := range season.Races {
+		raceTime, err := time.Parse(time.RFC3339, season.Races[i].Sessions.Race)
+		if err == nil && raceTime.After(now) {
+			nextRace = &season.Races[i]
+			break
+		}
+	}
+	if nextRace == nil {
+		return nil, errNoData
+	}
+
+	// The old lookup loaded the location from the zoneinfo database every time
+	loc, err := time.LoadLocation("Australia/Adelaide")
+	if err != nil {
+		return nil, err
+	}
+	for _, session := range []*string{&nextRace.Sessions.Q1, &nextRace.Sessions.Q2, &nextRace.Sessions.Sprint, &nextRace.Sessions.Race} {
+		if t, err := time.Parse(time.RFC3339, *session); err == nil {
+			*session = formatTime(t, *session, loc)
+		}
+	}
+	return nextRace, nil
+}
+
+// BenchmarkNextRace measures a next race cache miss. FromFile is the old read
+// and scan per miss, Indexed the in-memory index, Handler the full handler
+// with the response cache cleared before every request.
+func BenchmarkNextRace(b *testing.B) {
+	useTestCalendars(b)
+	now := timeNow()
+
+	b.Run("FromFile", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			if _, err := loadNextRaceFromFile("motogp-2025.json", now); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+
+	b.Run("Indexed", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			if _, err := loadNextRace("motogp-2025.json", "ACDT"); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+
+	b.Run("Handler", func(b *testing.B) {
+		req := httptest.NewRequest("GET", "/api/motogpnextrace?timezone=ACDT", nil)
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			apiCache.Clear()
+			rec := httptest.NewRecorder()
+			GetNextMotoGPRace(rec, req)
+			if rec.Code != 200 {
+				b.Fatalf("Expected 200, got %d", rec.Code)
+			}
+		}
+	})
+}
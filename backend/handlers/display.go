@@ -0,0 +1,334 @@
+package handlers
+
+import (
+	"encoding/json"
+	"fmt"
+	"log"
+	"math"
+	"net/http"
+	"strconv"
+	"strings"
+
+	"daysync/api/models"
+)
+
+// Display models are what the device shows on each screen: strings already
+// formatted for their labels and the colours to draw them in. They are built
+// from the same cached values as the data endpoints and kept with the cache
+// entry, so each one is formatted once per load rather than on every device.
+
+// Colours used by the device screens, as RGB hex for lv_color_hex()
+const (
+	colorBlack = "000000"
+	colorGreen = "00AA00"
+	colorRed   = "E31837"
+)
+
+// maxHeadlineChars is the longest headline the news screen fits on two lines
+const maxHeadlineChars = 80
+
+// displayFunc builds the display model for a cached value
+type displayFunc func(value interface{}) (interface{}, error)
+
+// decodeInto copies the JSON fields of value into out. Cached values come in
+// several shapes (upstream structs, test data maps), this reads them all.
+func decodeInto(value interface{}, out interface{}) error {
+	data, err := json.Marshal(value)
+	if err != nil {
+		return err
+	}
+	return json.Unmarshal(data, out)
+}
+
+func buildWeatherDisplay(value interface{}) (interface{}, error) {
+	var weather struct {
+		Temperature float64 `json:"temperature"`
+		Humidity    float64 `json:"humidity"`
+		WindSpeed   float64 `json:"wind_speed"`
+		FeelsLike   float64 `json:"feels_like"`
+		LocalTime   string  `json:"local_time"`
+		Code        *int    `json:"condition_code"`
+		IsDay       bool    `json:"is_day"`
+	}
+	if err := decodeInto(value, &weather); err != nil {
+		return nil, err
+	}
+
+	display := models.WeatherDisplay{
+		Temperature: fmt.Sprintf("%.1f°C", weather.Temperature),
+		Humidity:    fmt.Sprintf("%d%%", int(weather.Humidity)),
+		Details:     fmt.Sprintf("Wind: %.1fkm/h | Feels: %.1f°C", weather.WindSpeed, weather.FeelsLike),
+		Code:        -1,
+		Day:         weather.IsDay,
+	}
+	if weather.Code != nil {
+		display.Code = *weather.Code
+	}
+	// local_time is "YYYY-MM-DD HH:MM"
+	if date, clock, ok := strings.Cut(weather.LocalTime, " "); ok {
+		display.Date = date
+		display.Updated = "Last Update: " + clock
+	}
+	return display, nil
+}
+
+func buildRaceDisplay(value interface{}) (interface{}, error) {
+	var race struct {
+		Name     string `json:"name"`
+		Location string `json:"location"`
+		Country  string `json:"country"`
+		Circuit  string `json:"circuit"`
+		Date     string `json:"date"`
+		Sessions struct {
+			Q1     string `json:"q1"`
+			Q2     string `json:"q2"`
+			Sprint string `json:"sprint"`
+			Race   string `json:"race"`
+		} `json:"sessions"`
+		Starts models.SessionStarts `json:"starts"`
+	}
+	if err := decodeInto(value, &race); err != nil {
+		return nil, err
+	}
+
+	display := models.RaceDisplay{
+		Name:     race.Name,
+		Place:    race.Location + ", " + race.Country,
+		Circuit:  race.Circuit,
+		Date:     race.Date,
+		Sessions: []string{},
+		// Devices count down to these with their own clock
+		SessionTimes: []int64{},
+	}
+	// Sessions a weekend does not have, such as a sprint, are left out
+	for _, session := range []struct {
+		name, time string
+		start      int64
+	}{
+		{"Q1", race.Sessions.Q1, race.Starts.Q1},
+		{"Q2", race.Sessions.Q2, race.Starts.Q2},
+		{"Sprint", race.Sessions.Sprint, race.Starts.Sprint},
+		{"Race", race.Sessions.Race, race.Starts.Race},
+	} {
+		if session.time != "" {
+			display.Sessions = append(display.Sessions, session.name+": "+session.time)
+			display.SessionTimes = append(display.SessionTimes, session.start)
+		}
+	}
+	return display, nil
+}
+
+func buildStockDisplay(value interface{}) (interface{}, error) {
+	var stock struct {
+		PreviousClose float64 `json:"previousClose"`
+		Price         float64 `json:"regularMarketPrice"`
+		DayLow        float64 `json:"regularMarketDayLow"`
+		DayHigh       float64 `json:"regularMarketDayHigh"`
+	}
+	if err := decodeInto(value, &stock); err != nil {
+		return nil, err
+	}
+
+	display := models.StockDisplay{
+		Range:      fmt.Sprintf("$%.2f - $%.2f", stock.DayLow, stock.DayHigh),
+		Change:     "0.0%",
+		Color:      colorBlack,
+		PricePoint: pricePoint(stock.Price),
+	}
+	var percent float64
+	if stock.PreviousClose > 0 {
+		percent = (stock.Price - stock.PreviousClose) / stock.PreviousClose * 100
+	}
+	// Changes under 0.1% show as no change
+	if percent >= 0.1 {
+		display.Change = fmt.Sprintf(`/\ +%.1f%%`, percent)
+		display.Color = colorGreen
+	} else if percent <= -0.1 {
+		display.Change = fmt.Sprintf(`\/ %.1f%%`, math.Abs(percent))
+		display.Color = colorRed
+	}
+	return display, nil
+}
+
+func buildCryptoDisplay(value interface{}) (interface{}, error) {
+	var quote struct {
+		Price string `json:"price"`
+	}
+	if err := decodeInto(value, &quote); err != nil {
+		return nil, err
+	}
+	if quote.Price == "" {
+		return nil, fmt.Errorf("quote has no price")
+	}
+
+	// The headline price is shown in whole dollars
+	whole, _, _ := strings.Cut(quote.Price, ".")
+	price, _ := strconv.ParseFloat(quote.Price, 64)
+	return models.CryptoDisplay{Headline: "$" + whole, Price: "$" + quote.Price, PricePoint: pricePoint(price)}, nil
+}
+
+// pricePointDigits is the number of significant digits in a price point
+const pricePointDigits = 5
+
+// pricePoint is a price rounded to pricePointDigits significant digits, in
+// fixed point. A price that is not positive is a zero point.
+func pricePoint(price float64) models.PricePoint {
+	if !(price > 0) || math.IsInf(price, 0) {
+		return models.PricePoint{}
+	}
+	exponent := int(math.Floor(math.Log10(price))) - (pricePointDigits - 1)
+	point := math.Round(price / math.Pow10(exponent))
+	// Rounding up can carry into another digit, e.g. 99999.7
+	if point >= math.Pow10(pricePointDigits) {
+		exponent++
+		point = math.Round(price / math.Pow10(exponent))
+	}
+	return models.PricePoint{Point: int32(point), Exponent: exponent}
+}
+
+func buildNewsDisplay(value interface{}) (interface{}, error) {
+	var news struct {
+		Articles []struct {
+			Title string `json:"title"`
+		} `json:"articles"`
+	}
+	if err := decodeInto(value, &news); err != nil {
+		return nil, err
+	}
+
+	display := models.NewsDisplay{Headlines: make([]string, len(news.Articles))}
+	for i, article := range news.Articles {
+		display.Headlines[i] = truncateHeadline(fmt.Sprintf("%d. %s", i+1, article.Title), maxHeadlineChars)
+	}
+	return display, nil
+}
+
+// truncateHeadline cuts a headline to at most max characters, ending it with
+// "..." if anything was cut
+func truncateHeadline(headline string, max int) string {
+	runes := []rune(headline)
+	if len(runes) <= max {
+		return headline
+	}
+	return string(append(runes[:max-3], []rune("...")...))
+}
+
+// displayBody returns the encoded display model of value, the cache entry
+// stored under cacheKey. The encoding is kept with the entry like the bodies
+// writeJSON sends.
+func displayBody(r *http.Request, cacheKey string, value interface{}, build displayFunc) (*encodedResponse, error) {
+	encode := func(value interface{}) (interface{}, error) {
+		model, err := build(value)
+		if err != nil {
+			return nil, err
+		}
+		return encodeResponse(r.URL.Path, model, nil)
+	}
+
+	encoded, ok, err := apiCache.Derived(cacheKey, "display", encode)
+	if !ok {
+		encoded, err = encode(value)
+	}
+	if err != nil {
+		log.Printf("Error building display model: %v", err)
+		return nil, &statusError{http.StatusInternalServerError, err.Error()}
+	}
+	return encoded.(*encodedResponse), nil
+}
+
+// A displayLoader loads the encoded display model for a screen request
+type displayLoader func(r *http.Request) (*encodedResponse, error)
+
+func weatherDisplay(r *http.Request) (*encodedResponse, error) {
+	location := r.URL.Query().Get("location")
+	if location == "" {
+		return nil, &statusError{http.StatusBadRequest, "location parameter is required"}
+	}
+
+	weather, cacheKey, err := getWeather(location)
+	if err != nil {
+		log.Printf("Error getting weather: %v", err)
+		return nil, err
+	}
+	return displayBody(r, cacheKey, weather, buildWeatherDisplay)
+}
+
+func raceDisplay(prefix string) displayLoader {
+	return func(r *http.Request) (*encodedResponse, error) {
+		race, cacheKey, err := getNextRace(prefix, timezoneParam(r))
+		if err != nil {
+			return nil, err
+		}
+		return displayBody(r, cacheKey, race, buildRaceDisplay)
+	}
+}
+
+func quoteDisplay(prefix string, fetch quoteFetcher, build displayFunc) displayLoader {
+	return func(r *http.Request) (*encodedResponse, error) {
+		symbols := parseSymbols(r.URL.Query().Get("symbols"))
+		if symbols == nil {
+			return nil, &statusError{http.StatusBadRequest, "symbols parameter is required"}
+		}
+		return quotesBody(r, prefix, symbols, fetch, build)
+	}
+}
+
+func newsDisplay(r *http.Request) (*encodedResponse, error) {
+	news, cacheKey, err := getNews(newsParams(r))
+	if err != nil {
+		log.Printf("Error getting news: %v", err)
+		return nil, err
+	}
+	return displayBody(r, cacheKey, news, buildNewsDisplay)
+}
+
+var (
+	motogpDisplay   = raceDisplay("motogp")
+	formula1Display = raceDisplay("formula1")
+	financeDisplay  = quoteDisplay("stock", fetchStockInfo, buildStockDisplay)
+	cryptoDisplay   = quoteDisplay("crypto", fetchCryptoPrice, buildCryptoDisplay)
+)
+
+func writeDisplay(w http.ResponseWriter, r *http.Request, load displayLoader) {
+	body, err := load(r)
+	if err != nil {
+		writeError(w, err)
+		return
+	}
+	body.write(w, r)
+}
+
+// GetWeatherDisplay serves the weather screen for a location
+func GetWeatherDisplay(w http.ResponseWriter, r *http.Request) {
+	writeDisplay(w, r, weatherDisplay)
+}
+
+// GetMotoGPDisplay serves the next MotoGP race screen
+func GetMotoGPDisplay(w http.ResponseWriter, r *http.Request) {
+	writeDisplay(w, r, motogpDisplay)
+}
+
+// GetFormula1Display serves the next Formula 1 race screen
+func GetFormula1Display(w http.ResponseWriter, r *http.Request) {
+	writeDisplay(w, r, formula1Display)
+}
+
+// GetFinanceDisplay serves the stocks screen for symbols=
+func GetFinanceDisplay(w http.ResponseWriter, r *http.Request) {
+	writeDisplay(w, r, financeDisplay)
+}
+
+// GetCryptoDisplay serves the crypto screen for symbols=
+func GetCryptoDisplay(w http.ResponseWriter, r *http.Request) {
+	writeDisplay(w, r, cryptoDisplay)
+}
+
+// GetNewsDisplay serves the news screens, numbered and truncated headlines.
+// With since= it serves only what changed since the device's cursor.
+func GetNewsDisplay(w http.ResponseWriter, r *http.Request) {
+	if r.URL.Query().Has("since") {
+		writeDisplay(w, r, newsDeltaDisplay)
+		return
+	}
+	writeDisplay(w, r, newsDisplay)
+}
@@ -0,0 +1,190 @@
+package handlers
+
+import (
+	"encoding/json"
+	"net/http"
+	"net/http/httptest"
+	"strings"
+	"testing"
+	"time"
+
+	"daysync/api/models"
+	"daysync/api/render"
+)
+
+func TestBuildStockDisplay(t *testing.T) {
+	tests := []struct {
+		price, previousClose float64
+		change, color        string
+	}{
+		{101.5, 100, `/\ +1.5%`, colorGreen},
+		{97, 100, `\/ 3.0%`, colorRed},
+		{100.05, 100, "0.0%", colorBlack},
+		{5, 0, "0.0%", colorBlack},
+	}
+	for _, test := range tests {
+		value := map[string]interface{}{
+			"previousClose":        test.previousClose,
+			"regularMarketPrice":   test.price,
+			"regularMarketDayLow":  90.0,
+			"regularMarketDayHigh": 95.5,
+		}
+		model, err := buildStockDisplay(value)
+		if err != nil {
+			t.Fatal(err)
+		}
+		display := model.(models.StockDisplay)
+		if display.Change != test.change || display.Color != test.color || display.Range != "$90.00 - $95.50" {
+			t.Errorf("Price %v from %v: expected %s in %s, got %+v", test.price, test.previousClose, test.change, test.color, display)
+		}
+	}
+}
+
+func TestBuildWeatherDisplay(t *testing.T) {
+	model, err := buildWeatherDisplay(map[string]interface{}{
+		"temperature":    18.5,
+		"local_time":     "2025-06-08 21:30",
+		"condition_code": 0,
+		"is_day":         false,
+	})
+	if err != nil {
+		t.Fatal(err)
+	}
+	if weather := model.(models.WeatherDisplay); weather.Code != 0 || weather.Day || weather.Temperature != "18.5°C" {
+		t.Errorf("Unexpected weather display %+v", weather)
+	}
+
+	// Weather cached before condition codes were added has none
+	model, err = buildWeatherDisplay(map[string]interface{}{"temperature": 18.5})
+	if err != nil {
+		t.Fatal(err)
+	}
+	if weather := model.(models.WeatherDisplay); weather.Code != -1 {
+		t.Errorf("Expected no condition code, got %d", weather.Code)
+	}
+}
+
+func TestPricePoint(t *testing.T) {
+	tests := []struct {
+		price    float64
+		point    int32
+		exponent int
+	}{
+		{63890.01, 63890, 0},
+		{5432.1, 54321, -1},
+		{0.12345678, 12346, -5},
+		{99999.7, 10000, 1},
+		{123456789, 12346, 4},
+		{0, 0, 0},
+		{-3, 0, 0},
+	}
+	for _, test := range tests {
+		got := pricePoint(test.price)
+		if got.Point != test.point || got.Exponent != test.exponent {
+			t.Errorf("Price %v: expected %d * 10^%d, got %+v", test.price, test.point, test.exponent, got)
+		}
+	}
+}
+
+func TestBuildCryptoAndNewsDisplay(t *testing.T) {
+	model, err := buildCryptoDisplay(map[string]interface{}{"price": "63890.01000000"})
+	if err != nil {
+		t.Fatal(err)
+	}
+	if crypto := model.(models.CryptoDisplay); crypto.Headline != "$63890" || crypto.Price != "$63890.01000000" || crypto.Point != 63890 || crypto.Exponent != 0 {
+		t.Errorf("Unexpected crypto display %+v", crypto)
+	}
+
+	long := ""
+	for len(long) < 100 {
+		long += "word "
+	}
+	model, err = buildNewsDisplay(map[string]interface{}{
+		"articles": []interface{}{
+			map[string]interface{}{"title": "Short"},
+			map[string]interface{}{"title": long},
+		},
+	})
+	if err != nil {
+		t.Fatal(err)
+	}
+	headlines := model.(models.NewsDisplay).Headlines
+	if len(headlines) != 2 || headlines[0] != "1. Short" {
+		t.Fatalf("Unexpected headlines %q", headlines)
+	}
+	if len(headlines[1]) != maxHeadlineChars || headlines[1][maxHeadlineChars-3:] != "..." {
+		t.Errorf("Expected second headline cut to %d characters, got %q", maxHeadlineChars, headlines[1])
+	}
+}
+
+func TestGetMotoGPDisplay(t *testing.T) {
+	useTestCalendars(t)
+
+	rec := httptest.NewRecorder()
+	GetMotoGPDisplay(rec, httptest.NewRequest("GET", "/api/display/motogp?timezone=ACDT", nil))
+	if rec.Code != 200 {
+		t.Fatalf("Expected 200, got %d: %s", rec.Code, rec.Body.String())
+	}
+
+	var race models.RaceDisplay
+	if err := json.Unmarshal(rec.Body.Bytes(), &race); err != nil {
+		t.Fatalf("Unexpected response %q: %v", rec.Body.String(), err)
+	}
+	if len(race.Sessions) == 0 || race.Sessions[len(race.Sessions)-1] != "Race: 8th June 2025 at 21:30" {
+		t.Errorf("Expected race session last, got %q", race.Sessions)
+	}
+	// 21:30 in Adelaide, which is on UTC+9:30 in June
+	start := time.Date(2025, time.June, 8, 12, 0, 0, 0, time.UTC).Unix()
+	if len(race.SessionTimes) != len(race.Sessions) || race.SessionTimes[len(race.SessionTimes)-1] != start {
+		t.Errorf("Expected the race to start at %d, got %v", start, race.SessionTimes)
+	}
+
+	// The model is kept with the cache entry and reused
+	first, ok, _ := apiCache.Derived("motogp:nextrace:ACDT", "display", nil)
+	if !ok || first == nil {
+		t.Fatalf("Expected the display model to be kept with the cache entry")
+	}
+	rec = httptest.NewRecorder()
+	GetMotoGPDisplay(rec, httptest.NewRequest("GET", "/api/display/motogp?timezone=ACDT", nil))
+	if again, _, _ := apiCache.Derived("motogp:nextrace:ACDT", "display", nil); again != first {
+		t.Errorf("Expected the display model to be built once")
+	}
+}
+
+func TestGetMotoGPScreen(t *testing.T) {
+	useTestCalendars(t)
+
+	rec := httptest.NewRecorder()
+	GetMotoGPScreen(rec, httptest.NewRequest("GET", "/api/screen/motogp?timezone=ACDT", nil))
+	if rec.Code != 200 {
+		t.Fatalf("Expected 200, got %d: %s", rec.Code, rec.Body.String())
+	}
+	etag := rec.Header().Get("ETag")
+	if etag == "" || !strings.HasPrefix(rec.Body.String(), render.Magic) {
+		t.Fatalf("Expected an encoded screen with an ETag, got %q", rec.Header())
+	}
+
+	// A device that has the screen is told it has not changed
+	req := httptest.NewRequest("GET", "/api/screen/motogp?timezone=ACDT", nil)
+	req.Header.Set("If-None-Match", etag)
+	rec = httptest.NewRecorder()
+	GetMotoGPScreen(rec, req)
+	if rec.Code != http.StatusNotModified || rec.Body.Len() != 0 {
+		t.Errorf("Expected 304 with no body, got %d with %d bytes", rec.Code, rec.Body.Len())
+	}
+
+	// Other parameters are other screens
+	rec = httptest.NewRecorder()
+	GetMotoGPScreen(rec, httptest.NewRequest("GET", "/api/screen/motogp?timezone=UTC", nil))
+	if rec.Code != 200 || rec.Header().Get("ETag") == etag {
+		t.Errorf("Expected a different screen for another timezone, got %d %s", rec.Code, rec.Header().Get("ETag"))
+	}
+}
+
+func TestCapitalize(t *testing.T) {
+	for in, want := range map[string]string{"adelaide": "Adelaide", "århus": "Århus", "édimbourg": "Édimbourg", "": ""} {
+		if got := capitalize(in); got != want {
+			t.Errorf("capitalize(%q) = %q, want %q", in, got, want)
+		}
+	}
+}
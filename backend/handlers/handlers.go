@@ -2,17 +2,19 @@ package handlers
 
 import (
 	"encoding/json"
+	"errors"
 	"fmt"
 	"io"
 	"log"
 	"net/http"
 	"os"
-	"path/filepath"
 	"time"
 
 	"daysync/api/cache"
+	"daysync/api/calendar"
 	"daysync/api/config"
 	"daysync/api/helpers"
+	"daysync/api/metrics"
 	"daysync/api/models"
 	"daysync/api/services"
 )
@@ -20,6 +22,26 @@ import (
 var (
 	apiCache *cache.Cache
 	testMode bool
+
+	// calendars holds the season calendars from the data directory
+	calendars = calendar.NewStore("data")
+	// calendarFiles are the calendars LoadCalendars reads at startup
+	calendarFiles = []string{"motogp-2025.json", "formula1-2025.json"}
+	// timeNow is the clock next race lookups use, replaced in tests
+	timeNow = time.Now
+)
+
+// SetClock replaces the clock next race lookups use. The load test sets one
+// that runs inside the bundled seasons.
+func SetClock(now func() time.Time) {
+	timeNow = now
+}
+
+// Upstream API endpoints. The load test points them at its fake upstream.
+var (
+	CryptoAPIURL = "https://api.api-ninjas.com/v1/cryptoprice"
+	NewsAPIURL   = "https://gnews.io/api/v4/top-headlines"
+	StockAPIURL  = "https://query1.finance.yahoo.com/v8/finance/chart"
 )
 
 func init() {
@@ -27,245 +49,310 @@ func init() {
 	apiCache = cache.NewCache(config.GetCacheTimeout())
 }
 
-// SetTestMode enables or disables test mode
-func SetTestMode(enabled bool) {
-	testMode = enabled
+// InitCache replaces the cache with one configured from the loaded config.
+// Stale responses are served while they refresh, and popular ones are
+// refreshed before they expire. The cache is bounded, since its keys carry
+// client supplied locations, symbols and timezones.
+func InitCache() {
+	UseCache(CacheOptions())
+	go logCacheStats(15 * time.Minute)
 }
 
-func GetMotoGPSeason(w http.ResponseWriter, r *http.Request) {
-	log.Printf("Incoming request: %s %s from %s", r.Method, r.URL.Path, r.RemoteAddr)
+// CacheOptions returns the cache settings from the loaded config
+func CacheOptions() cache.Options {
+	return cache.Options{
+		Timeout:         config.GetCacheTimeout(),
+		StaleTimeout:    config.GetCacheTimeout() + config.GetCacheStaleTimeout(),
+		RefreshInterval: time.Minute,
+		PopularHits:     int64(config.GetCacheRefreshHits()),
+		MaxEntries:      config.GetCacheMaxEntries(),
+		MaxBytes:        config.GetCacheMaxBytes(),
+		SweepInterval:   5 * time.Minute,
+	}
+}
 
-	// Get timezone from query parameter
-	timezone := r.URL.Query().Get("timezone")
-	if timezone == "" {
-		timezone = "UTC" // Default to UTC if not specified
+// UseCache replaces the cache with a new one configured by opts
+func UseCache(opts cache.Options) {
+	apiCache.Close()
+	apiCache = cache.NewCacheWithOptions(opts)
+}
+
+// CacheStats returns the response cache's counters and size
+func CacheStats() cache.Stats {
+	return apiCache.Stats()
+}
+
+// debugf logs per-request detail, only when log_level is debug
+func debugf(format string, args ...interface{}) {
+	if config.DebugLogging() {
+		log.Printf(format, args...)
 	}
+}
 
-	// Check cache first
-	cacheKey := fmt.Sprintf("motogp:season:%s", timezone)
-	if cached, exists := apiCache.Get(cacheKey); exists {
-		log.Printf("[CACHE HIT] Returning cached MotoGP season data for timezone %s", timezone)
-		w.Header().Set("Content-Type", "application/json")
-		json.NewEncoder(w).Encode(cached)
-		return
+// logCacheStats periodically logs how reads were served by the cache
+func logCacheStats(interval time.Duration) {
+	for range time.Tick(interval) {
+		stats := apiCache.Stats()
+		log.Printf("[CACHE STATS] %d hits, %d stale hits, %d misses, %d background refreshes (%d failed), %d entries (%d KB), %d evicted, %d expired",
+			stats.Hits, stats.StaleHits, stats.Misses, stats.Refreshes, stats.RefreshErrors,
+			stats.Entries, stats.Bytes>>10, stats.Evictions, stats.Expirations)
 	}
+}
+
+// SetTestMode enables or disables test mode
+func SetTestMode(enabled bool) {
+	testMode = enabled
+}
 
-	log.Printf("[API CALL] No cache found for MotoGP season data, reading from file for timezone %s", timezone)
+// statusError is a load error that should reach the client with a specific
+// HTTP status instead of 500
+type statusError struct {
+	status int
+	msg    string
+}
 
-	// Read the JSON file
-	data, err := os.ReadFile(filepath.Join("data", "motogp-2025.json"))
-	if err != nil {
-		log.Printf("Error reading data file: %v", err)
-		http.Error(w, "error reading data", http.StatusInternalServerError)
-		return
-	}
+func (e *statusError) Error() string {
+	return e.msg
+}
 
-	var calendar models.Calendar
-	if err := json.Unmarshal(data, &calendar); err != nil {
-		log.Printf("Error parsing JSON data: %v", err)
-		http.Error(w, "error parsing data", http.StatusInternalServerError)
+// writeError sends err to the client, using its status if it has one
+func writeError(w http.ResponseWriter, err error) {
+	var se *statusError
+	if errors.As(err, &se) {
+		http.Error(w, se.msg, se.status)
 		return
 	}
+	http.Error(w, err.Error(), http.StatusInternalServerError)
+}
 
-	// Convert times to specified timezone and format
-	loc, err := helpers.GetLocationFromAbbreviation(timezone)
+// readCalendar returns the indexed season calendar for file, loading it
+// from the data directory on first use or after the file changes
+func readCalendar(file string) (*calendar.Index, error) {
+	index, err := calendars.Get(file)
 	if err != nil {
-		log.Printf("Invalid timezone: %v", err)
-		http.Error(w, "invalid timezone", http.StatusBadRequest)
-		return
+		var parseErr *calendar.ParseError
+		if errors.As(err, &parseErr) {
+			log.Printf("Error parsing JSON data: %v", err)
+			return nil, &statusError{http.StatusInternalServerError, "error parsing data"}
+		}
+		log.Printf("Error reading data file: %v", err)
+		return nil, &statusError{http.StatusInternalServerError, "error reading data"}
 	}
+	return index, nil
+}
 
-	// Create a copy of the calendar to avoid modifying the cached version
-	calendarCopy := calendar
-	for i := range calendarCopy.Races {
-		// Parse each time string and convert to the specified timezone
-		if q1, err := time.Parse(time.RFC3339, calendarCopy.Races[i].Sessions.Q1); err == nil {
-			calendarCopy.Races[i].Sessions.Q1 = q1.In(loc).Format(time.RFC3339)
-		}
-		if q2, err := time.Parse(time.RFC3339, calendarCopy.Races[i].Sessions.Q2); err == nil {
-			calendarCopy.Races[i].Sessions.Q2 = q2.In(loc).Format(time.RFC3339)
-		}
-		if sprint, err := time.Parse(time.RFC3339, calendarCopy.Races[i].Sessions.Sprint); err == nil {
-			calendarCopy.Races[i].Sessions.Sprint = sprint.In(loc).Format(time.RFC3339)
-		}
-		if race, err := time.Parse(time.RFC3339, calendarCopy.Races[i].Sessions.Race); err == nil {
-			calendarCopy.Races[i].Sessions.Race = race.In(loc).Format(time.RFC3339)
+// LoadCalendars reads every calendar file up front so the first requests do
+// not pay for it. A file that fails to load is retried on its next request.
+func LoadCalendars() {
+	for _, file := range calendarFiles {
+		if _, err := calendars.Get(file); err != nil {
+			log.Printf("Error loading calendar %s: %v", file, err)
 		}
 	}
-
-	// Cache the response
-	apiCache.Set(cacheKey, calendarCopy)
-	log.Printf("[CACHE SET] Cached MotoGP season data for timezone %s", timezone)
-
-	w.Header().Set("Content-Type", "application/json")
-	json.NewEncoder(w).Encode(calendarCopy)
 }
 
-func GetNextMotoGPRace(w http.ResponseWriter, r *http.Request) {
-	log.Printf("Incoming request: %s %s from %s", r.Method, r.URL.Path, r.RemoteAddr)
-
-	// Get timezone from query parameter
-	timezone := r.URL.Query().Get("timezone")
-	if timezone == "" {
-		timezone = "UTC" // Default to UTC if not specified
+// convertTime formats a parsed session time as RFC3339 in loc, keeping the
+// original string if it could not be parsed
+func convertTime(t time.Time, original string, loc *time.Location) string {
+	if t.IsZero() {
+		return original
 	}
+	return t.In(loc).Format(time.RFC3339)
+}
 
-	// Check cache first
-	cacheKey := fmt.Sprintf("motogp:nextrace:%s", timezone)
-	if cached, exists := apiCache.Get(cacheKey); exists {
-		log.Printf("[CACHE HIT] Returning cached next MotoGP race data for timezone %s", timezone)
-		w.Header().Set("Content-Type", "application/json")
-		json.NewEncoder(w).Encode(cached)
-		return
+// loadSeason returns the calendar in file with all session times converted
+// to timezone
+func loadSeason(file, timezone string) (interface{}, error) {
+	index, err := readCalendar(file)
+	if err != nil {
+		return nil, err
 	}
 
-	log.Printf("[API CALL] No cache found for next MotoGP race, reading from file for timezone %s", timezone)
-
-	// Read the JSON file
-	data, err := os.ReadFile(filepath.Join("data", "motogp-2025.json"))
+	// Convert times to specified timezone and format
+	loc, err := helpers.GetLocationFromAbbreviation(timezone)
 	if err != nil {
-		log.Printf("Error reading data file: %v", err)
-		http.Error(w, "error reading data", http.StatusInternalServerError)
-		return
+		log.Printf("Invalid timezone: %v", err)
+		return nil, &statusError{http.StatusBadRequest, "invalid timezone"}
 	}
 
-	var calendar models.Calendar
-	if err := json.Unmarshal(data, &calendar); err != nil {
-		log.Printf("Error parsing JSON data: %v", err)
-		http.Error(w, "error parsing data", http.StatusInternalServerError)
-		return
+	season := models.Calendar{Year: index.Year, Races: make([]models.Race, len(index.Races))}
+	for i, race := range index.Races {
+		season.Races[i] = race.Race
+		sessions := &season.Races[i].Sessions
+		sessions.Q1 = convertTime(race.Q1, sessions.Q1, loc)
+		sessions.Q2 = convertTime(race.Q2, sessions.Q2, loc)
+		sessions.Sprint = convertTime(race.Sprint, sessions.Sprint, loc)
+		sessions.Race = convertTime(race.Start, sessions.Race, loc)
+		season.Races[i].Starts = sessionStarts(&race)
 	}
+	return season, nil
+}
 
-	// Get current time in UTC
-	now := time.Now().UTC()
-
-	// Find the next race
-	var nextRace *models.Race
-	for i := range calendar.Races {
-		raceTime, err := time.Parse(time.RFC3339, calendar.Races[i].Sessions.Race)
-		if err != nil {
-			log.Printf("Error parsing race time: %v", err)
-			continue
-		}
-
-		if raceTime.After(now) {
-			nextRace = &calendar.Races[i]
-			break
-		}
+// loadNextRace returns the first race in file that has not started yet, with
+// its session times formatted for timezone
+func loadNextRace(file, timezone string) (interface{}, error) {
+	index, err := readCalendar(file)
+	if err != nil {
+		return nil, err
 	}
 
-	if nextRace == nil {
+	race := index.Next(timeNow().UTC())
+	if race == nil {
 		log.Printf("No upcoming races found")
-		http.Error(w, "no upcoming races found", http.StatusNotFound)
-		return
+		return nil, &statusError{http.StatusNotFound, "no upcoming races found"}
 	}
 
 	// Convert times to specified timezone and format
 	loc, err := helpers.GetLocationFromAbbreviation(timezone)
 	if err != nil {
 		log.Printf("Invalid timezone: %v", err)
-		http.Error(w, err.Error(), http.StatusBadRequest)
-		return
+		return nil, &statusError{http.StatusBadRequest, err.Error()}
 	}
 
-	nextRace.Sessions.Q1 = formatTime(nextRace.Sessions.Q1, loc)
-	nextRace.Sessions.Q2 = formatTime(nextRace.Sessions.Q2, loc)
-	nextRace.Sessions.Sprint = formatTime(nextRace.Sessions.Sprint, loc)
-	nextRace.Sessions.Race = formatTime(nextRace.Sessions.Race, loc)
-
-	// Cache the response
-	apiCache.Set(cacheKey, nextRace)
-	log.Printf("[CACHE SET] Cached next MotoGP race data for timezone %s", timezone)
+	nextRace := race.Race
+	nextRace.Sessions.Q1 = formatTime(race.Q1, nextRace.Sessions.Q1, loc)
+	nextRace.Sessions.Q2 = formatTime(race.Q2, nextRace.Sessions.Q2, loc)
+	nextRace.Sessions.Sprint = formatTime(race.Sprint, nextRace.Sessions.Sprint, loc)
+	nextRace.Sessions.Race = formatTime(race.Start, nextRace.Sessions.Race, loc)
+	nextRace.Starts = sessionStarts(race)
+	return &upcomingRace{Race: &nextRace, start: race.Start}, nil
+}
 
-	w.Header().Set("Content-Type", "application/json")
-	json.NewEncoder(w).Encode(nextRace)
+// upcomingRace is a cached next race. Once it starts it is expired, so the
+// cache never serves it as next, not even stale, and the following race is
+// loaded instead.
+type upcomingRace struct {
+	*models.Race
+	start time.Time
 }
 
-func GetNextFormula1Race(w http.ResponseWriter, r *http.Request) {
-	log.Printf("Incoming request: %s %s from %s", r.Method, r.URL.Path, r.RemoteAddr)
+// Expired reports whether the race has started
+func (r *upcomingRace) Expired() bool {
+	return !timeNow().Before(r.start)
+}
 
-	// Get timezone from query parameter
+// timezoneParam returns the timezone query parameter, UTC if not given
+func timezoneParam(r *http.Request) string {
 	timezone := r.URL.Query().Get("timezone")
 	if timezone == "" {
 		timezone = "UTC" // Default to UTC if not specified
 	}
+	return timezone
+}
 
-	// Check cache first
-	cacheKey := fmt.Sprintf("formula1:nextrace:%s", timezone)
-	if cached, exists := apiCache.Get(cacheKey); exists {
-		log.Printf("[CACHE HIT] Returning cached next Formula 1 race data for timezone %s", timezone)
-		w.Header().Set("Content-Type", "application/json")
-		json.NewEncoder(w).Encode(cached)
-		return
-	}
-
-	log.Printf("[API CALL] No cache found for next Formula 1 race, reading from file for timezone %s", timezone)
-
-	// Read the JSON file
-	data, err := os.ReadFile(filepath.Join("data", "formula1-2025.json"))
+func GetNextMotoGPRace(w http.ResponseWriter, r *http.Request) {
+	race, cacheKey, err := getNextRace("motogp", timezoneParam(r))
 	if err != nil {
-		log.Printf("Error reading data file: %v", err)
-		http.Error(w, "error reading data", http.StatusInternalServerError)
+		writeError(w, err)
 		return
 	}
+	writeJSON(w, r, cacheKey, race)
+}
 
-	var calendar models.Calendar
-	if err := json.Unmarshal(data, &calendar); err != nil {
-		log.Printf("Error parsing JSON data: %v", err)
-		http.Error(w, "error parsing data", http.StatusInternalServerError)
+func GetNextFormula1Race(w http.ResponseWriter, r *http.Request) {
+	race, cacheKey, err := getNextRace("formula1", timezoneParam(r))
+	if err != nil {
+		writeError(w, err)
 		return
 	}
+	writeJSON(w, r, cacheKey, race)
+}
 
-	// Get current time in UTC
-	now := time.Now().UTC()
+// series are the racing series with a calendar, by cache key prefix
+var series = map[string]struct {
+	name string
+	file string
+}{
+	"motogp":   {"MotoGP", "motogp-2025.json"},
+	"formula1": {"Formula 1", "formula1-2025.json"},
+}
 
-	// Find the next race
-	var nextRace *models.Race
-	for i := range calendar.Races {
-		raceTime, err := time.Parse(time.RFC3339, calendar.Races[i].Sessions.Race)
+// seasonHandler serves the whole season of a series with its session times
+// in the request's timezone
+func seasonHandler(prefix string) http.HandlerFunc {
+	s := series[prefix]
+	return func(w http.ResponseWriter, r *http.Request) {
+		timezone := timezoneParam(r)
+		cacheKey := fmt.Sprintf("%s:season:%s", prefix, timezone)
+		value, cached, err := apiCache.GetOrLoad(cacheKey, func() (interface{}, error) {
+			log.Printf("[API CALL] No cache found for %s season data, reading from file for timezone %s", s.name, timezone)
+			value, err := loadSeason(s.file, timezone)
+			if err == nil {
+				log.Printf("[CACHE SET] Cached %s season data for timezone %s", s.name, timezone)
+			}
+			return value, err
+		})
 		if err != nil {
-			log.Printf("Error parsing race time: %v", err)
-			continue
+			writeError(w, err)
+			return
 		}
-
-		if raceTime.After(now) {
-			nextRace = &calendar.Races[i]
-			break
+		if cached {
+			debugf("[CACHE HIT] Returning cached %s season data for timezone %s", s.name, timezone)
 		}
-	}
 
-	if nextRace == nil {
-		log.Printf("No upcoming races found")
-		http.Error(w, "no upcoming races found", http.StatusNotFound)
-		return
+		writeJSON(w, r, cacheKey, value)
 	}
+}
 
-	// Convert times to specified timezone and format
-	loc, err := helpers.GetLocationFromAbbreviation(timezone)
+var (
+	motogpSeason   = seasonHandler("motogp")
+	formula1Season = seasonHandler("formula1")
+)
+
+func GetMotoGPSeason(w http.ResponseWriter, r *http.Request) {
+	motogpSeason(w, r)
+}
+
+func GetFormula1Season(w http.ResponseWriter, r *http.Request) {
+	formula1Season(w, r)
+}
+
+// getNextRace returns the next race of a series with its session times in
+// timezone, and the key it is cached under
+func getNextRace(prefix, timezone string) (interface{}, string, error) {
+	s := series[prefix]
+	cacheKey := fmt.Sprintf("%s:nextrace:%s", prefix, timezone)
+	value, cached, err := apiCache.GetOrLoad(cacheKey, func() (interface{}, error) {
+		log.Printf("[API CALL] No cache found for next %s race data, reading from file for timezone %s", s.name, timezone)
+		value, err := loadNextRace(s.file, timezone)
+		if err == nil {
+			log.Printf("[CACHE SET] Cached next %s race data for timezone %s", s.name, timezone)
+		}
+		return value, err
+	})
 	if err != nil {
-		log.Printf("Invalid timezone: %v", err)
-		http.Error(w, err.Error(), http.StatusBadRequest)
-		return
+		return nil, cacheKey, err
 	}
+	if cached {
+		debugf("[CACHE HIT] Returning cached next %s race data for timezone %s", s.name, timezone)
+	}
+	return value, cacheKey, nil
+}
 
-	nextRace.Sessions.Q1 = formatTime(nextRace.Sessions.Q1, loc)
-	nextRace.Sessions.Q2 = formatTime(nextRace.Sessions.Q2, loc)
-	nextRace.Sessions.Sprint = formatTime(nextRace.Sessions.Sprint, loc)
-	nextRace.Sessions.Race = formatTime(nextRace.Sessions.Race, loc)
-
-	// Cache the response
-	apiCache.Set(cacheKey, nextRace)
-	log.Printf("[CACHE SET] Cached next Formula 1 race data for timezone %s", timezone)
+// unixTime returns t as Unix seconds, 0 for the zero time
+func unixTime(t time.Time) int64 {
+	if t.IsZero() {
+		return 0
+	}
+	return t.Unix()
+}
 
-	w.Header().Set("Content-Type", "application/json")
-	json.NewEncoder(w).Encode(nextRace)
+// sessionStarts returns the race's session start times as Unix seconds, 0
+// where unknown
+func sessionStarts(race *calendar.Race) *models.SessionStarts {
+	return &models.SessionStarts{
+		Q1:     unixTime(race.Q1),
+		Q2:     unixTime(race.Q2),
+		Sprint: unixTime(race.Sprint),
+		Race:   unixTime(race.Start),
+	}
 }
 
-func formatTime(timeStr string, loc *time.Location) string {
-	t, err := time.Parse(time.RFC3339, timeStr)
-	if err != nil {
-		log.Printf("Error parsing time string: %v", err)
-		return timeStr
+// formatTime formats a parsed session time for display in loc, keeping the
+// original string if it could not be parsed
+func formatTime(t time.Time, original string, loc *time.Location) string {
+	if t.IsZero() {
+		return original
 	}
 
 	t = t.In(loc)
@@ -292,8 +379,6 @@ func getOrdinal(n int) string {
 }
 
 func GetWeather(w http.ResponseWriter, r *http.Request) {
-	log.Printf("Incoming request: %s %s from %s", r.Method, r.URL.Path, r.RemoteAddr)
-
 	location := r.URL.Query().Get("location")
 	if location == "" {
 		log.Printf("Missing location parameter")
@@ -301,157 +386,167 @@ func GetWeather(w http.ResponseWriter, r *http.Request) {
 		return
 	}
 
-	// Check cache first
-	cacheKey := fmt.Sprintf("weather:%s", location)
-	if cached, exists := apiCache.Get(cacheKey); exists {
-		log.Printf("[CACHE HIT] Returning cached weather data for %s", location)
-		w.Header().Set("Content-Type", "application/json")
-		json.NewEncoder(w).Encode(cached)
-		return
-	}
-
-	log.Printf("[API CALL] No cache found for weather data, calling weather API for %s", location)
-
-	var weather interface{}
-	var err error
-
-	if testMode {
-		weather, err = services.GetTestWeather(location)
-	} else {
-		weather, err = services.GetWeather(location)
-	}
-
+	weather, cacheKey, err := getWeather(location)
 	if err != nil {
 		log.Printf("Error getting weather: %v", err)
-		http.Error(w, err.Error(), http.StatusInternalServerError)
+		writeError(w, err)
 		return
 	}
 
-	// Cache the response
-	apiCache.Set(cacheKey, weather)
-	log.Printf("[CACHE SET] Cached weather data for %s", location)
+	writeJSON(w, r, cacheKey, weather)
+}
 
-	w.Header().Set("Content-Type", "application/json")
-	json.NewEncoder(w).Encode(weather)
+// getWeather returns the current weather for location and the key it is
+// cached under
+func getWeather(location string) (interface{}, string, error) {
+	cacheKey := fmt.Sprintf("weather:%s", location)
+	weather, cached, err := apiCache.GetOrLoad(cacheKey, func() (interface{}, error) {
+		log.Printf("[API CALL] No cache found for weather data, calling weather API for %s", location)
+		var weather interface{}
+		var err error
+		if testMode {
+			weather, err = services.GetTestWeather(location)
+		} else {
+			weather, err = services.GetWeather(location)
+		}
+		if err == nil {
+			log.Printf("[CACHE SET] Cached weather data for %s", location)
+		}
+		return weather, err
+	})
+	if err != nil {
+		return nil, cacheKey, err
+	}
+	if cached {
+		debugf("[CACHE HIT] Returning cached weather data for %s", location)
+	}
+	return weather, cacheKey, nil
 }
 
 func GetCryptoPrice(w http.ResponseWriter, r *http.Request) {
-	log.Printf("Incoming request: %s %s from %s", r.Method, r.URL.Path, r.RemoteAddr)
+	if symbols := parseSymbols(r.URL.Query().Get("symbols")); symbols != nil {
+		writeQuotes(w, r, "crypto", symbols, fetchCryptoPrice)
+		return
+	}
 
 	symbol := r.URL.Query().Get("symbol")
 	if symbol == "" {
 		log.Printf("Missing symbol parameter")
-		http.Error(w, "symbol parameter is required", http.StatusBadRequest)
+		http.Error(w, "symbol or symbols parameter is required", http.StatusBadRequest)
 		return
 	}
 
-	// Check cache first
 	cacheKey := fmt.Sprintf("crypto:%s", symbol)
-	if cached, exists := apiCache.Get(cacheKey); exists {
-		log.Printf("[CACHE HIT] Returning cached crypto data for %s", symbol)
-		w.Header().Set("Content-Type", "application/json")
-		json.NewEncoder(w).Encode(cached)
+	response, cached, err := apiCache.GetOrLoad(cacheKey, func() (interface{}, error) {
+		log.Printf("[API CALL] No cache found for crypto data, calling API Ninjas for %s", symbol)
+		response, err := fetchCryptoPrice(symbol)
+		if err == nil {
+			log.Printf("[CACHE SET] Cached crypto data for %s", symbol)
+		}
+		return response, err
+	})
+	if err != nil {
+		log.Printf("Error getting crypto price: %v", err)
+		writeError(w, err)
 		return
 	}
+	if cached {
+		debugf("[CACHE HIT] Returning cached crypto data for %s", symbol)
+	}
 
-	log.Printf("[API CALL] No cache found for crypto data, calling API Ninjas for %s", symbol)
-
-	var response interface{}
-	var err error
+	writeJSON(w, r, cacheKey, response)
+}
 
+// fetchCryptoPrice gets the current price of one symbol from API Ninjas, or
+// from the test data in test mode.
+func fetchCryptoPrice(symbol string) (interface{}, error) {
 	if testMode {
-		response, err = services.GetTestCryptoPrice(symbol)
-	} else {
-		// Get API key from config or environment
-		apiKey := config.GetAPINinjasKey()
+		return services.GetTestCryptoPrice(symbol)
+	}
+
+	// Get API key from config or environment
+	apiKey := config.GetAPINinjasKey()
+	if apiKey == "" {
+		apiKey = os.Getenv("API_NINJAS_KEY")
 		if apiKey == "" {
-			apiKey = os.Getenv("API_NINJAS_KEY")
-			if apiKey == "" {
-				log.Printf("API key not configured")
-				http.Error(w, "API key not configured", http.StatusInternalServerError)
-				return
-			}
+			return nil, fmt.Errorf("API key not configured")
 		}
+	}
 
-		// Create request to API Ninja
-		client := &http.Client{}
-		req, err := http.NewRequest("GET", "https://api.api-ninjas.com/v1/cryptoprice?symbol="+symbol, nil)
-		if err != nil {
-			log.Printf("Error creating request: %v", err)
-			http.Error(w, err.Error(), http.StatusInternalServerError)
-			return
-		}
+	// Create request to API Ninja
+	client := &http.Client{Transport: metrics.Transport("apininjas")}
+	req, err := http.NewRequest("GET", CryptoAPIURL+"?symbol="+symbol, nil)
+	if err != nil {
+		return nil, err
+	}
 
-		req.Header.Set("X-Api-Key", apiKey)
+	req.Header.Set("X-Api-Key", apiKey)
 
-		// Make the request
-		resp, err := client.Do(req)
-		if err != nil {
-			log.Printf("Error making API request: %v", err)
-			http.Error(w, err.Error(), http.StatusInternalServerError)
-			return
-		}
-		defer resp.Body.Close()
+	// Make the request
+	resp, err := client.Do(req)
+	if err != nil {
+		return nil, err
+	}
+	defer resp.Body.Close()
 
-		// Check response status
-		if resp.StatusCode != http.StatusOK {
-			log.Printf("API request failed with status: %d", resp.StatusCode)
-			http.Error(w, fmt.Sprintf("API request failed with status: %d", resp.StatusCode), http.StatusInternalServerError)
-			return
-		}
+	// Check response status
+	if resp.StatusCode != http.StatusOK {
+		return nil, fmt.Errorf("API request failed with status: %d", resp.StatusCode)
+	}
 
-		// Parse the response
-		var result struct {
-			Symbol    string `json:"symbol"`
-			Price     string `json:"price"`
-			Timestamp int64  `json:"timestamp"`
-		}
+	// Parse the response
+	var result struct {
+		Symbol    string `json:"symbol"`
+		Price     string `json:"price"`
+		Timestamp int64  `json:"timestamp"`
+	}
 
-		if err := json.NewDecoder(resp.Body).Decode(&result); err != nil {
-			log.Printf("Error parsing API response: %v", err)
-			http.Error(w, err.Error(), http.StatusInternalServerError)
-			return
-		}
+	if err := json.NewDecoder(resp.Body).Decode(&result); err != nil {
+		return nil, err
+	}
 
-		// Convert timestamp to time.Time
-		t := time.Unix(result.Timestamp, 0)
-		// Format the time as "dd/mm/yy hh:mm:ss"
-		formattedTime := t.Format("02/01/06 15:04:05")
-
-		// Create response with formatted time
-		response = struct {
-			Symbol    string `json:"symbol"`
-			Price     string `json:"price"`
-			Timestamp string `json:"timestamp"`
-		}{
-			Symbol:    result.Symbol,
-			Price:     result.Price,
-			Timestamp: formattedTime,
-		}
+	// Convert timestamp to time.Time
+	t := time.Unix(result.Timestamp, 0)
+	// Format the time as "dd/mm/yy hh:mm:ss"
+	formattedTime := t.Format("02/01/06 15:04:05")
+
+	// Create response with formatted time
+	return struct {
+		Symbol    string `json:"symbol"`
+		Price     string `json:"price"`
+		Timestamp string `json:"timestamp"`
+	}{
+		Symbol:    result.Symbol,
+		Price:     result.Price,
+		Timestamp: formattedTime,
+	}, nil
+}
+
+// GetNews serves the top headlines. With since= it serves only the articles
+// that changed since the client's cursor (see news.go).
+func GetNews(w http.ResponseWriter, r *http.Request) {
+	if r.URL.Query().Has("since") {
+		writeNewsDelta(w, r)
+		return
 	}
 
+	newsResponse, cacheKey, err := getNews(newsParams(r))
 	if err != nil {
-		log.Printf("Error getting crypto price: %v", err)
-		http.Error(w, err.Error(), http.StatusInternalServerError)
+		log.Printf("Error getting news: %v", err)
+		writeError(w, err)
 		return
 	}
 
-	// Cache the response
-	apiCache.Set(cacheKey, response)
-	log.Printf("[CACHE SET] Cached crypto data for %s", symbol)
-
-	w.Header().Set("Content-Type", "application/json")
-	json.NewEncoder(w).Encode(response)
+	writeJSON(w, r, cacheKey, newsResponse)
 }
 
-func GetNews(w http.ResponseWriter, r *http.Request) {
-	log.Printf("Incoming request: %s %s from %s", r.Method, r.URL.Path, r.RemoteAddr)
-
-	// Get query parameters
-	category := r.URL.Query().Get("category")
-	lang := r.URL.Query().Get("lang")
-	country := r.URL.Query().Get("country")
-	max := r.URL.Query().Get("max")
+// newsParams returns the category, lang, country and max query parameters,
+// with defaults for those not given
+func newsParams(r *http.Request) (category, lang, country, max string) {
+	category = r.URL.Query().Get("category")
+	lang = r.URL.Query().Get("lang")
+	country = r.URL.Query().Get("country")
+	max = r.URL.Query().Get("max")
 
 	// Set default values if not provided
 	if category == "" {
@@ -466,297 +561,199 @@ func GetNews(w http.ResponseWriter, r *http.Request) {
 	if max == "" {
 		max = "10"
 	}
+	return category, lang, country, max
+}
 
-	// Check cache first
+// getNews returns the top headlines and the key they are cached under
+func getNews(category, lang, country, max string) (interface{}, string, error) {
 	cacheKey := fmt.Sprintf("news:%s:%s:%s:%s", category, lang, country, max)
-	if cached, exists := apiCache.Get(cacheKey); exists {
-		log.Printf("[CACHE HIT] Returning cached news data for category %s, lang %s, country %s", category, lang, country)
-		w.Header().Set("Content-Type", "application/json")
-		json.NewEncoder(w).Encode(cached)
-		return
+	newsResponse, cached, err := apiCache.GetOrLoad(cacheKey, func() (interface{}, error) {
+		log.Printf("[API CALL] No cache found for news data, calling GNews API for category %s, lang %s, country %s", category, lang, country)
+		newsResponse, err := fetchNews(category, lang, country, max)
+		if err == nil {
+			log.Printf("[CACHE SET] Cached news data for category %s, lang %s, country %s", category, lang, country)
+		}
+		return newsResponse, err
+	})
+	if err != nil {
+		return nil, cacheKey, err
 	}
+	if cached {
+		debugf("[CACHE HIT] Returning cached news data for category %s, lang %s, country %s", category, lang, country)
+	}
+	return newsResponse, cacheKey, nil
+}
 
-	log.Printf("[API CALL] No cache found for news data, calling GNews API for category %s, lang %s, country %s", category, lang, country)
-
-	var newsResponse interface{}
-	var err error
-
+// fetchNews gets top headlines from GNews, or from the test data in test mode
+func fetchNews(category, lang, country, max string) (interface{}, error) {
 	if testMode {
-		newsResponse, err = services.GetTestNews(category, lang, country, max)
-	} else {
-		// Get API key from config or environment
-		apiKey := config.GetGNewsAPIKey()
-		if apiKey == "" {
-			apiKey = os.Getenv("GNEWS_API_KEY")
-			if apiKey == "" {
-				log.Printf("API key not configured")
-				http.Error(w, "API key not configured", http.StatusInternalServerError)
-				return
-			}
-		}
-
-		// Create request to GNews
-		client := &http.Client{}
-		url := fmt.Sprintf("https://gnews.io/api/v4/top-headlines?category=%s&lang=%s&country=%s&max=%s&apikey=%s",
-			category, lang, country, max, apiKey)
+		return services.GetTestNews(category, lang, country, max)
+	}
 
-		req, err := http.NewRequest("GET", url, nil)
-		if err != nil {
-			log.Printf("Error creating request: %v", err)
-			http.Error(w, err.Error(), http.StatusInternalServerError)
-			return
+	// Get API key from config or environment
+	apiKey := config.GetGNewsAPIKey()
+	if apiKey == "" {
+		apiKey = os.Getenv("GNEWS_API_KEY")
+		if apiKey == "" {
+			return nil, fmt.Errorf("API key not configured")
 		}
+	}
 
-		// Make the request
-		resp, err := client.Do(req)
-		if err != nil {
-			log.Printf("Error making API request: %v", err)
-			http.Error(w, err.Error(), http.StatusInternalServerError)
-			return
-		}
-		defer resp.Body.Close()
+	// Create request to GNews
+	client := &http.Client{Transport: metrics.Transport("gnews")}
+	url := fmt.Sprintf("%s?category=%s&lang=%s&country=%s&max=%s&apikey=%s",
+		NewsAPIURL, category, lang, country, max, apiKey)
 
-		// Check response status
-		if resp.StatusCode != http.StatusOK {
-			log.Printf("API request failed with status: %d", resp.StatusCode)
-			http.Error(w, fmt.Sprintf("API request failed with status: %d", resp.StatusCode), http.StatusInternalServerError)
-			return
-		}
+	req, err := http.NewRequest("GET", url, nil)
+	if err != nil {
+		return nil, err
+	}
 
-		// Read the response body
-		body, err := io.ReadAll(resp.Body)
-		if err != nil {
-			log.Printf("Error reading response body: %v", err)
-			http.Error(w, err.Error(), http.StatusInternalServerError)
-			return
-		}
+	// Make the request
+	resp, err := client.Do(req)
+	if err != nil {
+		return nil, err
+	}
+	defer resp.Body.Close()
 
-		// Parse the response
-		if err := json.Unmarshal(body, &newsResponse); err != nil {
-			log.Printf("Error parsing news response: %v", err)
-			http.Error(w, err.Error(), http.StatusInternalServerError)
-			return
-		}
+	// Check response status
+	if resp.StatusCode != http.StatusOK {
+		return nil, fmt.Errorf("API request failed with status: %d", resp.StatusCode)
 	}
 
+	// Read the response body
+	body, err := io.ReadAll(resp.Body)
 	if err != nil {
-		log.Printf("Error getting news: %v", err)
-		http.Error(w, err.Error(), http.StatusInternalServerError)
-		return
+		return nil, err
 	}
 
-	// Cache the response
-	apiCache.Set(cacheKey, newsResponse)
-	log.Printf("[CACHE SET] Cached news data for category %s, lang %s, country %s", category, lang, country)
-
-	// Send the response
-	w.Header().Set("Content-Type", "application/json")
-	json.NewEncoder(w).Encode(newsResponse)
+	// Parse the response
+	var newsResponse interface{}
+	if err := json.Unmarshal(body, &newsResponse); err != nil {
+		return nil, err
+	}
+	return newsResponse, nil
 }
 
 // GetStockInfo handles requests for stock information
 func GetStockInfo(w http.ResponseWriter, r *http.Request) {
-	log.Printf("Incoming request: %s %s from %s", r.Method, r.URL.Path, r.RemoteAddr)
+	if symbols := parseSymbols(r.URL.Query().Get("symbols")); symbols != nil {
+		writeQuotes(w, r, "stock", symbols, fetchStockInfo)
+		return
+	}
 
 	symbol := r.URL.Query().Get("symbol")
 	if symbol == "" {
 		log.Printf("Missing symbol parameter")
-		http.Error(w, "symbol parameter is required", http.StatusBadRequest)
+		http.Error(w, "symbol or symbols parameter is required", http.StatusBadRequest)
 		return
 	}
 
-	// Check cache first
 	cacheKey := fmt.Sprintf("stock:%s", symbol)
-	if cached, exists := apiCache.Get(cacheKey); exists {
-		log.Printf("[CACHE HIT] Returning cached stock data for %s", symbol)
-		w.Header().Set("Content-Type", "application/json")
-		json.NewEncoder(w).Encode(cached)
-		return
-	}
-
-	log.Printf("[API CALL] No cache found for stock data, calling Yahoo Finance API for %s", symbol)
-
-	var response interface{}
-	var err error
-
-	// Try to get real data first
-	if !testMode {
-		// Create request to Yahoo Finance API
-		client := &http.Client{
-			Timeout: 10 * time.Second,
-		}
-		url := fmt.Sprintf("https://query1.finance.yahoo.com/v8/finance/chart/%s?1d&interval=1d", symbol)
-		req, err := http.NewRequest("GET", url, nil)
-		if err != nil {
-			log.Printf("Error creating request: %v", err)
-			// Fall back to test mode on request creation error
-			response, err = services.GetTestStockInfo(symbol)
-			if err != nil {
-				log.Printf("Error getting test stock info: %v", err)
-				http.Error(w, err.Error(), http.StatusInternalServerError)
-				return
-			}
-		} else {
-			// Add browser-like headers
-			req.Header.Set("User-Agent", "Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/91.0.4472.124 Safari/537.36")
-			req.Header.Set("Accept", "application/json, text/plain, */*")
-			req.Header.Set("Accept-Language", "en-US,en;q=0.9")
-			req.Header.Set("Origin", "https://finance.yahoo.com")
-			req.Header.Set("Referer", "https://finance.yahoo.com/")
-
-			// Add rate limiting delay
-			time.Sleep(1 * time.Second)
-
-			// Make the request
-			resp, err := client.Do(req)
-			if err != nil {
-				log.Printf("Error making API request: %v", err)
-				// Fall back to test mode on request error
-				response, err = services.GetTestStockInfo(symbol)
-				if err != nil {
-					log.Printf("Error getting test stock info: %v", err)
-					http.Error(w, err.Error(), http.StatusInternalServerError)
-					return
-				}
-			} else {
-				defer resp.Body.Close()
-
-				// Check response status
-				if resp.StatusCode == http.StatusTooManyRequests {
-					log.Printf("Rate limited by Yahoo Finance API, falling back to test mode")
-					response, err = services.GetTestStockInfo(symbol)
-				} else if resp.StatusCode != http.StatusOK {
-					log.Printf("API request failed with status: %d", resp.StatusCode)
-					http.Error(w, fmt.Sprintf("API request failed with status: %d", resp.StatusCode), http.StatusInternalServerError)
-					return
-				} else {
-					// Parse the response
-					var result struct {
-						Chart struct {
-							Result []struct {
-								Meta struct {
-									Symbol               string  `json:"symbol"`
-									LongName             string  `json:"longName"`
-									Timezone             string  `json:"timezone"`
-									ExchangeName         string  `json:"exchangeName"`
-									Gmtoffset            int     `json:"gmtoffset"`
-									FiftyTwoWeekHigh     float64 `json:"fiftyTwoWeekHigh"`
-									FiftyTwoWeekLow      float64 `json:"fiftyTwoWeekLow"`
-									RegularMarketDayHigh float64 `json:"regularMarketDayHigh"`
-									RegularMarketDayLow  float64 `json:"regularMarketDayLow"`
-									PreviousClose        float64 `json:"previousClose"`
-									Scale                int     `json:"scale"`
-									PriceHint            int     `json:"priceHint"`
-								} `json:"meta"`
-							} `json:"result"`
-						} `json:"chart"`
-					}
-
-					if err := json.NewDecoder(resp.Body).Decode(&result); err != nil {
-						log.Printf("Error parsing API response: %v", err)
-						// Fall back to test mode on parse error
-						response, err = services.GetTestStockInfo(symbol)
-					} else if len(result.Chart.Result) == 0 {
-						log.Printf("No data found for symbol %s", symbol)
-						http.Error(w, "no data found", http.StatusNotFound)
-						return
-					} else {
-						response = result.Chart.Result[0].Meta
-					}
-				}
-			}
-		}
-	}
-
-	// If we're in test mode or fell back to test mode
-	if testMode || response == nil {
-		response, err = services.GetTestStockInfo(symbol)
-		if err != nil {
-			log.Printf("Error getting test stock info: %v", err)
-			http.Error(w, err.Error(), http.StatusInternalServerError)
-			return
+	response, cached, err := apiCache.GetOrLoad(cacheKey, func() (interface{}, error) {
+		log.Printf("[API CALL] No cache found for stock data, calling Yahoo Finance API for %s", symbol)
+		response, err := fetchStockInfo(symbol)
+		if err == nil {
+			log.Printf("[CACHE SET] Cached stock data for %s", symbol)
 		}
-	}
-
+		return response, err
+	})
 	if err != nil {
 		log.Printf("Error getting stock info: %v", err)
-		http.Error(w, err.Error(), http.StatusInternalServerError)
+		writeError(w, err)
 		return
 	}
-
-	// Cache the response
-	apiCache.Set(cacheKey, response)
-	log.Printf("[CACHE SET] Cached stock data for %s", symbol)
-
-	w.Header().Set("Content-Type", "application/json")
-	json.NewEncoder(w).Encode(response)
-}
-
-func GetFormula1Season(w http.ResponseWriter, r *http.Request) {
-	log.Printf("Incoming request: %s %s from %s", r.Method, r.URL.Path, r.RemoteAddr)
-
-	// Get timezone from query parameter
-	timezone := r.URL.Query().Get("timezone")
-	if timezone == "" {
-		timezone = "UTC" // Default to UTC if not specified
+	if cached {
+		debugf("[CACHE HIT] Returning cached stock data for %s", symbol)
 	}
 
-	// Check cache first
-	cacheKey := fmt.Sprintf("formula1:season:%s", timezone)
-	if cached, exists := apiCache.Get(cacheKey); exists {
-		log.Printf("[CACHE HIT] Returning cached Formula 1 season data for timezone %s", timezone)
-		w.Header().Set("Content-Type", "application/json")
-		json.NewEncoder(w).Encode(cached)
-		return
-	}
+	writeJSON(w, r, cacheKey, response)
+}
 
-	log.Printf("[API CALL] No cache found for Formula 1 season data, reading from file for timezone %s", timezone)
+// errNoData is returned by fetchStockInfo when Yahoo Finance knows nothing
+// about a symbol
+var errNoData = &statusError{http.StatusNotFound, "no data found"}
 
-	// Read the JSON file
-	data, err := os.ReadFile(filepath.Join("data", "formula1-2025.json"))
-	if err != nil {
-		log.Printf("Error reading data file: %v", err)
-		http.Error(w, "error reading data", http.StatusInternalServerError)
-		return
+// fetchStockInfo gets market data for one symbol from Yahoo Finance. It falls
+// back to test data when Yahoo cannot be reached, rate limits us or sends
+// something unreadable, and always uses test data in test mode.
+func fetchStockInfo(symbol string) (interface{}, error) {
+	if testMode {
+		return services.GetTestStockInfo(symbol)
 	}
 
-	var calendar models.Calendar
-	if err := json.Unmarshal(data, &calendar); err != nil {
-		log.Printf("Error parsing JSON data: %v", err)
-		http.Error(w, "error parsing data", http.StatusInternalServerError)
-		return
+	// Create request to Yahoo Finance API
+	client := &http.Client{
+		Timeout:   10 * time.Second,
+		Transport: metrics.Transport("yahoo"),
 	}
-
-	// Convert times to specified timezone and format
-	loc, err := helpers.GetLocationFromAbbreviation(timezone)
+	url := fmt.Sprintf("%s/%s?1d&interval=1d", StockAPIURL, symbol)
+	req, err := http.NewRequest("GET", url, nil)
 	if err != nil {
-		log.Printf("Invalid timezone: %v", err)
-		http.Error(w, "invalid timezone", http.StatusBadRequest)
-		return
+		log.Printf("Error creating request: %v", err)
+		// Fall back to test mode on request creation error
+		return services.GetTestStockInfo(symbol)
 	}
 
-	// Create a copy of the calendar to avoid modifying the cached version
-	calendarCopy := calendar
-	for i := range calendarCopy.Races {
-		// Parse each time string and convert to the specified timezone
-		if q1, err := time.Parse(time.RFC3339, calendarCopy.Races[i].Sessions.Q1); err == nil {
-			calendarCopy.Races[i].Sessions.Q1 = q1.In(loc).Format(time.RFC3339)
-		}
-		if q2, err := time.Parse(time.RFC3339, calendarCopy.Races[i].Sessions.Q2); err == nil {
-			calendarCopy.Races[i].Sessions.Q2 = q2.In(loc).Format(time.RFC3339)
-		}
-		if sprint, err := time.Parse(time.RFC3339, calendarCopy.Races[i].Sessions.Sprint); err == nil {
-			calendarCopy.Races[i].Sessions.Sprint = sprint.In(loc).Format(time.RFC3339)
-		}
-		if race, err := time.Parse(time.RFC3339, calendarCopy.Races[i].Sessions.Race); err == nil {
-			calendarCopy.Races[i].Sessions.Race = race.In(loc).Format(time.RFC3339)
-		}
-	}
+	// Add browser-like headers
+	req.Header.Set("User-Agent", "Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/91.0.4472.124 Safari/537.36")
+	req.Header.Set("Accept", "application/json, text/plain, */*")
+	req.Header.Set("Accept-Language", "en-US,en;q=0.9")
+	req.Header.Set("Origin", "https://finance.yahoo.com")
+	req.Header.Set("Referer", "https://finance.yahoo.com/")
 
-	// Cache the response
-	apiCache.Set(cacheKey, calendarCopy)
-	log.Printf("[CACHE SET] Cached Formula 1 season data for timezone %s", timezone)
+	// Add rate limiting delay
+	time.Sleep(1 * time.Second)
 
-	w.Header().Set("Content-Type", "application/json")
-	json.NewEncoder(w).Encode(calendarCopy)
+	// Make the request
+	resp, err := client.Do(req)
+	if err != nil {
+		log.Printf("Error making API request: %v", err)
+		// Fall back to test mode on request error
+		return services.GetTestStockInfo(symbol)
+	}
+	defer resp.Body.Close()
+
+	// Check response status
+	if resp.StatusCode == http.StatusTooManyRequests {
+		log.Printf("Rate limited by Yahoo Finance API, falling back to test mode")
+		return services.GetTestStockInfo(symbol)
+	}
+	if resp.StatusCode != http.StatusOK {
+		return nil, fmt.Errorf("API request failed with status: %d", resp.StatusCode)
+	}
+
+	// Parse the response
+	var result struct {
+		Chart struct {
+			Result []struct {
+				Meta struct {
+					Symbol               string  `json:"symbol"`
+					LongName             string  `json:"longName"`
+					Timezone             string  `json:"timezone"`
+					ExchangeName         string  `json:"exchangeName"`
+					Gmtoffset            int     `json:"gmtoffset"`
+					FiftyTwoWeekHigh     float64 `json:"fiftyTwoWeekHigh"`
+					FiftyTwoWeekLow      float64 `json:"fiftyTwoWeekLow"`
+					RegularMarketDayHigh float64 `json:"regularMarketDayHigh"`
+					RegularMarketDayLow  float64 `json:"regularMarketDayLow"`
+					RegularMarketPrice   float64 `json:"regularMarketPrice"`
+					PreviousClose        float64 `json:"previousClose"`
+					Scale                int     `json:"scale"`
+					PriceHint            int     `json:"priceHint"`
+				} `json:"meta"`
+			} `json:"result"`
+		} `json:"chart"`
+	}
+
+	if err := json.NewDecoder(resp.Body).Decode(&result); err != nil {
+		log.Printf("Error parsing API response: %v", err)
+		// Fall back to test mode on parse error
+		return services.GetTestStockInfo(symbol)
+	}
+	if len(result.Chart.Result) == 0 {
+		log.Printf("No data found for symbol %s", symbol)
+		return nil, errNoData
+	}
+	return result.Chart.Result[0].Meta, nil
 }
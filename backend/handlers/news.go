@@ -0,0 +1,162 @@
+package handlers
+
+import (
+	"fmt"
+	"hash/fnv"
+	"log"
+	"net/http"
+
+	"daysync/api/models"
+)
+
+// News deltas let a client that keeps the headlines it already has fetch only
+// what changed. Its cursor, since=, lists the IDs of the articles it holds.
+// The response has the articles missing from the cursor and the cursor IDs
+// that are no longer listed. Nothing is kept per client, so the cursor works
+// against whichever cache entry serves the request.
+
+// maxCursorIDs is the most article IDs a since= cursor may list, the most
+// GNews returns for one request
+const maxCursorIDs = 100
+
+// articleID is a short ID for an article that stays the same across upstream
+// loads: a hash of its URL, or of its title if it has none
+func articleID(article map[string]interface{}) string {
+	key, _ := article["url"].(string)
+	if key == "" {
+		key, _ = article["title"].(string)
+	}
+	hash := fnv.New32a()
+	hash.Write([]byte(key))
+	return fmt.Sprintf("%08x", hash.Sum32())
+}
+
+// parseCursor reads a since= cursor into its IDs
+func parseCursor(r *http.Request) ([]string, error) {
+	ids := parseSymbols(r.URL.Query().Get("since"))
+	if len(ids) > maxCursorIDs {
+		return nil, &statusError{http.StatusBadRequest, fmt.Sprintf("since lists more than %d articles", maxCursorIDs)}
+	}
+	return ids, nil
+}
+
+// newsIndex is a news response's articles and their IDs. It is kept with the
+// cache entry, so each load is decoded and hashed once and a delta request
+// only compares IDs.
+type newsIndex struct {
+	articles []map[string]interface{}
+	ids      []string
+}
+
+// indexNews decodes the articles of a cached news response and works out
+// their IDs
+func indexNews(value interface{}) (interface{}, error) {
+	var news struct {
+		Articles []map[string]interface{} `json:"articles"`
+	}
+	if err := decodeInto(value, &news); err != nil {
+		return nil, err
+	}
+	ids := make([]string, len(news.Articles))
+	for i, article := range news.Articles {
+		ids[i] = articleID(article)
+	}
+	return &newsIndex{articles: news.Articles, ids: ids}, nil
+}
+
+// newsDelta compares the IDs of the listed articles, in order, with a cursor.
+// It returns the indexes of the articles the cursor does not have and the
+// cursor IDs that are no longer listed. An article listed twice is only
+// returned once.
+func newsDelta(ids []string, cursor []string) (added []int, evict []string) {
+	have := make(map[string]bool, len(cursor))
+	for _, id := range cursor {
+		have[id] = true
+	}
+	listed := make(map[string]bool, len(ids))
+	for i, id := range ids {
+		if !have[id] && !listed[id] {
+			added = append(added, i)
+		}
+		listed[id] = true
+	}
+
+	evict = []string{}
+	for _, id := range cursor {
+		if !listed[id] {
+			evict = append(evict, id)
+		}
+	}
+	return added, evict
+}
+
+// loadNewsDelta loads the news for the request and compares it with its
+// cursor. Returns the articles, their IDs and the delta.
+func loadNewsDelta(r *http.Request) (articles []map[string]interface{}, ids []string, added []int, evict []string, err error) {
+	cursor, err := parseCursor(r)
+	if err != nil {
+		return nil, nil, nil, nil, err
+	}
+	news, cacheKey, err := getNews(newsParams(r))
+	if err != nil {
+		log.Printf("Error getting news: %v", err)
+		return nil, nil, nil, nil, err
+	}
+	indexed, ok, err := apiCache.Derived(cacheKey, "newsids", indexNews)
+	if !ok {
+		indexed, err = indexNews(news)
+	}
+	if err != nil {
+		return nil, nil, nil, nil, &statusError{http.StatusInternalServerError, err.Error()}
+	}
+
+	index := indexed.(*newsIndex)
+	articles, ids = index.articles, index.ids
+	added, evict = newsDelta(ids, cursor)
+	debugf("[NEWS DELTA] %d articles, cursor of %d: %d new, %d to evict", len(articles), len(cursor), len(added), len(evict))
+	return articles, ids, added, evict, nil
+}
+
+// writeNewsDelta sends the articles missing from the request's cursor, each
+// with its ID, and the IDs to evict
+func writeNewsDelta(w http.ResponseWriter, r *http.Request) {
+	articles, ids, added, evict, err := loadNewsDelta(r)
+	if err != nil {
+		writeError(w, err)
+		return
+	}
+
+	delta := models.NewsUpdate{Articles: make([]map[string]interface{}, len(added)), Evict: evict}
+	for i, index := range added {
+		// A copy, the cached article is shared
+		article := make(map[string]interface{}, len(articles[index])+1)
+		for key, value := range articles[index] {
+			article[key] = value
+		}
+		article["id"] = ids[index]
+		delta.Articles[i] = article
+	}
+	// Depends on the cursor, so it is encoded for each request
+	writeJSON(w, r, "", delta)
+}
+
+// newsDeltaDisplay is the news display model as a delta: the headlines
+// missing from the cursor, whole. The device cuts them to the width of its
+// screen once it has numbered them.
+func newsDeltaDisplay(r *http.Request) (*encodedResponse, error) {
+	articles, ids, added, evict, err := loadNewsDelta(r)
+	if err != nil {
+		return nil, err
+	}
+
+	delta := models.NewsDisplayDelta{Headlines: make([]models.NewsHeadline, len(added)), Evict: evict}
+	for i, index := range added {
+		title, _ := articles[index]["title"].(string)
+		delta.Headlines[i] = models.NewsHeadline{ID: ids[index], Title: title}
+	}
+	encoded, err := encodeResponse(r.URL.Path, delta, nil)
+	if err != nil {
+		return nil, &statusError{http.StatusInternalServerError, err.Error()}
+	}
+	return encoded, nil
+}
@@ -0,0 +1,90 @@
+package handlers
+
+import (
+	"encoding/json"
+	"net/http/httptest"
+	"testing"
+
+	"daysync/api/models"
+)
+
+func TestNewsDelta(t *testing.T) {
+	added, evict := newsDelta([]string{"a", "b", "c", "b"}, []string{"b", "x"})
+	if len(added) != 2 || added[0] != 0 || added[1] != 2 {
+		t.Errorf("Expected articles 0 and 2 added, got %v", added)
+	}
+	if len(evict) != 1 || evict[0] != "x" {
+		t.Errorf("Expected x evicted, got %v", evict)
+	}
+
+	// An empty cursor gets every article and nothing to evict
+	added, evict = newsDelta([]string{"a", "b"}, nil)
+	if len(added) != 2 || evict == nil || len(evict) != 0 {
+		t.Errorf("Expected everything added for an empty cursor, got %v and %v", added, evict)
+	}
+}
+
+func TestGetNewsDisplayDelta(t *testing.T) {
+	apiCache.Clear()
+	article := func(title, url string) map[string]interface{} {
+		return map[string]interface{}{"title": title, "url": url}
+	}
+	apiCache.Set("news:general:en:au:10", map[string]interface{}{
+		"articles": []interface{}{
+			article("First", "https://example.com/1"),
+			article("Second", "https://example.com/2"),
+			article("Third", "https://example.com/3"),
+		},
+	})
+
+	get := func(since string) models.NewsDisplayDelta {
+		t.Helper()
+		rec := httptest.NewRecorder()
+		GetNewsDisplay(rec, httptest.NewRequest("GET", "/api/display/news?max=10&country=au&since="+since, nil))
+		if rec.Code != 200 {
+			t.Fatalf("Expected 200, got %d: %s", rec.Code, rec.Body.String())
+		}
+		var delta models.NewsDisplayDelta
+		if err := json.Unmarshal(rec.Body.Bytes(), &delta); err != nil {
+			t.Fatalf("Unexpected response %q: %v", rec.Body.String(), err)
+		}
+		return delta
+	}
+
+	// A device with nothing gets every headline, unnumbered
+	all := get("")
+	if len(all.Headlines) != 3 || all.Headlines[0].Title != "First" || len(all.Evict) != 0 {
+		t.Fatalf("Expected all three headlines, got %+v", all)
+	}
+
+	// A device holding the first two and one that is gone
+	since := all.Headlines[0].ID + "," + all.Headlines[1].ID + ",deadbeef"
+	delta := get(since)
+	if len(delta.Headlines) != 1 || delta.Headlines[0].Title != "Third" || delta.Headlines[0].ID != all.Headlines[2].ID {
+		t.Errorf("Expected only the third headline, got %+v", delta.Headlines)
+	}
+	if len(delta.Evict) != 1 || delta.Evict[0] != "deadbeef" {
+		t.Errorf("Expected deadbeef evicted, got %v", delta.Evict)
+	}
+
+	// The raw endpoint sends whole articles with their IDs
+	rec := httptest.NewRecorder()
+	GetNews(rec, httptest.NewRequest("GET", "/api/news?since="+since, nil))
+	var update models.NewsUpdate
+	if err := json.Unmarshal(rec.Body.Bytes(), &update); err != nil {
+		t.Fatalf("Unexpected response %q: %v", rec.Body.String(), err)
+	}
+	if len(update.Articles) != 1 || update.Articles[0]["url"] != "https://example.com/3" || update.Articles[0]["id"] != all.Headlines[2].ID {
+		t.Errorf("Expected the third article with its ID, got %+v", update.Articles)
+	}
+
+	// The articles were decoded and hashed once, for the cache entry
+	first, _, _ := apiCache.Derived("news:general:en:au:10", "newsids", indexNews)
+	again, _, _ := apiCache.Derived("news:general:en:au:10", "newsids", func(interface{}) (interface{}, error) {
+		t.Fatal("Expected the article index to be kept with the cache entry")
+		return nil, nil
+	})
+	if first != again {
+		t.Errorf("Expected the same article index for every request")
+	}
+}
@@ -0,0 +1,102 @@
+package handlers
+
+import (
+	"encoding/json"
+	"fmt"
+	"sort"
+	"strings"
+)
+
+// fieldTree describes which fields of a JSON value to keep. A nil subtree
+// keeps the whole value under that name.
+type fieldTree map[string]fieldTree
+
+// parseFields turns a fields= parameter such as "title,sessions.race" into a
+// sorted, de-duplicated list. Dotted paths select nested fields; when the
+// parent is an array the path applies to every element.
+func parseFields(param string) []string {
+	if param == "" {
+		return nil
+	}
+
+	seen := make(map[string]bool)
+	var fields []string
+	for _, field := range strings.Split(param, ",") {
+		field = strings.TrimSpace(field)
+		if field == "" || seen[field] {
+			continue
+		}
+		seen[field] = true
+		fields = append(fields, field)
+	}
+	sort.Strings(fields)
+	return fields
+}
+
+func buildFieldTree(fields []string) fieldTree {
+	tree := fieldTree{}
+	for _, field := range fields {
+		node := tree
+		parts := strings.Split(field, ".")
+		for i, part := range parts {
+			child, exists := node[part]
+			if exists && child == nil {
+				// Parent already selected as a whole
+				break
+			}
+			if i == len(parts)-1 {
+				node[part] = nil
+				break
+			}
+			if !exists {
+				child = fieldTree{}
+				node[part] = child
+			}
+			node = child
+		}
+	}
+	return tree
+}
+
+func applyProjection(value interface{}, tree fieldTree) interface{} {
+	switch v := value.(type) {
+	case map[string]interface{}:
+		out := make(map[string]interface{}, len(tree))
+		for name, sub := range tree {
+			child, ok := v[name]
+			if !ok {
+				continue
+			}
+			if sub == nil {
+				out[name] = child
+			} else {
+				out[name] = applyProjection(child, sub)
+			}
+		}
+		return out
+	case []interface{}:
+		out := make([]interface{}, len(v))
+		for i := range v {
+			out[i] = applyProjection(v[i], tree)
+		}
+		return out
+	default:
+		return value
+	}
+}
+
+// projectFields returns a copy of value holding only the requested fields,
+// along with the encoded size of value before projection
+func projectFields(value interface{}, fields []string) (interface{}, int, error) {
+	full, err := json.Marshal(value)
+	if err != nil {
+		return nil, 0, fmt.Errorf("error encoding response for projection: %v", err)
+	}
+
+	var generic interface{}
+	if err := json.Unmarshal(full, &generic); err != nil {
+		return nil, 0, fmt.Errorf("error decoding response for projection: %v", err)
+	}
+
+	return applyProjection(generic, buildFieldTree(fields)), len(full), nil
+}
@@ -0,0 +1,57 @@
+package handlers
+
+import (
+	"encoding/json"
+	"testing"
+)
+
+func TestParseFields(t *testing.T) {
+	fields := parseFields(" price , symbol,price,,")
+	if len(fields) != 2 || fields[0] != "price" || fields[1] != "symbol" {
+		t.Errorf("Expected [price symbol], got %v", fields)
+	}
+
+	if fields := parseFields(""); fields != nil {
+		t.Errorf("Expected nil for empty parameter, got %v", fields)
+	}
+}
+
+func TestProjectFields(t *testing.T) {
+	news := map[string]interface{}{
+		"totalArticles": 2,
+		"articles": []interface{}{
+			map[string]interface{}{"title": "First", "description": "long text", "url": "https://a"},
+			map[string]interface{}{"title": "Second", "description": "long text", "url": "https://b"},
+		},
+	}
+
+	projected, fullSize, err := projectFields(news, []string{"articles.title"})
+	if err != nil {
+		t.Fatalf("Unexpected error: %v", err)
+	}
+	data, _ := json.Marshal(projected)
+	if len(data) >= fullSize {
+		t.Errorf("Expected projected payload to be smaller, got %d >= %d", len(data), fullSize)
+	}
+
+	expected := `{"articles":[{"title":"First"},{"title":"Second"}]}`
+	if string(data) != expected {
+		t.Errorf("Expected %s, got %s", expected, data)
+	}
+
+	// Selecting a parent keeps it whole even if a child path is also given
+	race := map[string]interface{}{
+		"name":     "Grand Prix",
+		"round":    1,
+		"sessions": map[string]interface{}{"q1": "a", "race": "b"},
+	}
+	projected, _, err = projectFields(race, []string{"name", "sessions", "sessions.race"})
+	if err != nil {
+		t.Fatalf("Unexpected error: %v", err)
+	}
+	data, _ = json.Marshal(projected)
+	expected = `{"name":"Grand Prix","sessions":{"q1":"a","race":"b"}}`
+	if string(data) != expected {
+		t.Errorf("Expected %s, got %s", expected, data)
+	}
+}
@@ -0,0 +1,167 @@
+package handlers
+
+import (
+	"fmt"
+	"log"
+	"net/http"
+	"strings"
+	"sync"
+	"sync/atomic"
+)
+
+const (
+	// maxQuoteSymbols limits how many symbols one symbols= request may ask for
+	maxQuoteSymbols = 20
+	// maxUpstreamFetches limits how many upstream requests a single symbols=
+	// request runs at once
+	maxUpstreamFetches = 4
+)
+
+// quoteFetcher loads the quote for one symbol from its upstream API
+type quoteFetcher func(symbol string) (interface{}, error)
+
+// quotesResponse is the body of a symbols= request. Quotes are in the order
+// the symbols were requested. A symbol that could not be loaded has a null
+// entry and its error under Errors.
+type quotesResponse struct {
+	Quotes []interface{}     `json:"quotes"`
+	Errors map[string]string `json:"errors,omitempty"`
+}
+
+// parseSymbols splits a symbols= parameter such as "BTCUSD,ETHUSD" into a
+// list in request order, dropping blanks and repeats.
+func parseSymbols(param string) []string {
+	if param == "" {
+		return nil
+	}
+
+	seen := make(map[string]bool)
+	var symbols []string
+	for _, symbol := range strings.Split(param, ",") {
+		symbol = strings.TrimSpace(symbol)
+		if symbol == "" || seen[symbol] {
+			continue
+		}
+		seen[symbol] = true
+		symbols = append(symbols, symbol)
+	}
+	return symbols
+}
+
+// getQuotes serves each symbol from the cache under "prefix:symbol", the key
+// single-symbol requests use, and loads the misses concurrently with at most
+// maxUpstreamFetches loads in flight. A symbol already being loaded by another
+// request is waited on rather than fetched again. It returns the number of quotes
+// this request fetched upstream and cached.
+func getQuotes(prefix string, symbols []string, fetch quoteFetcher) (quotesResponse, int) {
+	response := quotesResponse{Quotes: make([]interface{}, len(symbols))}
+	errs := make([]error, len(symbols))
+
+	// Every symbol goes through GetOrLoad once, so the cache counts each as
+	// one hit or miss. Only the loads this request runs take a slot and count
+	// as fetched; waiting on another request's load does neither.
+	sem := make(chan struct{}, maxUpstreamFetches)
+	var hits, fetched atomic.Int32
+	var wg sync.WaitGroup
+	for i := range symbols {
+		i := i
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+
+			quote, cached, err := apiCache.GetOrLoad(fmt.Sprintf("%s:%s", prefix, symbols[i]), func() (interface{}, error) {
+				sem <- struct{}{}
+				defer func() { <-sem }()
+				quote, err := fetch(symbols[i])
+				if err == nil {
+					fetched.Add(1)
+				}
+				return quote, err
+			})
+			if cached {
+				hits.Add(1)
+			}
+			if err != nil {
+				errs[i] = err
+				return
+			}
+			response.Quotes[i] = quote
+		}()
+	}
+	wg.Wait()
+	debugf("[CACHE HIT] %d of %d %s quotes cached, fetched %d", hits.Load(), len(symbols), prefix, fetched.Load())
+
+	for i, err := range errs {
+		if err == nil {
+			continue
+		}
+		if response.Errors == nil {
+			response.Errors = make(map[string]string)
+		}
+		response.Errors[symbols[i]] = err.Error()
+		log.Printf("Error getting %s quote for %s: %v", prefix, symbols[i], err)
+	}
+	return response, int(fetched.Load())
+}
+
+// displayQuotes replaces each quote in response with its display model. The
+// model is kept with the symbol's cache entry, so it is built once per load.
+func displayQuotes(response *quotesResponse, prefix string, symbols []string, build displayFunc) {
+	for i, quote := range response.Quotes {
+		if quote == nil {
+			continue
+		}
+		model, ok, err := apiCache.Derived(fmt.Sprintf("%s:%s", prefix, symbols[i]), "display", build)
+		if !ok {
+			model, err = build(quote)
+		}
+		if err != nil {
+			if response.Errors == nil {
+				response.Errors = make(map[string]string)
+			}
+			response.Errors[symbols[i]] = err.Error()
+			log.Printf("Error building %s display for %s: %v", prefix, symbols[i], err)
+			model = nil
+		}
+		response.Quotes[i] = model
+	}
+}
+
+// quotesBody answers a symbols= request, with each quote replaced by its
+// display model if build is given. Symbols that fail are reported in the
+// response; the request only fails if none of them could be loaded.
+func quotesBody(r *http.Request, prefix string, symbols []string, fetch quoteFetcher, build displayFunc) (*encodedResponse, error) {
+	if len(symbols) > maxQuoteSymbols {
+		return nil, &statusError{http.StatusBadRequest, fmt.Sprintf("at most %d symbols may be requested at once", maxQuoteSymbols)}
+	}
+
+	response, fetched := getQuotes(prefix, symbols, fetch)
+	if fetched > 0 {
+		log.Printf("[CACHE SET] Cached %d %s quotes", fetched, prefix)
+	}
+	if build != nil {
+		displayQuotes(&response, prefix, symbols, build)
+	}
+	if len(response.Errors) == len(symbols) {
+		return nil, &statusError{http.StatusInternalServerError, fmt.Sprintf("no quotes could be loaded: %s", response.Errors[symbols[0]])}
+	}
+
+	// The quotes themselves are cached per symbol and may have been refreshed
+	// by other requests, so the response is encoded afresh each time.
+	body, err := encodeResponse(r.URL.Path, response, parseFields(r.URL.Query().Get("fields")))
+	if err != nil {
+		log.Printf("Error encoding response: %v", err)
+		return nil, &statusError{http.StatusInternalServerError, err.Error()}
+	}
+	return body, nil
+}
+
+// writeQuotes sends the response to a symbols= request
+func writeQuotes(w http.ResponseWriter, r *http.Request, prefix string, symbols []string, fetch quoteFetcher) {
+	body, err := quotesBody(r, prefix, symbols, fetch, nil)
+	if err != nil {
+		writeError(w, err)
+		return
+	}
+	body.write(w, r)
+}
@@ -0,0 +1,141 @@
+package handlers
+
+import (
+	"encoding/json"
+	"errors"
+	"net/http/httptest"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+)
+
+func TestParseSymbols(t *testing.T) {
+	symbols := parseSymbols("ETHUSD, BTCUSD,,ETHUSD ")
+	if len(symbols) != 2 || symbols[0] != "ETHUSD" || symbols[1] != "BTCUSD" {
+		t.Errorf("Expected [ETHUSD BTCUSD] in request order, got %v", symbols)
+	}
+
+	if symbols := parseSymbols(""); symbols != nil {
+		t.Errorf("Expected nil for empty parameter, got %v", symbols)
+	}
+}
+
+func TestGetQuotesUsesCacheAndBoundsFanOut(t *testing.T) {
+	apiCache.Clear()
+	apiCache.Set("crypto:BTCUSD", map[string]interface{}{"symbol": "BTCUSD", "price": "1.00"})
+
+	symbols := []string{"BTCUSD", "ETHUSD", "XRPUSD", "DOGEUSD", "BNBUSD", "SOLUSD", "ADAUSD"}
+	var inFlight, maxInFlight int32
+	var mu sync.Mutex
+	calls := make(map[string]int)
+
+	fetch := func(symbol string) (interface{}, error) {
+		n := atomic.AddInt32(&inFlight, 1)
+		defer atomic.AddInt32(&inFlight, -1)
+		for {
+			max := atomic.LoadInt32(&maxInFlight)
+			if n <= max || atomic.CompareAndSwapInt32(&maxInFlight, max, n) {
+				break
+			}
+		}
+
+		mu.Lock()
+		calls[symbol]++
+		mu.Unlock()
+
+		time.Sleep(20 * time.Millisecond)
+		return map[string]interface{}{"symbol": symbol, "price": "2.00"}, nil
+	}
+
+	missesBefore := apiCache.Stats().Misses
+	response, fetched := getQuotes("crypto", symbols, fetch)
+	if fetched != len(symbols)-1 {
+		t.Errorf("Expected %d upstream fetches, got %d", len(symbols)-1, fetched)
+	}
+	if misses := apiCache.Stats().Misses - missesBefore; misses != uint64(len(symbols)-1) {
+		t.Errorf("Expected each uncached symbol to count one miss, got %d", misses)
+	}
+	if calls["BTCUSD"] != 0 {
+		t.Errorf("Expected cached BTCUSD not to be fetched")
+	}
+	if maxInFlight > maxUpstreamFetches {
+		t.Errorf("Expected at most %d concurrent fetches, saw %d", maxUpstreamFetches, maxInFlight)
+	}
+	if maxInFlight < 2 {
+		t.Errorf("Expected misses to be fetched concurrently, saw %d at once", maxInFlight)
+	}
+
+	for i, symbol := range symbols {
+		quote, ok := response.Quotes[i].(map[string]interface{})
+		if !ok || quote["symbol"] != symbol {
+			t.Errorf("Expected quote %d to be %s, got %v", i, symbol, response.Quotes[i])
+		}
+	}
+	if _, exists := apiCache.Get("crypto:ETHUSD"); !exists {
+		t.Errorf("Expected fetched quotes to be cached per symbol")
+	}
+}
+
+func TestGetQuotesCountsOnlyItsOwnFetches(t *testing.T) {
+	apiCache.Clear()
+	symbols := []string{"BTCUSD", "ETHUSD", "XRPUSD"}
+	var calls int32
+	fetch := func(symbol string) (interface{}, error) {
+		atomic.AddInt32(&calls, 1)
+		time.Sleep(20 * time.Millisecond)
+		return map[string]interface{}{"symbol": symbol}, nil
+	}
+
+	// Requests for the same symbols at once share each load, and only the
+	// one that ran it counts it as fetched
+	const requests = 4
+	var total int32
+	var wg sync.WaitGroup
+	for i := 0; i < requests; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			_, fetched := getQuotes("crypto", symbols, fetch)
+			atomic.AddInt32(&total, int32(fetched))
+		}()
+	}
+	wg.Wait()
+	if total != calls {
+		t.Errorf("Expected fetched to add up to the %d upstream calls, got %d", calls, total)
+	}
+}
+
+func TestWriteQuotesReportsFailedSymbols(t *testing.T) {
+	apiCache.Clear()
+	fetch := func(symbol string) (interface{}, error) {
+		if symbol == "BAD" {
+			return nil, errors.New("unknown symbol")
+		}
+		return map[string]interface{}{"symbol": symbol, "price": "3.00"}, nil
+	}
+
+	req := httptest.NewRequest("GET", "/api/crypto?symbols=BTCUSD,BAD&fields=quotes.price,errors", nil)
+	rec := httptest.NewRecorder()
+	writeQuotes(rec, req, "crypto", []string{"BTCUSD", "BAD"}, fetch)
+
+	var body struct {
+		Quotes []map[string]interface{} `json:"quotes"`
+		Errors map[string]string        `json:"errors"`
+	}
+	if err := json.Unmarshal(rec.Body.Bytes(), &body); err != nil {
+		t.Fatalf("Unexpected response %q: %v", rec.Body.String(), err)
+	}
+	if len(body.Quotes) != 2 || body.Quotes[0]["price"] != "3.00" || body.Quotes[1] != nil {
+		t.Errorf("Expected [{price:3.00} null], got %v", body.Quotes)
+	}
+	if body.Errors["BAD"] != "unknown symbol" {
+		t.Errorf("Expected error for BAD, got %v", body.Errors)
+	}
+
+	rec = httptest.NewRecorder()
+	writeQuotes(rec, req, "crypto", []string{"BAD"}, fetch)
+	if rec.Code != 500 {
+		t.Errorf("Expected 500 when no symbol loads, got %d", rec.Code)
+	}
+}
@@ -0,0 +1,146 @@
+package handlers
+
+import (
+	"bytes"
+	"compress/gzip"
+	"encoding/json"
+	"fmt"
+	"hash/fnv"
+	"log"
+	"net/http"
+	"strconv"
+	"strings"
+	"sync"
+)
+
+// minGzipSize is the smallest body worth compressing. Below it the gzip
+// framing eats most of the savings.
+const minGzipSize = 1024
+
+// encodedResponse is a response body encoded once and written as is to every
+// request served from the same cache entry and field set
+type encodedResponse struct {
+	body []byte
+	etag string // quoted hash of body
+
+	gzipOnce sync.Once
+	gzipped  []byte // nil if the body is too small to be worth compressing
+}
+
+// Size reports the encoded body to the cache's memory accounting. The gzip
+// copy is built later and only for large bodies, so it is left out.
+func (e *encodedResponse) Size() int {
+	return len(e.body)
+}
+
+// encodeResponse encodes value, projected to fields if any are given, the way
+// json.Encoder writes it to a response
+func encodeResponse(path string, value interface{}, fields []string) (*encodedResponse, error) {
+	fullSize := 0
+	if len(fields) > 0 {
+		projected, size, err := projectFields(value, fields)
+		if err != nil {
+			return nil, err
+		}
+		value, fullSize = projected, size
+	}
+
+	var buf bytes.Buffer
+	if err := json.NewEncoder(&buf).Encode(value); err != nil {
+		return nil, fmt.Errorf("error encoding response: %v", err)
+	}
+	if fullSize > 0 {
+		// Without the newline json.Encoder ends the body with
+		slimSize := buf.Len() - 1
+		debugf("[PROJECTION] %s: %d -> %d bytes (%.0f%% smaller) for fields %s",
+			path, fullSize, slimSize, 100*(1-float64(slimSize)/float64(fullSize)), strings.Join(fields, ","))
+	}
+	hash := fnv.New64a()
+	hash.Write(buf.Bytes())
+	return &encodedResponse{body: buf.Bytes(), etag: fmt.Sprintf(`"%016x"`, hash.Sum64())}, nil
+}
+
+// gzipBody returns the compressed body, compressing it on first use
+func (e *encodedResponse) gzipBody() []byte {
+	e.gzipOnce.Do(func() {
+		if len(e.body) < minGzipSize {
+			return
+		}
+		var buf bytes.Buffer
+		zw, _ := gzip.NewWriterLevel(&buf, gzip.BestCompression)
+		zw.Write(e.body)
+		zw.Close()
+		e.gzipped = buf.Bytes()
+	})
+	return e.gzipped
+}
+
+// acceptsGzip reports whether the client listed gzip in Accept-Encoding
+func acceptsGzip(r *http.Request) bool {
+	for _, coding := range strings.Split(r.Header.Get("Accept-Encoding"), ",") {
+		if name, _, _ := strings.Cut(coding, ";"); strings.TrimSpace(name) == "gzip" {
+			return true
+		}
+	}
+	return false
+}
+
+// write sends the body, compressed if the client accepts gzip and it is
+// large enough to benefit. Each coding has its own ETag, the gzip one
+// suffixed with -gz, as a strong validator has to differ between them. A
+// client that already has the body in the coding it would be sent, going by
+// If-None-Match, gets a 304 instead.
+func (e *encodedResponse) write(w http.ResponseWriter, r *http.Request) {
+	body, etag := e.body, e.etag
+	gzipped := false
+	if len(e.body) >= minGzipSize {
+		// Set before the 304 too, so a cache never pairs codings up
+		w.Header().Add("Vary", "Accept-Encoding")
+		if acceptsGzip(r) {
+			gzipped = true
+			etag = strings.TrimSuffix(e.etag, `"`) + `-gz"`
+		}
+	}
+
+	w.Header().Set("ETag", etag)
+	if r.Header.Get("If-None-Match") == etag {
+		w.WriteHeader(http.StatusNotModified)
+		return
+	}
+
+	w.Header().Set("Content-Type", "application/json")
+	if gzipped {
+		w.Header().Set("Content-Encoding", "gzip")
+		body = e.gzipBody()
+	}
+	w.Header().Set("Content-Length", strconv.Itoa(len(body)))
+	w.Write(body)
+}
+
+// writeJSON sends value, the cache entry stored under cacheKey, as the
+// response. If the request has a fields= parameter only those fields are
+// sent. The encoded body for each field set is kept with the cache entry, so
+// it is built once per load and a cache hit only writes bytes. A value that
+// is not cached, passed with an empty cacheKey, is encoded every time.
+func writeJSON(w http.ResponseWriter, r *http.Request, cacheKey string, value interface{}) {
+	fields := parseFields(r.URL.Query().Get("fields"))
+	encode := func(value interface{}) (interface{}, error) {
+		return encodeResponse(r.URL.Path, value, fields)
+	}
+
+	var encoded interface{}
+	var ok bool
+	var err error
+	if cacheKey != "" {
+		encoded, ok, err = apiCache.Derived(cacheKey, "json|fields="+strings.Join(fields, ","), encode)
+	}
+	if !ok {
+		encoded, err = encode(value)
+	}
+	if err != nil {
+		log.Printf("Error encoding response: %v", err)
+		http.Error(w, err.Error(), http.StatusInternalServerError)
+		return
+	}
+	encoded.(*encodedResponse).write(w, r)
+}
@@ -0,0 +1,188 @@
+package handlers
+
+import (
+	"bytes"
+	"compress/gzip"
+	"encoding/json"
+	"io"
+	"net/http"
+	"net/http/httptest"
+	"strings"
+	"testing"
+)
+
+func TestWriteJSONCachesProjection(t *testing.T) {
+	apiCache.Clear()
+	value := map[string]interface{}{"price": "1.00", "symbol": "BTCUSD", "timestamp": "now"}
+	apiCache.Set("crypto:BTCUSD", value)
+
+	req := httptest.NewRequest("GET", "/api/crypto?symbol=BTCUSD&fields=price", nil)
+	rec := httptest.NewRecorder()
+	writeJSON(rec, req, "crypto:BTCUSD", value)
+
+	if body := rec.Body.String(); body != "{\"price\":\"1.00\"}\n" {
+		t.Errorf("Unexpected projected body %q", body)
+	}
+
+	// A hit writes the bytes encoded for the entry rather than encoding again
+	value["price"] = "2.00"
+	rec = httptest.NewRecorder()
+	writeJSON(rec, req, "crypto:BTCUSD", value)
+	if body := rec.Body.String(); body != "{\"price\":\"1.00\"}\n" {
+		t.Errorf("Expected the encoded projection to be reused, got %q", body)
+	}
+
+	// Storing a new value drops the encodings of the old one
+	value = map[string]interface{}{"price": "3.00", "symbol": "BTCUSD"}
+	apiCache.Set("crypto:BTCUSD", value)
+	rec = httptest.NewRecorder()
+	writeJSON(rec, req, "crypto:BTCUSD", value)
+	if body := rec.Body.String(); body != "{\"price\":\"3.00\"}\n" {
+		t.Errorf("Expected the new value to be encoded, got %q", body)
+	}
+}
+
+func TestWriteJSONETag(t *testing.T) {
+	apiCache.Clear()
+	value := map[string]interface{}{"price": "1.00"}
+	apiCache.Set("crypto:BTCUSD", value)
+
+	rec := httptest.NewRecorder()
+	writeJSON(rec, httptest.NewRequest("GET", "/api/crypto?symbol=BTCUSD", nil), "crypto:BTCUSD", value)
+	etag := rec.Header().Get("ETag")
+	if rec.Code != http.StatusOK || etag == "" {
+		t.Fatalf("Expected 200 with an ETag, got %d %q", rec.Code, etag)
+	}
+
+	req := httptest.NewRequest("GET", "/api/crypto?symbol=BTCUSD", nil)
+	req.Header.Set("If-None-Match", etag)
+	rec = httptest.NewRecorder()
+	writeJSON(rec, req, "crypto:BTCUSD", value)
+	if rec.Code != http.StatusNotModified || rec.Body.Len() != 0 {
+		t.Errorf("Expected 304 with no body, got %d with %q", rec.Code, rec.Body.String())
+	}
+
+	// New data is a new ETag
+	value = map[string]interface{}{"price": "2.00"}
+	apiCache.Set("crypto:BTCUSD", value)
+	rec = httptest.NewRecorder()
+	writeJSON(rec, req, "crypto:BTCUSD", value)
+	if rec.Code != http.StatusOK || rec.Header().Get("ETag") == etag {
+		t.Errorf("Expected 200 with a new ETag, got %d %q", rec.Code, rec.Header().Get("ETag"))
+	}
+}
+
+func TestWriteJSONGzip(t *testing.T) {
+	apiCache.Clear()
+	value := map[string]interface{}{"text": strings.Repeat("daysync ", 500)}
+	apiCache.Set("news:test", value)
+
+	req := httptest.NewRequest("GET", "/api/news", nil)
+	plain := httptest.NewRecorder()
+	writeJSON(plain, req, "news:test", value)
+	if plain.Header().Get("Content-Encoding") != "" {
+		t.Errorf("Expected no compression without Accept-Encoding")
+	}
+
+	req.Header.Set("Accept-Encoding", "deflate, gzip;q=0.9")
+	rec := httptest.NewRecorder()
+	writeJSON(rec, req, "news:test", value)
+	if rec.Header().Get("Content-Encoding") != "gzip" || rec.Body.Len() >= plain.Body.Len() {
+		t.Fatalf("Expected a smaller gzip body, got %q with %d bytes", rec.Header().Get("Content-Encoding"), rec.Body.Len())
+	}
+	zr, err := gzip.NewReader(rec.Body)
+	if err != nil {
+		t.Fatal(err)
+	}
+	body, _ := io.ReadAll(zr)
+	if !bytes.Equal(body, plain.Body.Bytes()) {
+		t.Errorf("Expected gzip body to decompress to the plain body")
+	}
+
+	// Each coding has its own validator, and only matches itself
+	etag := rec.Header().Get("ETag")
+	if etag == plain.Header().Get("ETag") || !strings.HasSuffix(etag, `-gz"`) {
+		t.Errorf("Expected a -gz ETag distinct from %s, got %s", plain.Header().Get("ETag"), etag)
+	}
+	req.Header.Set("If-None-Match", plain.Header().Get("ETag"))
+	rec = httptest.NewRecorder()
+	writeJSON(rec, req, "news:test", value)
+	if rec.Code != http.StatusOK {
+		t.Errorf("Expected the identity ETag not to match a gzip request, got %d", rec.Code)
+	}
+	req.Header.Set("If-None-Match", etag)
+	rec = httptest.NewRecorder()
+	writeJSON(rec, req, "news:test", value)
+	if rec.Code != http.StatusNotModified || rec.Header().Get("Vary") != "Accept-Encoding" {
+		t.Errorf("Expected 304 with Vary: Accept-Encoding, got %d %q", rec.Code, rec.Header().Get("Vary"))
+	}
+	req.Header.Del("If-None-Match")
+
+	// Small bodies are sent as is
+	small := map[string]interface{}{"price": "1.00"}
+	rec = httptest.NewRecorder()
+	writeJSON(rec, req, "", small)
+	if rec.Header().Get("Content-Encoding") != "" {
+		t.Errorf("Expected small body not to be compressed")
+	}
+}
+
+// discardWriter is a ResponseWriter that throws the body away, so benchmarks
+// measure the handler rather than the recorder
+type discardWriter struct {
+	header http.Header
+}
+
+func (d *discardWriter) Header() http.Header         { return d.header }
+func (d *discardWriter) Write(b []byte) (int, error) { return len(b), nil }
+func (d *discardWriter) WriteHeader(int)             {}
+
+// BenchmarkWriteJSONHit measures writing a cached response. Encode is the old
+// hit path, encoding the cached value on every request; Cached writes the
+// bytes kept with the cache entry.
+func BenchmarkWriteJSONHit(b *testing.B) {
+	useTestCalendars(b)
+	season, err := loadSeason("formula1-2025.json", "UTC")
+	if err != nil {
+		b.Fatal(err)
+	}
+	responses := []struct {
+		name     string
+		key      string
+		value    interface{}
+		encoding string
+	}{
+		{"quote", "crypto:BTCUSD", map[string]interface{}{"symbol": "BTCUSD", "price": "97000.12", "timestamp": 1700000000}, ""},
+		{"season", "formula1:season:UTC", season, ""},
+		{"season/gzip", "formula1:season:UTC", season, "gzip"},
+	}
+
+	for _, response := range responses {
+		response := response
+		apiCache.Set(response.key, response.value)
+		req := httptest.NewRequest("GET", "/api/test", nil)
+		req.Header.Set("Accept-Encoding", response.encoding)
+
+		b.Run(response.name+"/Encode", func(b *testing.B) {
+			if response.encoding != "" {
+				b.Skip("the old hit path never compressed")
+			}
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				w := &discardWriter{header: http.Header{}}
+				value, _ := apiCache.Get(response.key)
+				w.Header().Set("Content-Type", "application/json")
+				json.NewEncoder(w).Encode(value)
+			}
+		})
+
+		b.Run(response.name+"/Cached", func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				w := &discardWriter{header: http.Header{}}
+				value, _ := apiCache.Get(response.key)
+				writeJSON(w, req, response.key, value)
+			}
+		})
+	}
+}
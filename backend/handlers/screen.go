@@ -0,0 +1,215 @@
+package handlers
+
+import (
+	"encoding/json"
+	"errors"
+	"fmt"
+	"hash/fnv"
+	"log"
+	"net/http"
+	"strconv"
+	"strings"
+	"unicode"
+	"unicode/utf8"
+
+	"daysync/api/models"
+	"daysync/api/render"
+)
+
+// screenLayoutVersion is part of every screen ETag. Bump it when a layout or
+// the fonts change so devices fetch the new bitmaps.
+const screenLayoutVersion = "1"
+
+// newsPerPage is how many headlines a news screen shows
+const newsPerPage = 5
+
+// drawFunc draws a screen from its encoded display model
+type drawFunc func(r *http.Request, model []byte) (*render.Canvas, error)
+
+// writeScreen serves a screen as an RLE-compressed RGB565 bitmap (see
+// render.Encode). Bitmaps are cached under a hash of the display model they
+// were drawn from, which is also their ETag, so a device that already shows
+// a screen gets a 304 and the screen is only drawn again when its data
+// changes. If the data cannot be loaded the screen's error bitmap is sent
+// instead, since the device has no way to draw one itself.
+func writeScreen(w http.ResponseWriter, r *http.Request, title, feed string, load displayLoader, draw drawFunc) {
+	var model []byte
+	if load != nil {
+		body, err := load(r)
+		var se *statusError
+		if errors.As(err, &se) && se.status < 500 {
+			http.Error(w, se.msg, se.status)
+			return
+		}
+		if err != nil {
+			writeBitmap(w, render.Error(title, feed))
+			return
+		}
+		model = body.body
+	}
+
+	hash := fnv.New64a()
+	fmt.Fprintf(hash, "%s\n%s\n%s\n", screenLayoutVersion, r.URL.Path, r.URL.RawQuery)
+	hash.Write(model)
+	etag := fmt.Sprintf("%016x", hash.Sum64())
+
+	w.Header().Set("ETag", `"`+etag+`"`)
+	if r.Header.Get("If-None-Match") == `"`+etag+`"` {
+		w.WriteHeader(http.StatusNotModified)
+		return
+	}
+
+	// A bitmap never changes under its key, so it is stored without a loader:
+	// there is nothing to refresh, and it simply expires once unused
+	key := "screen:" + etag
+	if bitmap, exists := apiCache.Get(key); exists {
+		writeBitmapBytes(w, bitmap.([]byte))
+		return
+	}
+	canvas, err := draw(r, model)
+	var bitmap []byte
+	if err == nil {
+		bitmap, err = render.Encode(canvas)
+	}
+	if err != nil {
+		log.Printf("Error drawing %s screen: %v", r.URL.Path, err)
+		http.Error(w, err.Error(), http.StatusInternalServerError)
+		return
+	}
+	apiCache.Set(key, bitmap)
+	writeBitmapBytes(w, bitmap)
+}
+
+// writeBitmap encodes and sends a screen that is not cached
+func writeBitmap(w http.ResponseWriter, canvas *render.Canvas) {
+	bitmap, err := render.Encode(canvas)
+	if err != nil {
+		http.Error(w, err.Error(), http.StatusInternalServerError)
+		return
+	}
+	w.Header().Set("Cache-Control", "no-store")
+	writeBitmapBytes(w, bitmap)
+}
+
+func writeBitmapBytes(w http.ResponseWriter, bitmap []byte) {
+	w.Header().Set("Content-Type", "application/octet-stream")
+	w.Header().Set("Content-Length", strconv.Itoa(len(bitmap)))
+	w.Write(bitmap)
+}
+
+// screenLabels returns the labels= parameter, the names shown for each of
+// the symbols, falling back to the symbols themselves
+func screenLabels(r *http.Request, count int) []string {
+	symbols := parseSymbols(r.URL.Query().Get("symbols"))
+	labels := strings.Split(r.URL.Query().Get("labels"), ",")
+	out := make([]string, count)
+	for i := range out {
+		if i < len(labels) && labels[i] != "" {
+			out[i] = labels[i]
+		} else if i < len(symbols) {
+			out[i] = symbols[i]
+		}
+	}
+	return out
+}
+
+// capitalize upper-cases the first letter of s, whole even if it takes more
+// than one byte
+func capitalize(s string) string {
+	first, size := utf8.DecodeRuneInString(s)
+	if first == utf8.RuneError {
+		return s
+	}
+	return string(unicode.ToUpper(first)) + s[size:]
+}
+
+// GetWeatherScreen serves the weather screen bitmap for a location
+func GetWeatherScreen(w http.ResponseWriter, r *http.Request) {
+	location := r.URL.Query().Get("location")
+	title := "Weather"
+	if location != "" {
+		title = fmt.Sprintf("Weather (%s)", capitalize(location))
+	}
+	writeScreen(w, r, title, "weather", weatherDisplay, func(r *http.Request, model []byte) (*render.Canvas, error) {
+		var weather models.WeatherDisplay
+		if err := json.Unmarshal(model, &weather); err != nil {
+			return nil, err
+		}
+		return render.Weather(title, weather), nil
+	})
+}
+
+// GetMotoGPScreen serves the next MotoGP race screen bitmap
+func GetMotoGPScreen(w http.ResponseWriter, r *http.Request) {
+	writeRaceScreen(w, r, "motogp", motogpDisplay)
+}
+
+// GetFormula1Screen serves the next Formula 1 race screen bitmap
+func GetFormula1Screen(w http.ResponseWriter, r *http.Request) {
+	writeRaceScreen(w, r, "formula1", formula1Display)
+}
+
+func writeRaceScreen(w http.ResponseWriter, r *http.Request, prefix string, load displayLoader) {
+	name := series[prefix].name
+	title := name + " - Upcoming"
+	writeScreen(w, r, title, name, load, func(r *http.Request, model []byte) (*render.Canvas, error) {
+		var race models.RaceDisplay
+		if err := json.Unmarshal(model, &race); err != nil {
+			return nil, err
+		}
+		return render.Race(title, race), nil
+	})
+}
+
+// GetFinanceScreen serves the stocks screen bitmap for symbols=, named by
+// labels=
+func GetFinanceScreen(w http.ResponseWriter, r *http.Request) {
+	writeScreen(w, r, "Stocks", "finance", financeDisplay, func(r *http.Request, model []byte) (*render.Canvas, error) {
+		var quotes struct {
+			Quotes []*models.StockDisplay `json:"quotes"`
+		}
+		if err := json.Unmarshal(model, &quotes); err != nil {
+			return nil, err
+		}
+		return render.Finance(screenLabels(r, len(quotes.Quotes)), quotes.Quotes), nil
+	})
+}
+
+// GetCryptoScreen serves the crypto screen bitmap for symbols=, named by
+// labels=
+func GetCryptoScreen(w http.ResponseWriter, r *http.Request) {
+	writeScreen(w, r, "Crypto Prices", "crypto", cryptoDisplay, func(r *http.Request, model []byte) (*render.Canvas, error) {
+		var quotes struct {
+			Quotes []*models.CryptoDisplay `json:"quotes"`
+		}
+		if err := json.Unmarshal(model, &quotes); err != nil {
+			return nil, err
+		}
+		return render.Crypto(screenLabels(r, len(quotes.Quotes)), quotes.Quotes), nil
+	})
+}
+
+// GetNewsScreen serves one page of the news screen bitmap, page= counting
+// from 1
+func GetNewsScreen(w http.ResponseWriter, r *http.Request) {
+	page, err := strconv.Atoi(r.URL.Query().Get("page"))
+	if err != nil || page < 1 {
+		page = 1
+	}
+	writeScreen(w, r, "News", "News", newsDisplay, func(r *http.Request, model []byte) (*render.Canvas, error) {
+		var news models.NewsDisplay
+		if err := json.Unmarshal(model, &news); err != nil {
+			return nil, err
+		}
+		pages := (len(news.Headlines) + newsPerPage - 1) / newsPerPage
+		title := fmt.Sprintf("News (%d/%d)", page, max(pages, 1))
+		return render.News(title, news.Headlines, (page-1)*newsPerPage, page*newsPerPage), nil
+	})
+}
+
+// GetAboutScreen serves the about screen bitmap
+func GetAboutScreen(w http.ResponseWriter, r *http.Request) {
+	writeScreen(w, r, "About", "", nil, func(r *http.Request, model []byte) (*render.Canvas, error) {
+		return render.About(), nil
+	})
+}
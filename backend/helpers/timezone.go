@@ -2,6 +2,7 @@ package helpers
 
 import (
 	"fmt"
+	"sync"
 	"time"
 )
 
@@ -43,8 +44,16 @@ var timezoneMap = map[string]string{
 	"UTC": "UTC", // Coordinated Universal Time
 }
 
+// locations caches loaded time.Locations by abbreviation. LoadLocation reads
+// the zoneinfo database each time it is called, so each zone is loaded once.
+var locations sync.Map
+
 // GetLocationFromAbbreviation converts a timezone abbreviation to a time.Location
 func GetLocationFromAbbreviation(abbr string) (*time.Location, error) {
+	if loc, ok := locations.Load(abbr); ok {
+		return loc.(*time.Location), nil
+	}
+
 	ianaName, ok := timezoneMap[abbr]
 	if !ok {
 		return nil, fmt.Errorf("unsupported timezone abbreviation: %s", abbr)
@@ -55,5 +64,6 @@ func GetLocationFromAbbreviation(abbr string) (*time.Location, error) {
 		return nil, fmt.Errorf("error loading timezone: %v", err)
 	}
 
+	locations.Store(abbr, loc)
 	return loc, nil
 }
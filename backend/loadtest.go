@@ -0,0 +1,403 @@
+package main
+
+import (
+	"encoding/json"
+	"flag"
+	"fmt"
+	"io"
+	"log"
+	"math/rand"
+	"net/http"
+	"net/http/httptest"
+	"os"
+	"sort"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"daysync/api/handlers"
+	"daysync/api/models"
+	"daysync/api/services"
+)
+
+// Load test settings, used with -load-test
+var (
+	loadDevices      = flag.Int("load-devices", 500, "Number of simulated devices")
+	loadDuration     = flag.Duration("load-duration", time.Minute, "How long to run the load test")
+	loadHour         = flag.Duration("load-hour", 10*time.Second, "Real time standing in for one hour of device time; sets the refresh and cache intervals")
+	loadLocations    = flag.Int("load-locations", 1, "Number of distinct weather locations across the fleet")
+	loadDate         = flag.String("load-date", "2025-06-01", "Device date the load test starts at (YYYY-MM-DD), inside the bundled race calendars")
+	upstreamLatency  = flag.Duration("upstream-latency", 200*time.Millisecond, "Fake upstream response time")
+	upstreamFailures = flag.Float64("upstream-failure-rate", 0, "Fraction of fake upstream calls that fail with 503")
+)
+
+// deviceFeed is one request the firmware makes from check_and_refresh_data,
+// with the path and query it sends (see esp32/include/feeds.h) and how many
+// hours of device time it waits between fetches. A cursor feed sends the IDs
+// of the headlines it holds as since= and merges the delta it gets back.
+type deviceFeed struct {
+	name   string
+	path   string
+	hours  int
+	cursor bool
+}
+
+// deviceFeeds are the feeds of a device with every FEED_* switch on, in
+// fetch order. %s is the device's weather location.
+var deviceFeeds = []deviceFeed{
+	{"weather", "/api/display/weather?location=%s", 1, false},
+	// Calendars are stored on the device and checked daily with their ETag
+	{"motogp", "/api/motogp?fields=races.name,races.location,races.country,races.circuit,races.date,races.starts", 24, false},
+	{"f1", "/api/formula1?fields=races.name,races.location,races.country,races.circuit,races.date,races.starts", 24, false},
+	{"finance", "/api/display/finance?symbols=%5EGSPC,NDQ.AX,VAS.AX,VGS.AX", 1, false},
+	{"crypto", "/api/display/crypto?symbols=BTCUSD,ETHUSD,XRPUSD,DOGEUSD,BNBUSD", 1, false},
+	{"news", "/api/display/news?max=10&country=au", 1, true},
+}
+
+// setLoadTestKeys gives every upstream provider a key so the fetchers do not
+// refuse to run. It must be called before the config is loaded.
+func setLoadTestKeys() {
+	for _, key := range []string{"WEATHER_API_KEY", "API_NINJAS_KEY", "GNEWS_API_KEY"} {
+		if os.Getenv(key) == "" {
+			os.Setenv(key, "load-test")
+		}
+	}
+}
+
+// fakeUpstream answers like weatherapi.com, API Ninjas, GNews and Yahoo
+// Finance, using the canned responses of test mode. Every call takes
+// upstreamLatency and fails with the configured probability.
+type fakeUpstream struct {
+	calls    sync.Map // provider -> *int64
+	failures int64
+}
+
+func (f *fakeUpstream) count(provider string) {
+	n, _ := f.calls.LoadOrStore(provider, new(int64))
+	atomic.AddInt64(n.(*int64), 1)
+}
+
+func (f *fakeUpstream) total() (total int64, byProvider map[string]int64) {
+	byProvider = make(map[string]int64)
+	f.calls.Range(func(key, value interface{}) bool {
+		n := atomic.LoadInt64(value.(*int64))
+		byProvider[key.(string)] = n
+		total += n
+		return true
+	})
+	return total, byProvider
+}
+
+func (f *fakeUpstream) handle(provider string, respond func(r *http.Request) (interface{}, error)) http.HandlerFunc {
+	return func(w http.ResponseWriter, r *http.Request) {
+		f.count(provider)
+		time.Sleep(*upstreamLatency)
+		if rand.Float64() < *upstreamFailures {
+			atomic.AddInt64(&f.failures, 1)
+			http.Error(w, "fake upstream failure", http.StatusServiceUnavailable)
+			return
+		}
+
+		body, err := respond(r)
+		if err != nil {
+			http.Error(w, err.Error(), http.StatusInternalServerError)
+			return
+		}
+		w.Header().Set("Content-Type", "application/json")
+		json.NewEncoder(w).Encode(body)
+	}
+}
+
+func (f *fakeUpstream) handler() http.Handler {
+	mux := http.NewServeMux()
+	mux.HandleFunc("/weather", f.handle("weatherapi", func(r *http.Request) (interface{}, error) {
+		data, err := services.GetTestWeather(r.URL.Query().Get("q"))
+		if err != nil {
+			return nil, err
+		}
+		weather, _ := data.(map[string]interface{})
+		return map[string]interface{}{
+			"location": map[string]interface{}{
+				"name":      weather["location"],
+				"localtime": time.Now().Format("2006-01-02 15:04"),
+			},
+			"current": map[string]interface{}{
+				"temp_c":      weather["temperature"],
+				"wind_kph":    weather["wind_speed"],
+				"humidity":    weather["humidity"],
+				"feelslike_c": weather["temperature"],
+				"is_day":      1,
+				"condition":   map[string]interface{}{"text": weather["condition"], "code": 1003},
+			},
+		}, nil
+	}))
+	mux.HandleFunc("/crypto", f.handle("apininjas", func(r *http.Request) (interface{}, error) {
+		data, err := services.GetTestCryptoPrice(strings.TrimSuffix(r.URL.Query().Get("symbol"), "USD"))
+		if err != nil {
+			return nil, err
+		}
+		quote, _ := data.(map[string]interface{})
+		return map[string]interface{}{
+			"symbol":    r.URL.Query().Get("symbol"),
+			"price":     quote["price"],
+			"timestamp": time.Now().Unix(),
+		}, nil
+	}))
+	mux.HandleFunc("/news", f.handle("gnews", func(r *http.Request) (interface{}, error) {
+		q := r.URL.Query()
+		return services.GetTestNews(q.Get("category"), q.Get("lang"), q.Get("country"), q.Get("max"))
+	}))
+	mux.HandleFunc("/stock/", f.handle("yahoo", func(r *http.Request) (interface{}, error) {
+		meta, err := services.GetTestStockInfo(strings.TrimPrefix(r.URL.Path, "/stock/"))
+		if err != nil {
+			return nil, err
+		}
+		return map[string]interface{}{
+			"chart": map[string]interface{}{
+				"result": []interface{}{map[string]interface{}{"meta": meta}},
+			},
+		}, nil
+	}))
+	return mux
+}
+
+// loadResults collects the outcome of every device request
+type loadResults struct {
+	mu        sync.Mutex
+	latencies map[string][]time.Duration
+	errors    map[string]int
+}
+
+func (l *loadResults) record(feed string, d time.Duration, ok bool) {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+
+	l.latencies[feed] = append(l.latencies[feed], d)
+	if !ok {
+		l.errors[feed]++
+	}
+}
+
+// percentile returns the q quantile of sorted
+func percentile(sorted []time.Duration, q float64) time.Duration {
+	if len(sorted) == 0 {
+		return 0
+	}
+	return sorted[int(float64(len(sorted)-1)*q)]
+}
+
+// runDevice follows the firmware's refresh loop: fetch every feed at boot,
+// then refetch each one when its interval runs out, sending the ETag of the
+// last response so unchanged data comes back as a 304. A feed that fails is
+// retried after a minute of device time rather than an hour. Devices fetch
+// one feed at a time over a new connection, as HTTPClient does with HTTP/1.0.
+func runDevice(base string, location string, results *loadResults, stop <-chan struct{}) {
+	client := &http.Client{
+		Timeout:   15 * time.Second,
+		Transport: &http.Transport{DisableKeepAlives: true},
+	}
+	hour := *loadHour
+	retry := hour / 60
+	next := make([]time.Time, len(deviceFeeds))
+	etags := make([]string, len(deviceFeeds))
+	held := make([][]string, len(deviceFeeds))
+
+	// Devices are switched on at random points in the first hour
+	select {
+	case <-stop:
+		return
+	case <-time.After(time.Duration(rand.Int63n(int64(hour)))):
+	}
+
+	for {
+		now := time.Now()
+		wake := now.Add(hour)
+		for i, feed := range deviceFeeds {
+			if now.Before(next[i]) {
+				if next[i].Before(wake) {
+					wake = next[i]
+				}
+				continue
+			}
+
+			path := feed.path
+			if strings.Contains(path, "%s") {
+				path = fmt.Sprintf(path, location)
+			}
+			if feed.cursor {
+				path += "&since=" + strings.Join(held[i], ",")
+			}
+			start := time.Now()
+			ok := false
+			req, err := http.NewRequest("GET", base+path, nil)
+			if err == nil && etags[i] != "" {
+				req.Header.Set("If-None-Match", etags[i])
+			}
+			var resp *http.Response
+			if err == nil {
+				resp, err = client.Do(req)
+			}
+			if err == nil {
+				var body []byte
+				body, err = io.ReadAll(resp.Body)
+				resp.Body.Close()
+				ok = err == nil && (resp.StatusCode == http.StatusOK || resp.StatusCode == http.StatusNotModified)
+				if ok && resp.StatusCode == http.StatusOK {
+					etags[i] = resp.Header.Get("ETag")
+					if feed.cursor {
+						held[i], ok = mergeNewsDelta(held[i], body)
+					}
+				}
+			}
+			results.record(feed.name, time.Since(start), ok)
+
+			next[i] = time.Now().Add(time.Duration(feed.hours) * hour)
+			if !ok {
+				next[i] = time.Now().Add(retry)
+			}
+			if next[i].Before(wake) {
+				wake = next[i]
+			}
+		}
+
+		select {
+		case <-stop:
+			return
+		case <-time.After(time.Until(wake)):
+		}
+	}
+}
+
+// mergeNewsDelta applies a news delta to the IDs a device holds, as the
+// firmware's headline ring does
+func mergeNewsDelta(held []string, body []byte) ([]string, bool) {
+	var delta models.NewsDisplayDelta
+	if err := json.Unmarshal(body, &delta); err != nil {
+		return held, false
+	}
+	evict := make(map[string]bool, len(delta.Evict))
+	for _, id := range delta.Evict {
+		evict[id] = true
+	}
+	merged := make([]string, 0, len(held)+len(delta.Headlines))
+	for _, id := range held {
+		if !evict[id] {
+			merged = append(merged, id)
+		}
+	}
+	for _, headline := range delta.Headlines {
+		merged = append(merged, headline.ID)
+	}
+	// The ring keeps the newest ten
+	if len(merged) > 10 {
+		merged = merged[len(merged)-10:]
+	}
+	return merged, true
+}
+
+// scaleCache shrinks the configured cache intervals by the same factor as
+// device time, so cache expiry keeps its real ratio to device refreshes
+func scaleCache() {
+	scale := func(d time.Duration) time.Duration {
+		return time.Duration(float64(d) * float64(*loadHour) / float64(time.Hour))
+	}
+	opts := handlers.CacheOptions()
+	opts.Timeout = scale(opts.Timeout)
+	opts.StaleTimeout = scale(opts.StaleTimeout)
+	opts.RefreshInterval = scale(opts.RefreshInterval)
+	opts.SweepInterval = scale(opts.SweepInterval)
+	handlers.UseCache(opts)
+}
+
+// runLoadTest starts the fake upstream and the API, drives them with
+// -load-devices simulated devices for -load-duration and prints a report
+func runLoadTest() {
+	upstream := &fakeUpstream{}
+	upstreamServer := httptest.NewServer(upstream.handler())
+	defer upstreamServer.Close()
+
+	services.WeatherAPIURL = upstreamServer.URL + "/weather"
+	handlers.CryptoAPIURL = upstreamServer.URL + "/crypto"
+	handlers.NewsAPIURL = upstreamServer.URL + "/news"
+	handlers.StockAPIURL = upstreamServer.URL + "/stock"
+	scaleCache()
+
+	// Device time starts at -load-date and runs at one hour per -load-hour, so
+	// next race lookups find races and move on through the season
+	date, err := time.Parse("2006-01-02", *loadDate)
+	if err != nil {
+		log.Fatalf("Invalid -load-date %q: %v", *loadDate, err)
+	}
+	clockStart := time.Now()
+	handlers.SetClock(func() time.Time {
+		elapsed := time.Since(clockStart)
+		return date.Add(time.Duration(float64(elapsed) * float64(time.Hour) / float64(*loadHour)))
+	})
+
+	api := httptest.NewServer(newRouter())
+	defer api.Close()
+
+	fmt.Printf("Load test: %d devices for %v, one device hour = %v, upstream latency %v, failure rate %.0f%%\n",
+		*loadDevices, *loadDuration, *loadHour, *upstreamLatency, *upstreamFailures*100)
+	logOutput := log.Writer()
+	log.SetOutput(io.Discard)
+
+	results := &loadResults{latencies: make(map[string][]time.Duration), errors: make(map[string]int)}
+	stop := make(chan struct{})
+	var wg sync.WaitGroup
+	start := time.Now()
+	for i := 0; i < *loadDevices; i++ {
+		location := fmt.Sprintf("location-%d", i%*loadLocations)
+		if *loadLocations == 1 {
+			location = "adelaide"
+		}
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			runDevice(api.URL, location, results, stop)
+		}()
+	}
+	time.Sleep(*loadDuration)
+	close(stop)
+	wg.Wait()
+	elapsed := time.Since(start)
+	log.SetOutput(logOutput)
+
+	var all []time.Duration
+	requests, failed := 0, 0
+	fmt.Printf("\n%-8s %9s %7s %10s %10s %10s\n", "feed", "requests", "errors", "p50", "p99", "max")
+	for _, feed := range deviceFeeds {
+		latencies := results.latencies[feed.name]
+		sort.Slice(latencies, func(i, j int) bool { return latencies[i] < latencies[j] })
+		fmt.Printf("%-8s %9d %7d %10v %10v %10v\n", feed.name, len(latencies), results.errors[feed.name],
+			percentile(latencies, 0.5).Round(time.Microsecond), percentile(latencies, 0.99).Round(time.Microsecond),
+			percentile(latencies, 1).Round(time.Microsecond))
+		all = append(all, latencies...)
+		requests += len(latencies)
+		failed += results.errors[feed.name]
+	}
+	sort.Slice(all, func(i, j int) bool { return all[i] < all[j] })
+	fmt.Printf("%-8s %9d %7d %10v %10v %10v\n", "all", requests, failed,
+		percentile(all, 0.5).Round(time.Microsecond), percentile(all, 0.99).Round(time.Microsecond),
+		percentile(all, 1).Round(time.Microsecond))
+
+	upstreamCalls, byProvider := upstream.total()
+	fmt.Printf("\nThroughput: %.1f requests/s over %v\n", float64(requests)/elapsed.Seconds(), elapsed.Round(time.Millisecond))
+	fmt.Printf("Upstream calls: %d (%d failed)", upstreamCalls, atomic.LoadInt64(&upstream.failures))
+	providers := make([]string, 0, len(byProvider))
+	for provider := range byProvider {
+		providers = append(providers, provider)
+	}
+	sort.Strings(providers)
+	for _, provider := range providers {
+		fmt.Printf(", %s %d", provider, byProvider[provider])
+	}
+	fmt.Println()
+	if requests > 0 {
+		fmt.Printf("Upstream amplification: %.4f upstream calls per device request\n", float64(upstreamCalls)/float64(requests))
+	}
+	stats := handlers.CacheStats()
+	fmt.Printf("Cache: %d hits, %d stale hits, %d misses, %d background refreshes\n",
+		stats.Hits, stats.StaleHits, stats.Misses, stats.Refreshes)
+}
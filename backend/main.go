@@ -10,6 +10,7 @@ import (
 	"daysync/api/config"
 	"daysync/api/handlers"
 	"daysync/api/helpers"
+	"daysync/api/metrics"
 
 	"github.com/gorilla/mux"
 )
@@ -18,6 +19,7 @@ func main() {
 	// Parse command line flags
 	icsToJsonFlag := flag.String("ics-to-json", "", "Convert ICS file to JSON format")
 	testModeFlag := flag.Bool("test-mode", false, "Run in test mode (use dummy data)")
+	loadTestFlag := flag.Bool("load-test", false, "Run a simulated device fleet against a fake upstream and report the results")
 	flag.Parse()
 
 	// If --ics-to-json flag is provided, convert the file and exit
@@ -29,10 +31,16 @@ func main() {
 		os.Exit(0)
 	}
 
+	if *loadTestFlag {
+		// The fake upstream accepts any API key
+		setLoadTestKeys()
+	}
+
 	// Load configuration
 	if err := config.LoadConfig(); err != nil {
 		log.Fatalf("Error loading config: %v", err)
 	}
+	handlers.InitCache()
 
 	// Set test mode if flag is provided
 	if *testModeFlag {
@@ -40,8 +48,35 @@ func main() {
 		handlers.SetTestMode(true)
 	}
 
+	// Read the race calendars once up front rather than on the first requests
+	handlers.LoadCalendars()
+
+	if *loadTestFlag {
+		runLoadTest()
+		os.Exit(0)
+	}
+
+	// Server configuration
+	srv := &http.Server{
+		Handler:      newRouter(),
+		Addr:         "0.0.0.0:5173",
+		WriteTimeout: 15 * time.Second,
+		ReadTimeout:  15 * time.Second,
+	}
+
+	log.Println("Starting server on :5173")
+	log.Println("API documentation available at http://localhost:5173/docs")
+	log.Fatal(srv.ListenAndServe())
+}
+
+// newRouter sets up the API, metrics and documentation routes
+func newRouter() *mux.Router {
 	r := mux.NewRouter()
 
+	// Count and time every request, and log it at log_level debug
+	r.Use(metrics.Middleware(config.DebugLogging()))
+	r.HandleFunc("/metrics", metrics.Handler(handlers.CacheStats)).Methods("GET")
+
 	// API routes
 	api := r.PathPrefix("/api").Subrouter()
 	api.HandleFunc("/motogp", handlers.GetMotoGPSeason).Methods("GET")
@@ -53,6 +88,25 @@ func main() {
 	api.HandleFunc("/news", handlers.GetNews).Methods("GET")
 	api.HandleFunc("/finance", handlers.GetStockInfo).Methods("GET")
 
+	// Display models: each screen's strings and colours, formatted for the device
+	display := api.PathPrefix("/display").Subrouter()
+	display.HandleFunc("/weather", handlers.GetWeatherDisplay).Methods("GET")
+	display.HandleFunc("/motogp", handlers.GetMotoGPDisplay).Methods("GET")
+	display.HandleFunc("/formula1", handlers.GetFormula1Display).Methods("GET")
+	display.HandleFunc("/finance", handlers.GetFinanceDisplay).Methods("GET")
+	display.HandleFunc("/crypto", handlers.GetCryptoDisplay).Methods("GET")
+	display.HandleFunc("/news", handlers.GetNewsDisplay).Methods("GET")
+
+	// Screens drawn on the server, as RLE-compressed RGB565 bitmaps with ETags
+	screen := api.PathPrefix("/screen").Subrouter()
+	screen.HandleFunc("/weather", handlers.GetWeatherScreen).Methods("GET")
+	screen.HandleFunc("/motogp", handlers.GetMotoGPScreen).Methods("GET")
+	screen.HandleFunc("/formula1", handlers.GetFormula1Screen).Methods("GET")
+	screen.HandleFunc("/finance", handlers.GetFinanceScreen).Methods("GET")
+	screen.HandleFunc("/crypto", handlers.GetCryptoScreen).Methods("GET")
+	screen.HandleFunc("/news", handlers.GetNewsScreen).Methods("GET")
+	screen.HandleFunc("/about", handlers.GetAboutScreen).Methods("GET")
+
 	// Documentation routes
 	docs := r.PathPrefix("/docs").Subrouter()
 	docs.HandleFunc("/openapi.yaml", handlers.ServeOpenAPISpec).Methods("GET")
@@ -74,15 +128,5 @@ func main() {
 		})
 	})
 
-	// Server configuration
-	srv := &http.Server{
-		Handler:      r,
-		Addr:         "0.0.0.0:5173",
-		WriteTimeout: 15 * time.Second,
-		ReadTimeout:  15 * time.Second,
-	}
-
-	log.Println("Starting server on :5173")
-	log.Println("API documentation available at http://localhost:5173/docs")
-	log.Fatal(srv.ListenAndServe())
+	return r
 }
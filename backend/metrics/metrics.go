@@ -0,0 +1,269 @@
+package metrics
+
+import (
+	"bufio"
+	"fmt"
+	"io"
+	"log"
+	"net/http"
+	"sort"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"daysync/api/cache"
+
+	"github.com/gorilla/mux"
+)
+
+// latencyBuckets are the histogram upper bounds in seconds. They span cache
+// hits (well under a millisecond) to slow upstream calls.
+var latencyBuckets = [...]float64{0.001, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10}
+
+// histogram counts observations per latency bucket. The last count is for
+// observations above every bucket.
+type histogram struct {
+	counts [len(latencyBuckets) + 1]uint64
+	sum    float64
+	count  uint64
+}
+
+func (h *histogram) observe(d time.Duration) {
+	seconds := d.Seconds()
+	i := sort.SearchFloat64s(latencyBuckets[:], seconds)
+	h.counts[i]++
+	h.sum += seconds
+	h.count++
+}
+
+type requestKey struct {
+	route  string
+	method string
+	code   int
+}
+
+var (
+	mu               sync.Mutex
+	requests         = make(map[requestKey]uint64)
+	requestLatency   = make(map[string]*histogram)
+	upstreamLatency  = make(map[string]*histogram)
+	upstreamErrors   = make(map[string]uint64)
+	requestsInFlight atomic.Int64
+)
+
+// ObserveRequest records a request served on route
+func ObserveRequest(route, method string, code int, d time.Duration) {
+	mu.Lock()
+	defer mu.Unlock()
+
+	requests[requestKey{route, method, code}]++
+	h, exists := requestLatency[route]
+	if !exists {
+		h = &histogram{}
+		requestLatency[route] = h
+	}
+	h.observe(d)
+}
+
+// ObserveUpstream records a call to an upstream provider. A call counts as
+// an error if it failed or the provider answered with a non-2xx status.
+func ObserveUpstream(provider string, d time.Duration, failed bool) {
+	mu.Lock()
+	defer mu.Unlock()
+
+	h, exists := upstreamLatency[provider]
+	if !exists {
+		h = &histogram{}
+		upstreamLatency[provider] = h
+	}
+	h.observe(d)
+	if failed {
+		upstreamErrors[provider]++
+	} else if _, exists := upstreamErrors[provider]; !exists {
+		// Report zero errors rather than no series at all
+		upstreamErrors[provider] = 0
+	}
+}
+
+// statusRecorder remembers the status code a handler wrote
+type statusRecorder struct {
+	http.ResponseWriter
+	code int
+}
+
+func (s *statusRecorder) WriteHeader(code int) {
+	s.code = code
+	s.ResponseWriter.WriteHeader(code)
+}
+
+// Middleware records the count and latency of every request under its route
+// template, such as /api/weather, and tracks requests in flight. If
+// logRequests is set each request is also logged.
+func Middleware(logRequests bool) mux.MiddlewareFunc {
+	return func(next http.Handler) http.Handler {
+		return http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+			start := time.Now()
+			requestsInFlight.Add(1)
+			defer requestsInFlight.Add(-1)
+
+			rec := &statusRecorder{ResponseWriter: w, code: http.StatusOK}
+			next.ServeHTTP(rec, r)
+
+			route := "unmatched"
+			if current := mux.CurrentRoute(r); current != nil {
+				if template, err := current.GetPathTemplate(); err == nil {
+					route = template
+				}
+			}
+			elapsed := time.Since(start)
+			ObserveRequest(route, r.Method, rec.code, elapsed)
+			if logRequests {
+				log.Printf("%s %s from %s: %d in %v", r.Method, r.URL.RequestURI(), r.RemoteAddr, rec.code, elapsed)
+			}
+		})
+	}
+}
+
+// transport records the latency and outcome of every round trip to provider
+type transport struct {
+	provider string
+	base     http.RoundTripper
+}
+
+func (t *transport) RoundTrip(req *http.Request) (*http.Response, error) {
+	start := time.Now()
+	resp, err := t.base.RoundTrip(req)
+	ObserveUpstream(t.provider, time.Since(start), err != nil || resp.StatusCode < 200 || resp.StatusCode > 299)
+	return resp, err
+}
+
+// Transport returns an http.RoundTripper that records upstream metrics for
+// provider, for use as the Transport of the provider's http.Client
+func Transport(provider string) http.RoundTripper {
+	return &transport{provider: provider, base: http.DefaultTransport}
+}
+
+// labelEscaper escapes the characters the text exposition format does not
+// allow as is in label values
+var labelEscaper = strings.NewReplacer(`\`, `\\`, `"`, `\"`, "\n", `\n`)
+
+// escape quotes a label value for the text exposition format
+func escape(value string) string {
+	return `"` + labelEscaper.Replace(value) + `"`
+}
+
+func writeHeader(w io.Writer, name, kind, help string) {
+	fmt.Fprintf(w, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, kind)
+}
+
+func writeHistogram(w io.Writer, name, labels string, h *histogram) {
+	var cumulative uint64
+	for i, bound := range latencyBuckets {
+		cumulative += h.counts[i]
+		fmt.Fprintf(w, "%s_bucket{%s,le=\"%g\"} %d\n", name, labels, bound, cumulative)
+	}
+	fmt.Fprintf(w, "%s_bucket{%s,le=\"+Inf\"} %d\n", name, labels, h.count)
+	fmt.Fprintf(w, "%s_sum{%s} %g\n", name, labels, h.sum)
+	fmt.Fprintf(w, "%s_count{%s} %d\n", name, labels, h.count)
+}
+
+func sortedKeys(m map[string]*histogram) []string {
+	keys := make([]string, 0, len(m))
+	for key := range m {
+		keys = append(keys, key)
+	}
+	sort.Strings(keys)
+	return keys
+}
+
+// Write writes every metric in the Prometheus text exposition format, with
+// the response cache's counters taken from stats
+func Write(w io.Writer, stats cache.Stats) {
+	mu.Lock()
+	defer mu.Unlock()
+
+	writeHeader(w, "daysync_http_requests_total", "counter", "Requests served, by route, method and status code.")
+	keys := make([]requestKey, 0, len(requests))
+	for key := range requests {
+		keys = append(keys, key)
+	}
+	sort.Slice(keys, func(i, j int) bool {
+		if keys[i].route != keys[j].route {
+			return keys[i].route < keys[j].route
+		}
+		if keys[i].method != keys[j].method {
+			return keys[i].method < keys[j].method
+		}
+		return keys[i].code < keys[j].code
+	})
+	for _, key := range keys {
+		fmt.Fprintf(w, "daysync_http_requests_total{route=%s,method=%s,code=\"%d\"} %d\n",
+			escape(key.route), escape(key.method), key.code, requests[key])
+	}
+
+	writeHeader(w, "daysync_http_request_duration_seconds", "histogram", "Time to serve a request, by route.")
+	for _, route := range sortedKeys(requestLatency) {
+		writeHistogram(w, "daysync_http_request_duration_seconds", "route="+escape(route), requestLatency[route])
+	}
+
+	writeHeader(w, "daysync_http_requests_in_flight", "gauge", "Requests being served.")
+	fmt.Fprintf(w, "daysync_http_requests_in_flight %d\n", requestsInFlight.Load())
+
+	writeHeader(w, "daysync_upstream_request_duration_seconds", "histogram", "Time taken by upstream API calls, by provider.")
+	for _, provider := range sortedKeys(upstreamLatency) {
+		writeHistogram(w, "daysync_upstream_request_duration_seconds", "provider="+escape(provider), upstreamLatency[provider])
+	}
+
+	writeHeader(w, "daysync_upstream_errors_total", "counter", "Upstream API calls that failed or returned a non-2xx status, by provider.")
+	providers := make([]string, 0, len(upstreamErrors))
+	for provider := range upstreamErrors {
+		providers = append(providers, provider)
+	}
+	sort.Strings(providers)
+	for _, provider := range providers {
+		fmt.Fprintf(w, "daysync_upstream_errors_total{provider=%s} %d\n", escape(provider), upstreamErrors[provider])
+	}
+
+	counters := []struct {
+		name, help string
+		value      uint64
+	}{
+		{"daysync_cache_hits_total", "Cache reads served a fresh value.", stats.Hits},
+		{"daysync_cache_stale_hits_total", "Cache reads served a stale value while it was refreshed.", stats.StaleHits},
+		{"daysync_cache_misses_total", "Cache reads that found nothing usable.", stats.Misses},
+		{"daysync_cache_refreshes_total", "Background cache refreshes started.", stats.Refreshes},
+		{"daysync_cache_refresh_errors_total", "Background cache refreshes that failed.", stats.RefreshErrors},
+		{"daysync_cache_evictions_total", "Cache entries evicted to stay within the limits.", stats.Evictions},
+		{"daysync_cache_expirations_total", "Expired cache entries removed.", stats.Expirations},
+	}
+	for _, counter := range counters {
+		writeHeader(w, counter.name, "counter", counter.help)
+		fmt.Fprintf(w, "%s %d\n", counter.name, counter.value)
+	}
+	writeHeader(w, "daysync_cache_entries", "gauge", "Entries in the cache.")
+	fmt.Fprintf(w, "daysync_cache_entries %d\n", stats.Entries)
+	writeHeader(w, "daysync_cache_bytes", "gauge", "Approximate size of the cache entries.")
+	fmt.Fprintf(w, "daysync_cache_bytes %d\n", stats.Bytes)
+}
+
+// Handler serves the metrics, reading the cache counters from cacheStats
+func Handler(cacheStats func() cache.Stats) http.HandlerFunc {
+	return func(w http.ResponseWriter, r *http.Request) {
+		w.Header().Set("Content-Type", "text/plain; version=0.0.4; charset=utf-8")
+		buf := bufio.NewWriter(w)
+		Write(buf, cacheStats())
+		buf.Flush()
+	}
+}
+
+// reset clears every metric, for tests
+func reset() {
+	mu.Lock()
+	defer mu.Unlock()
+
+	requests = make(map[requestKey]uint64)
+	requestLatency = make(map[string]*histogram)
+	upstreamLatency = make(map[string]*histogram)
+	upstreamErrors = make(map[string]uint64)
+}
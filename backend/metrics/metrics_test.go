@@ -0,0 +1,80 @@
+package metrics
+
+import (
+	"bytes"
+	"net/http"
+	"net/http/httptest"
+	"strings"
+	"testing"
+	"time"
+
+	"daysync/api/cache"
+)
+
+func TestWriteExposition(t *testing.T) {
+	reset()
+	ObserveRequest("/api/weather", "GET", 200, 2*time.Millisecond)
+	ObserveRequest("/api/weather", "GET", 200, 300*time.Millisecond)
+	ObserveRequest("/api/weather", "GET", 400, time.Millisecond)
+	ObserveUpstream("weatherapi", 120*time.Millisecond, false)
+
+	var buf bytes.Buffer
+	Write(&buf, cache.Stats{Hits: 5, StaleHits: 2, Misses: 1, Entries: 3})
+	out := buf.String()
+
+	for _, line := range []string{
+		"# TYPE daysync_http_requests_total counter",
+		`daysync_http_requests_total{route="/api/weather",method="GET",code="200"} 2`,
+		`daysync_http_requests_total{route="/api/weather",method="GET",code="400"} 1`,
+		`daysync_http_request_duration_seconds_bucket{route="/api/weather",le="0.001"} 1`,
+		`daysync_http_request_duration_seconds_bucket{route="/api/weather",le="0.005"} 2`,
+		`daysync_http_request_duration_seconds_bucket{route="/api/weather",le="0.25"} 2`,
+		`daysync_http_request_duration_seconds_bucket{route="/api/weather",le="0.5"} 3`,
+		`daysync_http_request_duration_seconds_bucket{route="/api/weather",le="+Inf"} 3`,
+		`daysync_http_request_duration_seconds_count{route="/api/weather"} 3`,
+		`daysync_upstream_request_duration_seconds_count{provider="weatherapi"} 1`,
+		`daysync_upstream_errors_total{provider="weatherapi"} 0`,
+		"daysync_http_requests_in_flight 0",
+		"daysync_cache_hits_total 5",
+		"daysync_cache_stale_hits_total 2",
+		"daysync_cache_misses_total 1",
+		"daysync_cache_entries 3",
+	} {
+		if !strings.Contains(out, line+"\n") {
+			t.Errorf("Expected line %q in:\n%s", line, out)
+		}
+	}
+}
+
+func TestMiddlewareAndTransport(t *testing.T) {
+	reset()
+	upstream := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		http.Error(w, "down", http.StatusBadGateway)
+	}))
+	defer upstream.Close()
+
+	handler := Middleware(false)(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		if n := requestsInFlight.Load(); n != 1 {
+			t.Errorf("Expected 1 request in flight, got %d", n)
+		}
+		client := &http.Client{Transport: Transport("flaky")}
+		if resp, err := client.Get(upstream.URL); err == nil {
+			resp.Body.Close()
+		}
+		w.WriteHeader(http.StatusServiceUnavailable)
+	}))
+	handler.ServeHTTP(httptest.NewRecorder(), httptest.NewRequest("GET", "/api/test", nil))
+
+	var buf bytes.Buffer
+	Write(&buf, cache.Stats{})
+	out := buf.String()
+	for _, line := range []string{
+		`daysync_http_requests_total{route="unmatched",method="GET",code="503"} 1`,
+		`daysync_upstream_errors_total{provider="flaky"} 1`,
+		"daysync_http_requests_in_flight 0",
+	} {
+		if !strings.Contains(out, line+"\n") {
+			t.Errorf("Expected line %q in:\n%s", line, out)
+		}
+	}
+}
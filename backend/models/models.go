@@ -9,6 +9,15 @@ type Sessions struct {
 	Race   string `json:"race"`
 }
 
+// SessionStarts are session start times as Unix seconds, for clients that
+// count down to them. Zero if a session is missing.
+type SessionStarts struct {
+	Q1     int64 `json:"q1,omitempty"`
+	Q2     int64 `json:"q2,omitempty"`
+	Sprint int64 `json:"sprint,omitempty"`
+	Race   int64 `json:"race,omitempty"`
+}
+
 type Race struct {
 	Round    int      `json:"round"`
 	Name     string   `json:"name"`
@@ -17,6 +26,9 @@ type Race struct {
 	Circuit  string   `json:"circuit"`
 	Date     string   `json:"date"`
 	Sessions Sessions `json:"sessions"`
+	// Starts is filled in from Sessions when a race is served, calendar
+	// files leave it out
+	Starts *SessionStarts `json:"starts,omitempty"`
 }
 
 type Calendar struct {
@@ -34,6 +46,9 @@ type Weather struct {
 	Humidity      float64   `json:"humidity"`
 	FeelsLike     float64   `json:"feels_like"`
 	UVIndex       float64   `json:"uv_index"`
+	Condition     string    `json:"condition"`
+	ConditionCode int       `json:"condition_code"` // WMO 4677 weather code, -1 if not known
+	IsDay         bool      `json:"is_day"`
 	UpdatedAt     time.Time `json:"updated_at"`
 }
 
@@ -56,3 +71,71 @@ type NewsItem struct {
 type NewsResponse struct {
 	Items []NewsItem `json:"items"`
 }
+
+// NewsUpdate is what changed in the headlines since a client's cursor: the
+// articles it does not have, as GNews sends them plus an "id", and the IDs of
+// those it should drop
+type NewsUpdate struct {
+	Articles []map[string]interface{} `json:"articles"`
+	Evict    []string                 `json:"evict"`
+}
+
+// Display models are what a device screen shows, formatted by the server.
+// Colours are RGB hex, as lv_color_hex() takes them.
+
+type WeatherDisplay struct {
+	Date        string `json:"date"`
+	Temperature string `json:"temperature"`
+	Humidity    string `json:"humidity"`
+	Details     string `json:"details"`
+	Updated     string `json:"updated"`
+	Code        int    `json:"code"` // WMO 4677 weather code, -1 if not known
+	Day         bool   `json:"day"`  // daytime, for a sun or moon icon
+}
+
+type RaceDisplay struct {
+	Name     string   `json:"name"`
+	Place    string   `json:"place"`
+	Circuit  string   `json:"circuit"`
+	Date     string   `json:"date"`
+	Sessions []string `json:"sessions"`
+	// SessionTimes are the start times of Sessions as Unix seconds, 0 if
+	// not known
+	SessionTimes []int64 `json:"session_times"`
+}
+
+// PricePoint is a price in fixed point, Point * 10^Exponent, for clients that
+// keep a price history without floating point maths
+type PricePoint struct {
+	Point    int32 `json:"point"`
+	Exponent int   `json:"exponent"`
+}
+
+type StockDisplay struct {
+	Range  string `json:"range"`
+	Change string `json:"change"`
+	Color  string `json:"color"`
+	PricePoint
+}
+
+type CryptoDisplay struct {
+	Headline string `json:"headline"`
+	Price    string `json:"price"`
+	PricePoint
+}
+
+type NewsDisplay struct {
+	Headlines []string `json:"headlines"`
+}
+
+type NewsHeadline struct {
+	ID    string `json:"id"`
+	Title string `json:"title"`
+}
+
+// NewsDisplayDelta is the news display model as a delta. Headlines are new,
+// top story first, and not numbered.
+type NewsDisplayDelta struct {
+	Headlines []NewsHeadline `json:"headlines"`
+	Evict     []string       `json:"evict"`
+}
@@ -0,0 +1,923 @@
+// Code generated by scripts/gen_font.py from DejaVuSans.ttf. DO NOT EDIT.
+
+package render
+
+// Sans12 is DejaVu Sans at 12 pixels, the size of the firmware's FONT_12
+var Sans12 = &Face{
+	Height: 14,
+	Ascent: 11,
+	glyphs: map[rune]glyph{
+		' ':  {4, 0, 0, 0, 0, ""},
+		'!':  {5, 1, -9, 2, 9, "3b4f4f4f4f1f04284f"},
+		'"':  {6, 1, -9, 4, 4, "8383b4b4b4b46262"},
+		'#':  {10, 0, -9, 10, 9, "00006216000000e059000246c4984106bddbfbb3000a41d000044e47b420089d8c984000780c200000a41d0000"},
+		'$':  {8, 0, -10, 7, 12, "00000000008000018db800b882600f1800009db510003bbe3000808906080a709edd9100080000006000"},
+		'%':  {11, 0, -9, 11, 10, "08ca1004a003c07800c2004804b0880003c0782c000007ba1a438700000491d4970000c14b04b0008704b05a002b000a9c300220000310"},
+		'&':  {9, 0, -9, 9, 10, "006cea00002f40500003e00000000d900000089c900662f11c90a54f001cad01e6004fa003dccd6c8000320000"},
+		'\'': {3, 1, -9, 2, 4, "83b4b462"},
+		'(':  {5, 1, -10, 3, 12, "0000862e0780b50f40f40d409705b00d2034"},
+		')':  {5, 0, -10, 4, 12, "00000b4004b000d300a70089008a008800b501e108800710"},
+		'*':  {6, 0, -9, 6, 6, "00440057447505bb5028aa82424424002200"},
+		'+':  {10, 1, -8, 8, 8, "000440000008800000088000344994438bbddbb8000880000008800000088000"},
+		',':  {4, 0, -2, 3, 4, "0460890d2060"},
+		'-':  {4, 0, -4, 4, 2, "6bb82443"},
+		'.':  {4, 1, -2, 2, 2, "64b8"},
+		'/':  {4, 0, -9, 5, 11, "001a0006900096000e1005a00087000d2003c00088000c300000000"},
+		'0':  {8, 0, -9, 7, 10, "008dc5008b14e40e400993f0007b4f0004b4f0006b0f3008a0a801d602ccd800003100"},
+		'1':  {8, 1, -9, 6, 9, "58b60088a8000088000088000088000088000088000088008ffff8"},
+		'2':  {8, 0, -9, 7, 9, "08bfb5009417f200000c600001e30000a900009a00009c10009c10000fffff8"},
+		'3':  {8, 0, -9, 7, 10, "08bfb6005305e400000b800246d2006bf8000001c7000008b02001c70edbf900024000"},
+		'4':  {8, 0, -9, 7, 9, "0001a800008db0004b8b001d28b008808b04c008b08ffffff00008b000008b0"},
+		'5':  {8, 0, -9, 7, 10, "08bbbb00b944400b800000bdb93006448e200000b8000009802003e60edcf800024000"},
+		'6':  {8, 0, -9, 7, 10, "005bfb205e50420c600000f5ab704fc45d82f5006b0f4005c09a00a901ccdb10002200"},
+		'7':  {8, 0, -9, 7, 9, "0bbbbb604444e500005e00000a800001f200007c00000d600003e1000099000"},
+		'8':  {8, 0, -9, 7, 10, "03aec800b912d70f4008808913d402dde900e600a84f0007b1f400aa06ebdc20004200"},
+		'9':  {8, 0, -9, 7, 10, "02aeb500d804e24f000a84f0009b0e702eb03dfdab000009802004e20adce500023000"},
+		':':  {4, 1, -7, 2, 7, "238b230000468b"},
+		';':  {4, 0, -7, 3, 9, "02308b0230000000460890d2060"},
+		'<':  {10, 1, -7, 8, 7, "000002890016cd835ae950009f720000028dc710000049e800000004"},
+		'=':  {10, 1, -6, 8, 4, "688888866888888600000000bffffffb"},
+		'>':  {10, 1, -7, 8, 7, "9820000038dc710000049ea5000027f9016cd8308e95000041000000"},
+		'?':  {6, 0, -9, 6, 9, "18cd803822d70000b80006c1005d1000a80000860000640000b800"},
+		'@':  {12, 0, -9, 12, 12, "000037840000003ba888c50002d300001c4009405ba662d01c03d22d80b24908800880b33b07800881d00d01d77dbb5008802862720000b8100183000008dbbd8100000000000000"},
+		'A':  {8, 0, -9, 9, 9, "0008a0000001fd4000007a8900000c62e10003e00b60008b448c000ebbbbf206d0000980a800005d0"},
+		'B':  {8, 1, -9, 7, 9, "8bbb810b744ac0b4004f0b7449b0bcbbe50b4003f2b4000d6b4004f3bfffd60"},
+		'C':  {8, 0, -9, 8, 10, "004aeda405e6116a0e6000004f0000004f0000004f0000001f40000008c20027008ecce700003300"},
+		'D':  {9, 1, -9, 8, 9, "8bbb8400b7448e80b40004f2b40000c7b40000b8b40000b8b40002f3b4004cb0bfffc800"},
+		'E':  {8, 1, -9, 6, 9, "8bbbb8b74443b40000b74442bcbbb6b40000b40000b40000bffffb"},
+		'F':  {7, 1, -9, 6, 9, "8bbbb3b74441b40000b74430bcbb80b40000b40000b40000b40000"},
+		'G':  {9, 0, -9, 9, 10, "004adeb6005e6115b00e60000004f00000004f00068824f00068d41f40000b408c2000c4008ecbf91000033000"},
+		'H':  {9, 1, -9, 7, 9, "8300038b40004bb40004bb74447bbcbbbcbb40004bb40004bb40004bb40004b"},
+		'I':  {4, 1, -9, 2, 9, "83b4b4b4b4b4b4b4b4"},
+		'J':  {4, -1, -9, 4, 12, "008300b400b400b400b400b400b400b400b400e44bc04510"},
+		'K':  {8, 1, -9, 8, 9, "83001a60b403e700b43e6000b7e60000beb00000b5c90000b41c9000b401c900b4001c90"},
+		'L':  {7, 1, -9, 6, 9, "830000b40000b40000b40000b40000b40000b40000b40000bffff8"},
+		'M':  {10, 1, -9, 9, 9, "8b10008b3bd6001ef4b7c0079f4b4d20c3f4b4783d0f4b42d870f4b40af20f4b402300f4b400000f4"},
+		'N':  {9, 1, -9, 7, 9, "8a00038be7004bb8e104bb4b804bb43e14bb40984bb402f6bb4009dbb4002eb"},
+		'O':  {9, 0, -9, 9, 10, "004aec81006e602ac00e60001d64f000008a4f000008b4f000008b1f40000c708c2008e1008fbdb30000041000"},
+		'P':  {7, 1, -9, 6, 9, "8bbb70b745e8b4008bb4008bb988f5b98820b40000b40000b40000"},
+		'Q':  {9, 0, -9, 9, 11, "004aec81006e602ac00e60001d64f000008a4f000008b4f000008b1f40000c708c2008e1008fbdc30000047d10000000650"},
+		'R':  {8, 1, -9, 7, 9, "8bbb700b745d80b4008b0b4008a0bcbcd30b748e30b4008b0b4001e4b40008b"},
+		'S':  {8, 0, -9, 7, 10, "03aedb40e711554f000001e8300004cff9100005ca000005f240009c3cebdd30014200"},
+		'T':  {7, -1, -9, 9, 9, "0bbbbbbb30444f74410000f40000000f40000000f40000000f40000000f40000000f40000000f4000"},
+		'U':  {9, 1, -9, 7, 10, "b300068f40008bf40008bf40008bf40008bf40008be50008a9a001d61bebe800014000"},
+		'V':  {8, 0, -9, 9, 9, "8600003a07c00009901f3000e40098006d0005e00a80000d52f200008a7a000002fd6000000be0000"},
+		'W':  {12, 0, -9, 12, 9, "6800098000955d001ee001f31f205ac305e00c60878608a00890c3590c6005d1e01d0f2001f7a00c6d0000cd7008d900008f3005f600"},
+		'X':  {8, 0, -9, 8, 9, "1a30009507c007c000b83e30002ec800000bf000005eb80001e52e300aa007c05e1000b8"},
+		'Y':  {7, -1, -9, 9, 9, "0860002b103e200b80008b07c00000c8e3000003f80000000f40000000f40000000f40000000f4000"},
+		'Z':  {8, 0, -9, 8, 9, "3bbbbbb6144447f400001d700000b9000008c100006e200003e400001e6000008ffffffb"},
+		'[':  {5, 1, -10, 3, 12, "000fb6f00f00f00f00f00f00f00f00f42884"},
+		'\\': {4, 0, -9, 5, 11, "a1000960005a0000f0000a5000690001e0000c3000780002d000000"},
+		']':  {5, 1, -10, 3, 12, "0008db08b08b08b08b08b08b08b08b39b686"},
+		'^':  {10, 1, -9, 8, 4, "001aa10001c99c10099008c136000055"},
+		'_':  {6, -1, 1, 8, 2, "000000000bbbbbb0"},
+		'`':  {6, 0, -10, 4, 3, "053002d10035"},
+		'a':  {7, 0, -7, 7, 8, "059b82007448d000034d408dbbe43d100d44d004f40bdbbb40022000"},
+		'b':  {8, 1, -10, 6, 11, "000000f40000f40000f69b60fc55d5f6005cf4004ff4004efa00a9f9ccc1001300"},
+		'c':  {7, 0, -7, 6, 8, "007bb60ab4463f10004b00004d00001e600103dcba000320"},
+		'd':  {8, 0, -10, 7, 11, "000000000000880000088018b7880b947e83e000c84b000884c000981e401e806ebca80014000"},
+		'e':  {7, 0, -7, 7, 8, "007ba4009a45e43e000794ebbbcb4d000001e6000203dcbe60002300"},
+		'f':  {4, 0, -10, 5, 10, "0000005db60a8006db823c9410b8000b8000b8000b8000b800"},
+		'g':  {8, 0, -7, 7, 10, "018b7440c947e83e000a84b000884d000980e603e803dfb8800000b60688ac10278610"},
+		'h':  {8, 1, -10, 6, 10, "000000f40000f40000f59b60fb55e4f50088f40088f40088f40088f40088"},
+		'i':  {3, 1, -10, 2, 10, "00b43162b4b4b4b4b4b4"},
+		'j':  {3, -1, -10, 4, 13, "000000b40031006200b400b400b400b400b400b400d428e02820"},
+		'k':  {7, 1, -10, 6, 10, "000000f40000f40000f40073f41c90f6c600ff9000f7e600f43e60f403d6"},
+		'l':  {3, 1, -10, 2, 10, "00b4b4b4b4b4b4b4b4b4"},
+		'm':  {12, 1, -7, 10, 7, "839b508b80fb55f964d6f500b8008af400b8008bf400b8008bf400b8008bf400b8008b"},
+		'n':  {8, 1, -7, 6, 7, "839b60fb55e4f50088f40088f40088f40088f40088"},
+		'o':  {7, 0, -7, 7, 8, "018b9300ba47e23f100984b0008b4d000891e401d606ebe800004100"},
+		'p':  {8, 1, -7, 6, 10, "849b60fc55d5f6005cf4004ff4004efa00a9f9ccc1f41300f40000820000"},
+		'q':  {8, 0, -7, 7, 10, "018b7440b947e83e000c84b000884c000981e401e806ebca8001408800000880000044"},
+		'r':  {5, 1, -7, 4, 7, "839bfd55f500f400f400f400f400"},
+		's':  {6, 0, -7, 6, 8, "05ab923e54524d100009fb700015c81100893fbbd3003300"},
+		't':  {5, 0, -9, 5, 9, "082000f4006f9843f7420f4000f4000f4000c50006ef8"},
+		'u':  {8, 1, -7, 6, 8, "800044f00088f00088f00088f10088d501d85fbc98013000"},
+		'v':  {7, 0, -7, 7, 7, "45000454d000c60d502e0089089002e1d3000bad00006f700"},
+		'w':  {10, 0, -7, 10, 7, "46006500723d00ec01f10e24ad15b00a68796880079c259c4003ed01df0000e900cb00"},
+		'x':  {7, 0, -7, 7, 7, "181007309908c001c8e20005f70000ccc1008b0a905e101d5"},
+		'y':  {7, 0, -7, 7, 10, "45000453d000c50c503d006a098001e3e20008ca00002f500004d00008c80000860000"},
+		'z':  {6, 0, -7, 6, 7, "2888861444c90007c1006e1003d3002e50008ebbb8"},
+		'{':  {8, 1, -10, 6, 12, "000000005db300a80000b80000b80001d3006dc00000c50000b80000b800009800003cf4"},
+		'|':  {4, 1, -10, 2, 13, "22888888888888888888888866"},
+		'}':  {8, 1, -10, 6, 12, "0000006cd10000c40000b40000b400009800004ec300a80000b40000b40000d4008fa000"},
+		'~':  {10, 1, -5, 8, 3, "179720169858ece610000000"},
+		'°':  {6, 1, -9, 4, 4, "3bb3b11bb11b3aa3"},
+		'À':  {8, 0, -12, 9, 12, "001300000000c400000001700000008a0000001fd4000007a8900000c62e10003e00b60008b448c000ebbbbf206d0000980a800005d0"},
+		'Á':  {8, 0, -12, 9, 12, "0000220000002c10000005300000008a0000001fd4000007a8900000c62e10003e00b60008b448c000ebbbbf206d0000980a800005d0"},
+		'Â':  {8, 0, -12, 9, 12, "000230000001bb30000053160000008a0000001fd4000007a8900000c62e10003e00b60008b448c000ebbbbf206d0000980a800005d0"},
+		'Ã':  {8, 0, -12, 9, 12, "000000000008b9c0000030220000008a0000001fd4000007a8900000c62e10003e00b60008b448c000ebbbbf206d0000980a800005d0"},
+		'Ä':  {8, 0, -11, 9, 11, "00b84b0000032130000008a0000001fd4000007a8900000c62e10003e00b60008b448c000ebbbbf206d0000980a800005d0"},
+		'Å':  {8, 0, -12, 9, 12, "000010000003ba500000840b000003cc5000001fd4000007a8900000c62e10003e00c60008b448c000ebbbbf206d0000980a800005d0"},
+		'Æ':  {12, 0, -9, 11, 9, "0005bbbbbb8000c8c94443004e0b8000000980b9444301f20bdbbb808c44c800000dcbbe800006d000b80000b7000bfffff"},
+		'Ç':  {8, 0, -9, 8, 12, "004aeda405e6116a0e6000004f0000004f0000004f0000001f40000008c20027008ecce700004a0000048d0000024200"},
+		'È':  {8, 1, -12, 6, 12, "02200001c2000035008bbbb8b74443b40000b74442bcbbb6b40000b40000b40000bffffb"},
+		'É':  {8, 1, -12, 6, 12, "000310003c000061008bbbb8b74443b40000b74442bcbbb6b40000b40000b40000bffffb"},
+		'Ê':  {8, 1, -12, 6, 12, "00320003bb100613508bbbb8b74443b40000b74442bcbbb6b40000b40000b40000bffffb"},
+		'Ë':  {8, 1, -11, 6, 11, "0b88b00322308bbbb8b74443b40000b74442bcbbb6b40000b40000b40000bffffb"},
+		'Ì':  {4, 0, -12, 3, 12, "3203c10330830b40b40b40b40b40b40b40b4"},
+		'Í':  {4, 0, -12, 4, 12, "00410690070008300b400b400b400b400b400b400b400b40"},
+		'Î':  {4, -1, -12, 5, 12, "0031005ab1060330083000b4000b4000b4000b4000b4000b4000b4000b40"},
+		'Ï':  {4, 0, -11, 4, 11, "f4b8413208300b400b400b400b400b400b400b400b40"},
+		'Ð':  {9, 0, -9, 9, 9, "08bbb84000b9447e900b80003f30b80000b8ffff800b80b80000b80b80001e50b8003cc00bfffc810"},
+		'Ñ':  {9, 1, -12, 7, 12, "000000004caa4002113008a00038be7004bb8e104bb4b804bb43e14bb40984bb402f6bb4009dbb4002eb"},
+		'Ò':  {9, 0, -12, 9, 13, "0003200000003b1000000043000004aec81006e602ac00e60001d64f000008a4f000008b4f000008b1f40000c708c2008e1008fbdb30000041000"},
+		'Ó':  {9, 0, -12, 9, 13, "000004100000079000000070000004aec81006e602ac00e60001d64f000008a4f000008b4f000008b1f40000c708c2008e1008fbdb30000041000"},
+		'Ô':  {9, 0, -12, 9, 13, "0000310000006ab000000603300004aec81006e602ac00e60001d64f000008a4f000008b4f000008b1f40000c708c2008e1008fbdb30000041000"},
+		'Õ':  {9, 0, -12, 9, 13, "000000000001cb8800001204000004aec81006e602ac00e60001d64f000008a4f000008b4f000008b1f40000c708c2008e1008fbdb30000041000"},
+		'Ö':  {9, 0, -11, 9, 12, "000f4b800000413200004aec81006e602ac00e60001d64f000008a4f000008b4f000008b1f40000c708c2008e1008fbdb30000041000"},
+		'×':  {10, 1, -8, 8, 8, "000000002c1001c206c11c60006cc600001dd10001c66c101c6006c115000051"},
+		'Ø':  {9, 0, -10, 9, 11, "000000000004aec86906e603cf10e6001dd64f001c38a4f009608b4f088008b1f89000c709f3008e13c8ebdb30120041000"},
+		'Ù':  {9, 1, -12, 7, 13, "004000000880000007100b300068f40008bf40008bf40008bf40008bf40008be50008a9a001d61bebe800014000"},
+		'Ú':  {9, 1, -12, 7, 13, "0001300000b4000035000b300068f40008bf40008bf40008bf40008bf40008be50008a9a001d61bebe800014000"},
+		'Û':  {9, 1, -12, 7, 13, "0014000009a7000250710b300068f40008bf40008bf40008bf40008bf40008be50008a9a001d61bebe800014000"},
+		'Ü':  {9, 1, -11, 7, 12, "04b0f400130410b300068f40008bf40008bf40008bf40008bf40008be50008a9a001d61bebe800014000"},
+		'Ý':  {7, -1, -12, 9, 12, "0000040000000880000000700000860002b103e200b80008b07c00000c8e3000003f80000000f40000000f40000000f40000000f4000"},
+		'Þ':  {7, 1, -9, 6, 9, "830000b74300bcbdd3b400aab4008bb401c9bfffa1b40000b40000"},
+		'ß':  {8, 1, -10, 7, 11, "00000003dbe800c701d20f41ba20f488000f48a100f41ad30f4007e0f4002f0f8dbe600014000"},
+		'à':  {7, 0, -10, 7, 11, "017000000970000007000059b82007448d000034d408dbbe43d100d44d004f40bdbbb40022000"},
+		'á':  {7, 0, -10, 7, 11, "000071000088000017000059b82007448d000034d408dbbe43d100d44d004f40bdbbb40022000"},
+		'â':  {7, 0, -10, 7, 11, "001810000a89000150610059b82007448d000034d408dbbe43d100d44d004f40bdbbb40022000"},
+		'ã':  {7, 0, -10, 7, 11, "004112005aba400211400059b82007448d000034d408dbbe43d100d44d004f40bdbbb40022000"},
+		'ä':  {7, 0, -10, 7, 11, "000000004f0f400000000059b82007448d000034d408dbbe43d100d44d004f40bdbbb40022000"},
+		'å':  {7, 0, -11, 7, 12, "003830000b4c0000b1c00005b500059b82007448d000034d408dbbe43d100d44d004f40bdbbb40022000"},
+		'æ':  {12, 0, -7, 12, 8, "059b8249b70007448ee54a8000034d6001f008dbbecbbbf43d100d4000004d004ea000200bdbc29dbcc0002300014100"},
+		'ç':  {7, 0, -7, 6, 10, "007bb60ab4463f10004b00004d00001e600103dcba0003b00048d0002420"},
+		'è':  {7, 0, -10, 7, 11, "0072000003c0000005300007ba4009a45e43e000794ebbbcb4d000001e6000203dcbe60002300"},
+		'é':  {7, 0, -10, 7, 11, "00005400003c100006100007ba4009a45e43e000794ebbbcb4d000001e6000203dcbe60002300"},
+		'ê':  {7, 0, -10, 7, 11, "00074000059c100070330007ba4009a45e43e000794ebbbcb4d000001e6000203dcbe60002300"},
+		'ë':  {7, 0, -10, 7, 11, "000000000f4b800000000007ba4009a45e43e000794ebbbcb4d000001e6000203dcbe60002300"},
+		'ì':  {3, -1, -10, 4, 10, "181006900051006200b400b400b400b400b400b4"},
+		'í':  {3, 0, -10, 4, 10, "00630590071006200b400b400b400b400b400b40"},
+		'î':  {3, -1, -10, 5, 10, "00830088b0070530062000b4000b4000b4000b4000b4000b40"},
+		'ï':  {3, -1, -10, 5, 10, "000000f0b8000000062000b4000b4000b4000b4000b4000b40"},
+		'ð':  {7, 0, -10, 7, 11, "0000000009978006ada000138f6008d88f22f200984b0008b4c000891e401d604ebe800004100"},
+		'ñ':  {8, 1, -10, 6, 10, "0230300ba8a0030410839b60fb55e4f50088f40088f40088f40088f40088"},
+		'ò':  {7, 0, -10, 7, 11, "018100000690000005100018b9300ba47e23f100984b0008b4d000891e401d606ebe800004100"},
+		'ó':  {7, 0, -10, 7, 11, "00006300005a000007100018b9300ba47e23f100984b0008b4d000891e401d606ebe800004100"},
+		'ô':  {7, 0, -10, 7, 11, "00083000088b000070430018b9300ba47e23f100984b0008b4d000891e401d606ebe800004100"},
+		'õ':  {7, 0, -10, 7, 11, "003212002bb9700121400018b9300ba47e23f100984b0008b4d000891e401d606ebe800004100"},
+		'ö':  {7, 0, -10, 7, 11, "000000000f0b800000000018b9300ba47e23f100984b0008b4d000891e401d606ebe800004100"},
+		'÷':  {10, 1, -7, 8, 7, "0008800000088000344444438bbbbbb800033000000bb00000000000"},
+		'ø':  {7, 0, -8, 7, 9, "0000000018b96a0b948f33f10bb84b0968b4c780891ea01d63cebe803204100"},
+		'ù':  {8, 1, -10, 6, 11, "07100006a000005200800044f00088f00088f00088f10088d501d85fbc98013000"},
+		'ú':  {8, 1, -10, 6, 11, "000630005b00007100800044f00088f00088f00088f10088d501d85fbc98013000"},
+		'û':  {8, 1, -10, 6, 11, "007300079c00060430800044f00088f00088f00088f10088d501d85fbc98013000"},
+		'ü':  {8, 1, -10, 6, 11, "0000000f4b80000000800044f00088f00088f00088f10088d501d85fbc98013000"},
+		'ý':  {7, 0, -10, 7, 13, "00007100007900000700045000453d000c50c503d006a098001e3e20008ca00002f500004d00008c80000860000"},
+		'þ':  {8, 1, -10, 6, 13, "000000f40000f40000f69b60fc55d5f6005cf4004ff4004efa00a9f9ccc1f41300f40000820000"},
+		'ÿ':  {7, 0, -10, 7, 13, "000000004f0f40000000045000453d000c50c503d006a098001e3e20008ca00002f500004d00008c80000860000"},
+		'–':  {6, 0, -4, 6, 2, "6bbbb6244442"},
+		'—':  {12, 0, -4, 12, 2, "6bbbbbbbbbb6244444444442"},
+		'‘':  {4, 1, -9, 2, 4, "2897f441"},
+		'’':  {4, 1, -9, 2, 4, "6889b200"},
+		'“':  {6, 1, -9, 5, 4, "28090974c0f48b041230"},
+		'”':  {6, 1, -9, 5, 4, "680b3893e1c278030210"},
+		'…':  {12, 1, -2, 10, 2, "46004400648b008800b8"},
+		'•':  {7, 1, -7, 5, 5, "004000cfc14fff40cfe101410"},
+		'€':  {8, 0, -9, 7, 10, "003aeb502e702808900009edbb800b400009ecb900098000004e3006006ebd80000410"},
+		'£':  {8, 0, -9, 7, 9, "001aec5009a12300b500000b400008d984004c742000b400000b40004fffff8"},
+	},
+}
+
+// Sans14 is DejaVu Sans at 14 pixels, the size of the firmware's FONT_14
+var Sans14 = &Face{
+	Height: 16,
+	Ascent: 13,
+	glyphs: map[rune]glyph{
+		' ':  {4, 0, 0, 0, 0, ""},
+		'!':  {6, 2, -11, 2, 11, "42f8f8f8f8d8b88500b6f8"},
+		'"':  {6, 1, -11, 5, 5, "32040b80f0b80f0b80f064080"},
+		'#':  {12, 1, -11, 10, 11, "00000000000002f00f100006b04d00144a949b433bbfcbecb8002f00f200006b04d000ffffffffb044e74c843002f00f200006b04d0000"},
+		'$':  {9, 1, -11, 7, 14, "0008000000b00019fffc09b1b050b80b0008e6b00008cff91000b5e9000b08b730b3d87cffd80000b000000b0000000000"},
+		'%':  {13, 0, -11, 13, 12, "005610000630009a8c1004d0002f00b600c40004c008807900001f10c51d1000008dcb0a704410001204c08b8d100000d41f10a700008904f00880002d101f20c6000a70007dcc00004000002300"},
+		'&':  {11, 0, -11, 11, 12, "00026520000006fbbf000000d8001000000e70000000008e300000003ebe3002800b809e306c00f4009e3b800f50009ee100ad3007fe30019fffc49d100014200000"},
+		'\'': {4, 1, -11, 2, 5, "32b8b8b864"},
+		'(':  {5, 1, -11, 4, 13, "008106b00d505f008b00b800b800b8009b006e001e40089001b1"},
+		')':  {5, 1, -11, 4, 13, "53004d000d6008a004f002f400f401f404f107c00c703e107600"},
+		'*':  {7, 0, -11, 7, 7, "0008000100f0015a3f3a502afa2008afa80560f065000f000"},
+		'+':  {12, 1, -9, 10, 9, "00008600000000b800000000b800000000b800008ffffffff42444c944410000b800000000b800000000b80000"},
+		',':  {4, 1, -2, 3, 4, "3b06e0980910"},
+		'-':  {5, 0, -5, 5, 2, "288823bbb3"},
+		'.':  {4, 1, -2, 2, 2, "6b8f"},
+		'/':  {5, 0, -11, 5, 13, "0002300098000e3005d00098000d5003e00089000c5002f1007a000b600041000"},
+		'0':  {9, 0, -11, 8, 12, "0004630000bebe9007e103f60c8000aa0f60008e0f40008f0f40008f0f70008d0b9000aa06f305f4008fff7000014100"},
+		'1':  {9, 1, -11, 7, 11, "00241006eff400463f400000f400000f400000f400000f400000f400000f400144f7424fffff8"},
+		'2':  {9, 1, -11, 7, 11, "0366200dfbcf8081006f400000f800002f50000cb00009c10009c10009d10009f74442ffffff8"},
+		'3':  {9, 1, -11, 7, 12, "0456300bfbbfb120003f700000c800007f304fff6000037f5000009b000009b61006f7cfffe800143000"},
+		'4':  {9, 0, -11, 9, 11, "00000430000008fb000003ecb00000c5bb00008a0bb0003e20bb000c700bb004e888dd8028888dd8000000bb0000000bb00"},
+		'5':  {9, 1, -11, 7, 12, "24444408fffff08b000008b000008dbb7106888dc100001e700000bb00000c961018f4dfffe600143000"},
+		'6':  {9, 0, -11, 9, 12, "000146400006edbe4003f60001009b0000000e88ba5000fda58f500fd0009d00e80006f00ab0008f004f402d90006fffb10000142000"},
+		'7':  {9, 1, -11, 7, 11, "3444443bfffff900002f500008d00000e800005f20000ab00002f600007e00000d900004f3000"},
+		'8':  {9, 0, -11, 8, 12, "0014740003edbdd20ac001d90b8000bb08d203e5009fff8008e546e60e70008d0f60008f0bc102da03cfffb100024200"},
+		'9':  {9, 0, -11, 8, 12, "0014630003edbe900ba003f40f5000b90f4000bc0d9001ef05fb8dce0028848b000000d7032019d107fffb3000142000"},
+		':':  {5, 1, -8, 3, 8, "1404f02800000000003b04f0"},
+		';':  {5, 1, -8, 3, 10, "1404f02800000000003b06e0980910"},
+		'<':  {12, 1, -9, 10, 9, "000000000000000028d400016cfa6105afc720008fc200000028de83000000059ed8200000016af40000000021"},
+		'=':  {12, 1, -7, 10, 5, "24444444416bbbbbbbb3000000000048888888824888888882"},
+		'>':  {12, 1, -9, 10, 9, "00000000008c6100000027cfa5000000038de9300000005df4000059fc71049ed830008e950000002000000000"},
+		'?':  {7, 1, -11, 6, 11, "047400ddbec16002f60001f6000ac100ac1003f20004f00001400003b00004f000"},
+		'@':  {14, 0, -10, 14, 13, "000049bbb71000001bc64459d30000c90000006e1006a006ba3808900c306e55bf01e00f00b5005f00f00f00d4004f01e00f00a8007f08800a603e99cfba1004d10265063000006c30000270000005dc88be700000000478400000"},
+		'A':  {10, 0, -11, 10, 11, "00004200000004fd00000009bf3000001f5a9000006d06e10000c800e60002f3009b0008fbbbdf200ea8888d805f200008d0ab000002f5"},
+		'B':  {10, 1, -11, 8, 11, "34444000bffffe60bb0008f1bb0004f4bb0019e0bfffff40bc4448e2bb0000d8bb0000d8bc4448f4bffffc50"},
+		'C':  {10, 0, -11, 10, 12, "0000475200005eebbfb004f80001900cb00000001f600000004f400000004f400000000f700000000ad000000003ea2004c0003bfffe800000143000"},
+		'D':  {11, 1, -11, 9, 11, "344420000bffffe910bb0005ce1bb00001e8bb000009cbb000008fbb000008fbb00000abbb00003f7bc4448ec0bffffb600"},
+		'E':  {9, 1, -11, 7, 11, "3444443bfffffbbb00000bb00000bb00000bfffff8bc44442bb00000bb00000bc44444bffffff"},
+		'F':  {8, 1, -11, 7, 11, "3444441bfffff4bb00000bb00000bb00000bffffb0bc44430bb00000bb00000bb00000bb00000"},
+		'G':  {11, 0, -11, 10, 12, "0000465300005eebbed404f80000770cb00000001f600000004f400044434f4000bbeb0f700000bb0bd00000bb03ea2002cb003bffffa30000144000"},
+		'H':  {11, 1, -11, 9, 11, "330000141bb00004f4bb00004f4bb00004f4bb00004f4bfffffff4bc44447f4bb00004f4bb00004f4bb00004f4bb00004f4"},
+		'I':  {4, 1, -11, 2, 11, "33bbbbbbbbbbbbbbbbbbbb"},
+		'J':  {4, -1, -11, 4, 14, "003300bb00bb00bb00bb00bb00bb00bb00bb00bb00bb00ba38f58b60"},
+		'K':  {9, 1, -11, 9, 11, "330000340bb0006f60bb006f600bb09e4000bb9e30000bff400000bccc10000bb1cc1000bb01cc100bb001cc10bb0001cc1"},
+		'L':  {8, 1, -11, 7, 11, "3300000bb00000bb00000bb00000bb00000bb00000bb00000bb00000bb00000bc44443bfffffb"},
+		'M':  {12, 1, -11, 10, 11, "3420000243bfa00009fbbdf1001eebbbb7006cbbbb6c00b7bbbb1e32f1bbbb0988a0bbbb03ed50bbbb00de00bbbb000000bbbb000000bb"},
+		'N':  {10, 1, -11, 9, 11, "341000140bf90004f0bef2004f0bbb9004f0bb4f404f0bb09b04f0bb02f44f0bb009b4f0bb002f8f0bb0008ff0bb0001ef0"},
+		'O':  {11, 0, -11, 11, 12, "00014741000006edbde60004f70007f500cb00000bc01f6000006f24f4000004f44f4000004f40f7000007f10ad00000bb003e91019e30003bfffc30000002420000"},
+		'P':  {8, 1, -11, 7, 11, "3444200bffffb2bb002dabb0008fbb0008ebc447f8bfffb80bb00000bb00000bb00000bb00000"},
+		'Q':  {11, 0, -11, 11, 13, "00014741000006edbde60004f70007f500cb00000bc01f6000006f24f4000004f44f4000004f40f7000007f10ad00000bb003e91019e30003bfffc3000000249e30000000008a00"},
+		'R':  {10, 1, -11, 9, 11, "344420000bffffd300bb002da00bb0008f00bb0009d00bd889f600bebbea000bb001e800bb0006f20bb0000d90bb00006f2"},
+		'S':  {9, 0, -11, 9, 12, "00148420004edbcf800da0001300f40000000ec30000003dffb60000047bf800000008f00000005f0093002cd00affffb30000341000"},
+		'T':  {9, -1, -11, 10, 11, "04444444420ffffffff800008f000000008f000000008f000000008f000000008f000000008f000000008f000000008f000000008f0000"},
+		'U':  {10, 1, -11, 9, 12, "320000140b800004f0b800004f0b800004f0b800004f0b800004f0b800004f0b900006f09c00008d04f7004e8006efff800000340000"},
+		'V':  {10, 0, -11, 10, 11, "32000000429c000004f34f300009c00d80001e7007e0006f1002f500b90000aa02f500006f18d000000e7d80000008ef20000003fb0000"},
+		'W':  {14, 0, -11, 14, 11, "240000330000416f1000fd0003f32f5004cf2007e00d80089b600aa009b00b68900e7006f00f24d03f3002f44d00f27e0000d88900b6aa00009bb60089e700006ff2004ef300002fd0001fe000"},
+		'X':  {10, 0, -11, 10, 11, "04200002400ac0001e8001e800ac00005f35e200000ace70000002fc00000008ef3000004f4ac00001d801e80008d1005f304f40000ac0"},
+		'Y':  {9, -1, -11, 10, 11, "042000004208d10007e201c8002e70003f40bb000008d8e2000000cf700000008f000000008f000000008f000000008f000000008f0000"},
+		'Z':  {10, 0, -11, 9, 11, "1444444434fffffffb0000006f5000003e7000001d9000000cc1000009e2000006f4000003f7000001ec4444444ffffffff"},
+		'[':  {5, 1, -11, 4, 13, "8bb0b940b800b800b800b800b800b800b800b800b800b9408bb0"},
+		'\\': {5, 0, -11, 5, 13, "41000c60007a0003f0000d5000890003e0000e3000980005d0000f2000a700023"},
+		']':  {5, 1, -11, 4, 13, "8bb334f400f400f400f400f400f400f400f400f400f434f48bb3"},
+		'^':  {12, 1, -11, 10, 5, "00004200000007fe3000006e37e30006e3006e301820000570"},
+		'_':  {7, -1, 2, 9, 2, "3bbbbbbb3144444441"},
+		'`':  {7, 1, -12, 4, 4, "32003e2006c00031"},
+		'a':  {9, 0, -8, 8, 9, "049bb91006744ac0000001f3018bbbf40ca444f43f1002f41f701af406fdf7f400141000"},
+		'b':  {9, 1, -11, 8, 12, "86000000b8000000b8000000b88bb600be946e70bd0008d0b80004f0b80004f0ba0006f0bf401c90b8cdfb1000033000"},
+		'c':  {8, 0, -8, 7, 9, "005abb706f84570e800004f300004f100001f5000009c2003019fdfa0001420"},
+		'd':  {9, 0, -11, 8, 12, "00000086000000b8000000b8008bb5b808e64ae80e6001e84f2000b84f0000b81f4000c80bc106f801cfdbc800033000"},
+		'e':  {9, 0, -8, 8, 9, "005aba4006e648f40e60008a3f9888bb4f8888861f50000009c20023019fdfe600014300"},
+		'f':  {5, 0, -11, 6, 11, "0058b303f88208b0008deb8039c43008b00008b00008b00008b00008b00008b000"},
+		'g':  {9, 0, -8, 8, 11, "008bb58608e54ae80f6000d84f1000b84f1000b81f5000d809c318f8019fe8b8000000c7026449e202beea30"},
+		'h':  {9, 1, -11, 7, 11, "8600000b800000b800000b87bb80bda47f5bc000a9b80008bb80008bb80008bb80008bb80008b"},
+		'i':  {4, 1, -11, 2, 11, "86b80086b8b8b8b8b8b8b8"},
+		'j':  {4, -1, -11, 4, 14, "008600b80000008600b800b800b800b800b800b800b800b814d64e90"},
+		'k':  {8, 1, -11, 8, 11, "86000000b8000000b8000000b8001a60b803d900b83e7000bce60000bae60000b83e6000b803e800b8003e90"},
+		'l':  {4, 1, -11, 2, 11, "86b8b8b8b8b8b8b8b8b8b8"},
+		'm':  {14, 1, -8, 12, 8, "868bb508bb50bda48f9848f2bb000db000e6b8000b8000b8b8000b8000b8b8000b8000b8b8000b8000b8b8000b8000b8"},
+		'n':  {9, 1, -8, 7, 8, "867bb80bda47f5bc000a9b80008bb80008bb80008bb80008bb80008b"},
+		'o':  {9, 0, -8, 8, 9, "006bb93008e64ae20e6000d84f30008b4f10008b1f5000aa0bc106f401bfee6000024000"},
+		'p':  {9, 1, -8, 8, 11, "868bb600be946e70bd0008d0b80004f0b80004f0ba0006f0bf401c90b8cdfb10b8033000b8000000b8000000"},
+		'q':  {9, 0, -8, 8, 11, "008bb58608e64ae80e6001e84f2000b84f0000b81f4000c80bc106f801cfdbc8000330b8000000b8000000b8"},
+		'r':  {6, 1, -8, 5, 8, "868b8bda44bc000b8000b8000b8000b8000b8000"},
+		's':  {7, 0, -8, 7, 9, "03abb921e844734f100000cd8500017aed300001c824001d83efbfb10024100"},
+		't':  {5, 0, -10, 6, 10, "0860000b80006edbb32c94410b80000b80000b80000b800009b10003cff4"},
+		'u':  {9, 1, -8, 7, 9, "8600086b8000b8b8000b8b8000b8b8000b8b8000c89d106f82dffbc80032000"},
+		'v':  {8, 0, -8, 8, 8, "690000782f3000d70c8005f106e009a001f51e5000996e00005fb800000df300"},
+		'w':  {11, 0, -8, 11, 8, "4a001b600682f205fb00a80d7088f10e508a0d4c53f105e2f0888b001f8b05cb8000ce700ff40008f300bf00"},
+		'x':  {8, 0, -8, 8, 8, "2b4001a608e10ac000bb7e20001ef500001ef40000bb8e1008e10ba04f4001e7"},
+		'y':  {8, 0, -8, 8, 11, "590000782f3000e60a9006e105e10b9000d62f30007c8c00001fe6000009e100000b9000046f20000fd60000"},
+		'z':  {7, 0, -8, 7, 8, "3bbbbb814444ea00009c10008e20006e30004f50003e600008fffffb"},
+		'{':  {9, 1, -11, 7, 14, "00038a3000ea51000f400000f400002f400005f0003be700014ac000004f200000f400000f400000f400000bdb30000341"},
+		'|':  {5, 1, -11, 2, 15, "3b4f4f4f4f4f4f4f4f4f4f4f4f4f14"},
+		'}':  {9, 1, -11, 7, 14, "3a8200015bd000004f000004f000004f000003f2000008eb3000ca41004f100004f000004f000005f0003be80001430000"},
+		'~':  {12, 1, -6, 10, 3, "01662000125ebbfc88e35200279820"},
+		'°':  {7, 1, -11, 5, 5, "026204d8d4a505a870781afa1"},
+		'À':  {10, 0, -13, 10, 13, "0007b00000000085000000004200000004fd00000009bf3000001f5a9000006d06e10000c800e60002f3009b0008fbbbdf200ea8888d805f200008d0ab000002f5"},
+		'Á':  {10, 0, -13, 10, 13, "00003e1000000093000000004200000004fd00000009bf3000001f5a9000006d06e10000c800e60002f3009b0008fbbbdf200ea8888d805f200008d0ab000002f5"},
+		'Â':  {10, 0, -13, 10, 13, "0004dc0000001916600000004200000004fd00000009bf3000001f5a9000006d06e10000c800e60002f3009b0008fbbbdf200ea8888d805f200008d0ab000002f5"},
+		'Ã':  {10, 0, -13, 10, 13, "002da5d000004428500000004200000004fd00000009bf3000001f5a9000006d06e10000c800e60002f3009b0008fbbbdf200ea8888d805f200008d0ab000002f5"},
+		'Ä':  {10, 0, -13, 10, 13, "003b368000002824600000004200000004fd00000009bf3000001f5a9000006d06e10000c800e60002f3009b0008fbbbdf200ea8888d805f200008d0ab000002f5"},
+		'Å':  {10, 0, -13, 10, 13, "0006dd2000000d059000000c2880000007ff10000009bf3000001f5a9000006e06e10000c800e60003f3009b0008fbbbdf200ea8888d805f200008d0ab000002f5"},
+		'Æ':  {14, 0, -11, 13, 11, "00003444444420001ecefffff80006e1b800000000c90b800000004f20b800000009b00bfffff801f600b94444208fbbbe8000000da888d8000005f2000b944443b90000bfffffb"},
+		'Ç':  {10, 0, -11, 10, 14, "0000475200005eebbfb004f80001900cb00000001f600000004f400000004f400000000f700000000ad000000003ea2004c0003bfffe800000189000000045b00000009b5000"},
+		'È':  {9, 1, -13, 7, 13, "0098000000a3003444443bfffffbbb00000bb00000bb00000bfffff8bc44442bb00000bb00000bc44444bffffff"},
+		'É':  {9, 1, -13, 7, 13, "0006c1000191003444443bfffffbbb00000bb00000bb00000bfffff8bc44442bb00000bb00000bc44444bffffff"},
+		'Ê':  {9, 1, -13, 7, 13, "007d90002908303444443bfffffbbb00000bb00000bb00000bfffff8bc44442bb00000bb00000bc44444bffffff"},
+		'Ë':  {9, 1, -13, 7, 13, "06b086004806403444443bfffffbbb00000bb00000bb00000bfffff8bc44442bb00000bb00000bc44444bffffff"},
+		'Ì':  {4, 0, -13, 4, 13, "3d20068003300bb00bb00bb00bb00bb00bb00bb00bb00bb00bb0"},
+		'Í':  {4, 1, -13, 3, 13, "1d5660330bb0bb0bb0bb0bb0bb0bb0bb0bb0bb0"},
+		'Î':  {4, -1, -13, 6, 13, "01cd3008338000330000bb0000bb0000bb0000bb0000bb0000bb0000bb0000bb0000bb0000bb00"},
+		'Ï':  {4, 0, -13, 5, 13, "b63b084280033000bb000bb000bb000bb000bb000bb000bb000bb000bb000bb00"},
+		'Ð':  {11, 0, -11, 11, 11, "0244430000008fffff920008b0004ce2008b00001e9008b000008e0bdebb3008f049c441008f008b000009d008b00003e8008c4447ec1008ffffb7100"},
+		'Ñ':  {10, 1, -13, 9, 13, "008d88700007078100341000140bf90004f0bef2004f0bbb9004f0bb4f404f0bb09b04f0bb02f44f0bb009b4f0bb002f8f0bb0008ff0bb0001ef0"},
+		'Ò':  {11, 0, -13, 11, 14, "0000a80000000001a2000000014741000006edbde60004f70007f500cb00000bc01f6000006f24f4000004f44f4000004f40f7000007f10ad00000bb003e91019e30003bfffc30000002420000"},
+		'Ó':  {11, 0, -13, 11, 14, "000007b000000001a1000000014741000006edbde60004f70007f500cb00000bc01f6000006f24f4000004f44f4000004f40f7000007f10ad00000bb003e91019e30003bfffc30000002420000"},
+		'Ô':  {11, 0, -13, 11, 14, "00008d800000003808300000014741000006edbde60004f70007f500cb00000bc01f6000006f24f4000004f44f4000004f40f7000007f10ad00000bb003e91019e30003bfffc30000002420000"},
+		'Õ':  {11, 0, -13, 11, 14, "0005d95a0000006258300000014741000006edbde60004f70007f500cb00000bc01f6000006f24f4000004f44f4000004f40f7000007f10ad00000bb003e91019e30003bfffc30000002420000"},
+		'Ö':  {11, 0, -13, 11, 14, "000680860000004606400000014741000006edbde60004f70007f500cb00000bc01f6000006f24f4000004f44f4000004f40f7000007f10ad00000bb003e91019e30003bfffc30000002420000"},
+		'×':  {12, 1, -9, 9, 9, "0200000110d90001c903e901cc1003e9cc100004fe100001cce90001cc13e900cc1003e8051000033"},
+		'Ø':  {11, 0, -11, 11, 12, "00014741061006edbde9c104f70008f500cb0002dcc01f6001c66f24f400b704f44f4099004f40f77b0007f10aec1000bb006fb2019e301e7bfffc30004002420000"},
+		'Ù':  {10, 1, -13, 9, 14, "003d20000000480000320000140b800004f0b800004f0b800004f0b800004f0b800004f0b800004f0b900006f09c00008d04f7004e8006efff800000340000"},
+		'Ú':  {10, 1, -13, 9, 14, "0001c6000000670000320000140b800004f0b800004f0b800004f0b800004f0b800004f0b800004f0b900006f09c00008d04f7004e8006efff800000340000"},
+		'Û':  {10, 1, -13, 9, 14, "001cb3000007639000320000140b800004f0b800004f0b800004f0b800004f0b800004f0b800004f0b900006f09c00008d04f7004e8006efff800000340000"},
+		'Ü':  {10, 1, -13, 9, 14, "00b63b300008428200320000140b800004f0b800004f0b800004f0b800004f0b800004f0b800004f0b900006f09c00008d04f7004e8006efff800000340000"},
+		'Ý':  {9, -1, -13, 10, 13, "00000a80000000480000042000004208d10007e201c8002e70003f40bb000008d8e2000000cf700000008f000000008f000000008f000000008f000000008f0000"},
+		'Þ':  {8, 1, -11, 7, 11, "3300000bb00000bd88410bebbde3bb001ccbb0008fbb0009dbd889f7bebb940bb00000bb00000"},
+		'ß':  {9, 1, -11, 8, 12, "028a71004f88bc00a9001f40b806d920b80e5000b80f7000b808f800b8004db0b80003f3b82005f1b8becf6000034000"},
+		'à':  {9, 0, -12, 8, 13, "0140000000990000000c600000013000049bb91006744ac0000001f3018bbbf40ca444f43f1002f41f701af406fdf7f400141000"},
+		'á':  {9, 0, -12, 8, 13, "0000041000008b000004c10000031000049bb91006744ac0000001f3018bbbf40ca444f43f1002f41f701af406fdf7f400141000"},
+		'â':  {9, 0, -12, 8, 13, "00022000001dd10000886a0000400400049bb91006744ac0000001f3018bbbf40ca444f43f1002f41f701af406fdf7f400141000"},
+		'ã':  {9, 0, -11, 8, 12, "008c384003b3dc1000000000049bb91006744ac0000001f3018bbbf40ca444f43f1002f41f701af406fdf7f400141000"},
+		'ä':  {9, 0, -11, 8, 12, "0084280000b63b0000000000049bb91006744ac0000001f3018bbbf40ca444f43f1002f41f701af406fdf7f400141000"},
+		'å':  {9, 0, -13, 8, 14, "00033000008ba80000b00f00008a8a0000067100049bb91006744ac0000001f3018bbbf40ca444f43f1002f41f701af406fdf7f400141000"},
+		'æ':  {14, 0, -8, 14, 9, "049bb914abb50006744adf846e50000001f80007c0018bbbf98889f00ca444f98888803f1002f70000001f701ade30015006fdf808fddf8000141000044000"},
+		'ç':  {8, 0, -8, 7, 11, "005abb706f84570e800004f300004f100001f5000009c2003019fdfa000188000047b0000aa50"},
+		'è':  {9, 0, -12, 8, 13, "00320000005e10000006b00000003100005aba4006e648f40e60008a3f9888bb4f8888861f50000009c20023019fdfe600014300"},
+		'é':  {9, 0, -12, 8, 13, "0000033000003d300001c50000013000005aba4006e648f40e60008a3f9888bb4f8888861f50000009c20023019fdfe600014300"},
+		'ê':  {9, 0, -12, 8, 13, "000040000008e700003c2c2000220220005aba4006e648f40e60008a3f9888bb4f8888861f50000009c20023019fdfe600014300"},
+		'ë':  {9, 0, -11, 8, 12, "0046084000680b6000000000005aba4006e648f40e60008a3f9888bb4f8888861f50000009c20023019fdfe600014300"},
+		'ì':  {4, -1, -12, 4, 12, "14000c8001c40013008600b800b800b800b800b800b800b8"},
+		'í':  {4, 0, -12, 5, 12, "001410099006c0003100086000b8000b8000b8000b8000b8000b8000b800"},
+		'î':  {4, -1, -12, 6, 12, "00220001dd100a678004004000860000b80000b80000b80000b80000b80000b80000b800"},
+		'ï':  {4, -1, -11, 5, 11, "082480b36b000000086000b8000b8000b8000b8000b8000b8000b80"},
+		'ð':  {9, 0, -11, 8, 12, "008a1040001ecb7006b7e8000027af6003eb8be20d8000d83f30008b4f10008b1f5000aa0bc105f401bfee6000024000"},
+		'ñ':  {9, 1, -11, 7, 11, "03c81b00a49d600000000867bb80bda47f5bc000a9b80008bb80008bb80008bb80008bb80008b"},
+		'ò':  {9, 0, -12, 8, 13, "00410000006c00000009800000004000006bb93008e64ae20e6000d84f30008b4f10008b1f5000aa0bc106f401bfee6000024000"},
+		'ó':  {9, 0, -12, 8, 13, "0000032000005e100001d30000022000006bb93008e64ae20e6000d84f30008b4f10008b1f5000aa0bc106f401bfee6000024000"},
+		'ô':  {9, 0, -12, 8, 13, "00013000000ae400005a3c1000310310006bb93008e64ae20e6000d84f30008b4f10008b1f5000aa0bc106f401bfee6000024000"},
+		'õ':  {9, 0, -11, 8, 12, "007c558000e1cc3000000000006bb93008e64ae20e6000d84f30008b4f10008b1f5000aa0bc106f401bfee6000024000"},
+		'ö':  {9, 0, -11, 8, 12, "0066082000880b3000000000006bb93008e64ae20e6000d84f30008b4f10008b1f5000aa0bc106f401bfee6000024000"},
+		'÷':  {12, 1, -8, 10, 7, "0000b800000000fb000000000000008ffffffff424444444410000b800000000fb0000"},
+		'ø':  {9, 0, -9, 9, 10, "000000010006bb96c008e64af400e601cd804f30a68b04f18808b01f9b00aa00bf206f401dbfde600330240000"},
+		'ù':  {9, 1, -12, 7, 13, "042000006c1000008900000040008600086b8000b8b8000b8b8000b8b8000b8b8000c89d106f82dffbc80032000"},
+		'ú':  {9, 1, -12, 7, 13, "00003200004e20001d30000230008600086b8000b8b8000b8b8000b8b8000b8b8000c89d106f82dffbc80032000"},
+		'û':  {9, 1, -12, 7, 13, "0014000009e50004b2c1003102108600086b8000b8b8000b8b8000b8b8000b8b8000c89d106f82dffbc80032000"},
+		'ü':  {9, 1, -11, 7, 12, "06608200880b3000000008600086b8000b8b8000b8b8000b8b8000b8b8000c89d106f82dffbc80032000"},
+		'ý':  {8, 0, -12, 8, 15, "0000042000007c100003d10000032000590000782f3000e60a9006e105e10b9000d62f30007c8c00001fe6000009e100000b9000046f20000fd60000"},
+		'þ':  {9, 1, -11, 8, 14, "86000000b8000000b8000000b88bb600be946e70bd0008d0b80004f0b80004f0ba0006f0bf401c90b8cdfb10b8033000b8000000b8000000"},
+		'ÿ':  {8, 0, -11, 8, 14, "0084282000b63b3000000000590000782f3000e60a9006e105e10b9000d62f30007c8c00001fe6000009e100000b9000046f20000fd60000"},
+		'–':  {7, 0, -5, 7, 2, "14444413bbbbb3"},
+		'—':  {14, 0, -5, 14, 2, "144444444444413bbbbbbbbbbbb3"},
+		'‘':  {4, 1, -11, 3, 5, "0311e08b0bb0330"},
+		'’':  {4, 1, -11, 3, 5, "1414f46d0960000"},
+		'“':  {7, 1, -11, 5, 5, "031041e04c8b0b8bb0f833042"},
+		'”':  {7, 1, -11, 5, 5, "141244f48f6d08b960c430040"},
+		'…':  {14, 1, -2, 12, 2, "6b00088000b68f000bb000f8"},
+		'•':  {8, 2, -8, 5, 5, "023006ff90dfff2bffe13ab50"},
+		'€':  {9, 0, -11, 8, 12, "00004730003ddbdb01d9000906f100008debbb804cc444206dd886007be8840005f2000000cc202a001bfff800002410"},
+		'£':  {9, 0, -11, 8, 11, "00004740000cebc8005f2001008e0000008b0000039c442008debb60008b0000008b0000049c44430ffffffb"},
+	},
+}
+
+// Sans16 is DejaVu Sans at 16 pixels, the size of the firmware's FONT_16
+var Sans16 = &Face{
+	Height: 19,
+	Ascent: 15,
+	glyphs: map[rune]glyph{
+		' ':  {5, 0, 0, 0, 0, ""},
+		'!':  {6, 2, -12, 2, 12, "6b8f8f8f8f8f8f8e23008f8f"},
+		'"':  {7, 1, -12, 5, 5, "680688b08b8b08b8b08b68068"},
+		'#':  {13, 1, -12, 12, 12, "00002800640000008b00e5000000b803f1000344f748d4410bfffffffff40008b00e5000000b803f1000688f98ae88208bcfbbedbb30008b00e5000000b803f1000000f407c00000"},
+		'$':  {10, 1, -13, 8, 16, "0001200000048000002794101bfcdef37e348042bb0480007f74800019ffd9400017bdf5000480bb0004809ba84598f85aeffc60000880000008800000022000"},
+		'%':  {15, 0, -12, 15, 13, "019ba300008a0000ba39d0004e10000f401f400c700000f400f407c000000e502f21e40000008e8d90990000000048504e13dee60000000c70b804e1000007c00f400f400001e400f400f4000099000d804f20004e10003ebe60000230000014200"},
+		'&':  {12, 1, -12, 11, 13, "005bbb8000004fa68c000009d0000000008e1000000002f9000000009ef90000428f36f9001f5d9006f906f1f80006f9b90cc00006ff105fa303aef9006efffb36f700034100000"},
+		'\'': {4, 1, -12, 2, 5, "688b8b8b68"},
+		'(':  {6, 1, -13, 4, 16, "001400a904f20aa01f605f208f008f008f008f005f301f6009a004f200a90000"},
+		')':  {6, 1, -13, 4, 16, "32006d100d8007d002f500e800bb00bb00bb00bb00e802f507d00d806d000000"},
+		'*':  {8, 0, -12, 8, 8, "00088000230880323c8888c3006ff60004bccb405b2882b50008800000044000"},
+		'+':  {13, 1, -11, 11, 11, "0000000000000000f4000000000f4000000000f4000000000f400003bbbbfcbbb83bbbbfcbbb800000f4000000000f4000000000f4000000000f40000"},
+		',':  {5, 1, -2, 3, 4, "0f83f77d1850"},
+		'-':  {6, 0, -6, 5, 3, "000004ffff14444"},
+		'.':  {5, 1, -2, 3, 2, "4f44f4"},
+		'/':  {5, 0, -12, 6, 14, "0000b40005f10009a0000e60003f20008c0000d70002f30007d0000c80001f40006e0000a90000830000"},
+		'0':  {10, 1, -12, 9, 13, "018bb91000be88dd106f4002f80ae0000bc0cb00008f0fb00008f0fb00008f0db00008f0bc0000ae07f2001e901ec219f3003dffe600000340000"},
+		'1':  {10, 1, -12, 8, 12, "148ab3004ffdf4001308f4000008f4000008f4000008f4000008f4000008f4000008f4000008f4000449f7430ffffffb"},
+		'2':  {10, 1, -12, 8, 12, "38bbb810bd889fc1400007f6000000f8000005f600001cc00000be300009e300009e300009e300008f744442bffffff8"},
+		'3':  {10, 1, -12, 8, 13, "49bbb9208b888ee2000002f8000000f8000007f400bffe4000688dd3000001ea000000be000000db86314af68ffffe7000443000"},
+		'4':  {10, 0, -12, 10, 12, "000007b60000003ff8000000b8f8000007d1f800002e40f80000b900f80007e100f8002e5000f8004ffffffff4144444f941000000f800000000f800"},
+		'5':  {10, 1, -12, 8, 13, "3bbbbbb04fcbbbb04f4000004f4000004fab96004db9cfb0100007f7000000db000000bb000002f986315cf39ffffd4000442000"},
+		'6':  {10, 1, -12, 9, 13, "003abba4006fc88a801ea0000007f2000000bc29b8200bde98df50df7001dd0bf10008f2af00008f46f30009f01dc207f8003cfff800000341000"},
+		'7':  {10, 1, -12, 8, 12, "8bbbbbb88bbbbcf9000006f400000cd000003f7000008f200000ea000006f500000ae000002f8000008f200000dc0000"},
+		'8':  {10, 1, -12, 9, 13, "039bba4003ed88bf508f2000db09f0000bb04f6003f8005eccf8001cd88cd309e1000bd0eb00008f0cc00009f08f8107f9008ffffb10000441000"},
+		'9':  {10, 1, -12, 9, 13, "03abb81003ec88ec00ae1003f70f90000cb0f90000bf0cd0001ff05fa45cef005dff88f0000000cb0000004f6036326ec003ffff9100004410000"},
+		':':  {5, 1, -9, 3, 9, "0420f80b60000000000000f80f8"},
+		';':  {5, 1, -9, 3, 11, "0420f80b60000000000000f83f77d1850"},
+		'<':  {13, 1, -10, 11, 10, "00000000002000000028db000016cfd83005afe950003efa60000003efa61000000059fe95000000016afe93000000027cb00000000002"},
+		'=':  {13, 1, -8, 11, 6, "144444444434fffffffffb00000000000000000000004fffffffffb14444444443"},
+		'>':  {13, 1, -10, 11, 10, "110000000004e95000000016cfd83000000027dfc72000000038df900000038ef800028dfc71017cfd8200004e94000000010000000000"},
+		'?':  {8, 1, -12, 7, 12, "29bba30bb88ee120005f400005f40003eb0003ec1000ad10000e800000b6000000000000fb00000fb000"},
+		'@':  {16, 1, -12, 14, 15, "000001443000000004bfecfd8000009e810005cc1008c200000009c02f3007b93620d689008e88ee407ac502f4003f404df404f0000f404be404f0000f4089b600e7007f44d37b005eddccdd301d70014403300003e80000007100003cd8658dd300000059bb960000"},
+		'A':  {11, 0, -12, 11, 12, "00007b600000000dfc00000004f8f30000009d0e8000001e808e000006f203f60000cc000ca0002f84449f2008fffffff700da00000ad05f5000006f4ae0000001e9"},
+		'B':  {11, 1, -12, 9, 12, "6bbbb86008fcbbbfc08f40007f48f40004f48f40009f28fcbbfe408f9888dc18f40001f98f40000bb8f40001eb8f7446cf58fffffb50"},
+		'C':  {11, 0, -12, 11, 13, "00028bbb940006ed888bf402fc100004309f200000000eb000000000f8000000000f8000000000fa000000000ce0000000006f70000012009f94026d40008dfffe8100000343000"},
+		'D':  {12, 1, -12, 11, 12, "6bbba8610008fcbbbfe8008f400019f708f400000de08f4000008f48f4000004f48f4000004f48f4000007f48f400000af18f400006f908f7447bfc108ffffda6000"},
+		'E':  {10, 1, -12, 9, 12, "6bbbbbbb08fcbbbbb08f40000008f40000008f40000008ffffffb08f98888608f40000008f40000008f40000008f74444408fffffff0"},
+		'F':  {9, 1, -12, 8, 12, "6bbbbbb38fcbbbb38f4000008f4000008f4000008fffffb08f9888608f4000008f4000008f4000008f4000008f400000"},
+		'G':  {12, 0, -12, 12, 13, "00028bbba610006ed8889fa003fc1000017009f2000000000eb0000000000f80000000000f80000ffff00fa0000449f00ce0000008f006f7000008f0009f94014bf00008dffffb40000002440000"},
+		'H':  {12, 1, -12, 10, 12, "6b300000b68f400000f88f400000f88f400000f88f400000f88ffffffff88f988888f88f400000f88f400000f88f400000f88f400000f88f400000f8"},
+		'I':  {5, 1, -12, 3, 12, "6b38f48f48f48f48f48f48f48f48f48f48f4"},
+		'J':  {5, -1, -12, 5, 16, "006b3008f4008f4008f4008f4008f4008f4008f4008f4008f4008f4008f3008f035eb0bfd3033000"},
+		'K':  {10, 1, -12, 10, 12, "6b30001aa18f4001ce308f401ce3008f41ce30008f7ec200008ffd1000008fcf6000008f49f600008f409f60008f4009f6008f40009f608f400009f6"},
+		'L':  {9, 1, -12, 8, 12, "6b3000008f4000008f4000008f4000008f4000008f4000008f4000008f4000008f4000008f4000008f7444438ffffffb"},
+		'M':  {14, 1, -12, 12, 12, "6bb000002bb38fe600008ff48f9a0000eaf48f4f2005f5f48f0d700aa4f48f08d01f54f48f02f37d04f48f00b9c804f48f006ef204f48f001b9004f48f00000004f48f00000004f4"},
+		'N':  {12, 1, -12, 10, 12, "6b900003b68ff50004f88fbd0004f88f4f6004f88f0bd004f88f02f704f88f009e14f88f002f84f88f0009e5f88f0001ebf88f00008ff88f00001ef8"},
+		'O':  {13, 0, -12, 12, 13, "00029bbb7100006fd889fc1003fb10003eb009f2000008f40eb0000002f80f80000000fb0f80000000fb0fa0000001f80ce0000006f606f700001ce1009f8205cf500008efffc400000003420000"},
+		'P':  {10, 1, -12, 9, 12, "6bbbb82008fcbbef608f4001dd08f40008f08f40009f08f4006fb08fffffc308f74430008f40000008f40000008f40000008f4000000"},
+		'Q':  {13, 0, -12, 12, 15, "00029bbb7100006fd889fc1003fb10003eb009f2000008f40eb0000002f80f80000000fb0f80000000fb0fa0000001f80ce0000006f606f700001ce1009f8205cf500008efffc3000000034be30000000001ce30000000000000"},
+		'R':  {11, 1, -12, 10, 12, "6bbbb830008fcbbdf6008f4001de008f40008f008f4000af008f7448f8008fffff90008f4029f4008f4000cd008f40004f608f40000bd08f400004f6"},
+		'S':  {10, 1, -12, 9, 13, "04abbb8305fd888c80cd0000010fb0000000ce40000003efeb8200016adff60000003df10000008f41000008f3d84016ec09effffb20002441000"},
+		'T':  {10, -1, -12, 11, 12, "0bbbbbbbbb80bbbbfebbb800000fb000000000fb000000000fb000000000fb000000000fb000000000fb000000000fb000000000fb000000000fb000000000fb0000"},
+		'U':  {12, 1, -12, 10, 13, "6b000003b38f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000005f46f500009f10de5017f8003bffff8000001440000"},
+		'V':  {11, 0, -12, 11, 12, "8a0000000a87f3000005f61f9000009e109e00001f9005f60006f3000da000cd00008f202f700002f708f200000bd0da0000006f8f50000001efe000000009f80000"},
+		'W':  {16, 0, -12, 16, 12, "5b30000b900005b33f70004ff10008f00ea0008be5000cb00ae000b8a8001f8007f300f47c005f4003f704f03f108f0000ea08c00e50cb0000ae0b800a81f800007f3f5008c5f400003f9f1004f9f000000efc0000ffb000000af80000bf8000"},
+		'X':  {11, 0, -12, 11, 12, "09a000008a104f80004f70008f301db00001dc08e2000004faf700000009fb00000000cfc00000008f7f8000003f808f30000cc001dc0008f30004f803f8000008f3"},
+		'Y':  {10, -1, -12, 11, 12, "099000001b704f70000ae1008e3005f50001dc01ea000004f8ae10000008ff500000000fc000000000fb000000000fb000000000fb000000000fb000000000fb0000"},
+		'Z':  {11, 0, -12, 11, 12, "0bbbbbbbbb00bbbbbbbfe000000009f500000006f800000003f900000001ec10000000ce200000009f400000006f700000004f900000002ee544444414fffffffff4"},
+		'[':  {6, 1, -13, 4, 16, "24438ffb8b008b008b008b008b008b008b008b008b008b008b008b008ffb0000"},
+		'\\': {5, 0, -12, 6, 14, "a500009a00005f00001f50000a900006e00002f30000c800007d00003f20000d700008c00004f2000082"},
+		']':  {6, 1, -13, 4, 16, "24438ffb008b008b008b008b008b008b008b008b008b008b008b008b8ffb0000"},
+		'^':  {13, 1, -12, 11, 5, "00003b800000003edf9000003e906f90003e90003e901a7000003b6"},
+		'_':  {8, -1, 2, 10, 2, "14444444413bbbbbbbb3"},
+		'`':  {8, 1, -13, 5, 4, "3b20008c100099000000"},
+		'a':  {10, 0, -9, 9, 10, "039dfd910078546eb00000005f30027888f406fca88f40da0002f40f80006f40dc204df403effe3f4000440000"},
+		'b':  {10, 1, -13, 9, 14, "2400000008f00000008f00000008f00000008f3bfd7008fd648f708f6000ae08f00005f38f00004f48f00004f48f40008f18fc204e808f6fffa10000142000"},
+		'c':  {9, 0, -9, 8, 10, "0029efc703ec64680ad100000f8000000f8000000f8000000cb0000005f91025006efff900003410"},
+		'd':  {10, 0, -13, 9, 14, "0000000330000000bb0000000bb0000000bb005cfc5bb04fa46deb0bc0003fb0f80000cb0f50000bb0f80000bb0da0001fb07f701bfb008fff8bb000142000"},
+		'e':  {10, 0, -9, 9, 10, "002aefa4003eb54af40ad0000ba0f944449f0ffffffff0f80000000cb00000005f920158005dfffe8000034300"},
+		'f':  {6, 0, -13, 6, 13, "000044008fff02f80004f4008cfcb637f74204f40004f40004f40004f40004f40004f40004f400"},
+		'g':  {10, 0, -9, 9, 13, "005cfc58805fa45ceb0cb0002fb0f80000cb0f60000bb0f80000cb0cb0002fb05fa45ceb005dfd5bb0000000e80040009f300ffcfe60001444100"},
+		'h':  {10, 1, -13, 8, 13, "240000008f0000008f0000008f0000008f3afd808fd74af58f4000da8f0000bb8f0000bb8f0000bb8f0000bb8f0000bb8f0000bb"},
+		'i':  {4, 1, -13, 2, 13, "248f6b006b8f8f8f8f8f8f8f8f"},
+		'j':  {4, -1, -13, 4, 17, "0024008f006b0000006b008f008f008f008f008f008f008f008f008f00ac4ff51420"},
+		'k':  {9, 1, -13, 9, 13, "2400000008f00000008f00000008f00000008f0003b708f005e9008f06f70008f8f600008ffb000008f6f900008f06e90008f003e9008f0003e90"},
+		'l':  {4, 1, -13, 2, 13, "248f8f8f8f8f8f8f8f8f8f8f8f"},
+		'm':  {16, 1, -9, 14, 9, "6b3afd507dfa308fd64af8b56eb08f4001fd1006f28f0000f80004f48f0000f80004f48f0000f80004f48f0000f80004f48f0000f80004f48f0000f80004f4"},
+		'n':  {10, 1, -9, 8, 9, "6b3afd808fd74af58f4000da8f0000bb8f0000bb8f0000bb8f0000bb8f0000bb8f0000bb"},
+		'o':  {10, 0, -9, 9, 10, "004afea2004fa55ce10bd0002f80f80000bb0f800008f0f80000bd0db0001e906f7019f4008fffe50000044000"},
+		'p':  {10, 1, -9, 9, 13, "6b3bfd7008fd648f708f6000ae08f00005f38f00004f48f00004f48f40008f18fc204e808f6fffa108f01420008f00000008f0000000240000000"},
+		'q':  {10, 0, -9, 9, 13, "005cfc58804fa46deb0bc0003fb0f80000cb0f50000bb0f80000bb0da0001fb07f701bfb008fff8bb0001420bb0000000bb0000000bb000000033"},
+		'r':  {7, 1, -9, 6, 9, "6b3af88fd8448f50008f00008f00008f00008f00008f00008f0000"},
+		's':  {8, 0, -9, 8, 10, "029efda00cc545900f5000000ec5100003cffc5000015af5000000f8383007f63dffff8000144000"},
+		't':  {6, 0, -12, 6, 12, "02400008f00008f0006dfbbb29f44408f00008f00008f00008f00008f00006f744009eff"},
+		'u':  {10, 1, -9, 8, 10, "88000088bb0000bbbb0000bbbb0000bbbb0000bbbb0000bb8d0001eb5f802aeb09fff8bb00241000"},
+		'v':  {9, 0, -9, 9, 9, "5b20000891f70001e80ad0006f205f300bc000e902f60008e08f10003f5d900000cdf5000007fd000"},
+		'w':  {13, 0, -9, 13, 9, "3b3005b6001b40f7009fa006f10ba00daf009c008e02f2f40d8003f47d0b82f5000e8a808b6f1000abe504fbc00007ff100ef800003fc000af400"},
+		'x':  {9, 0, -9, 9, 9, "1a80003b605f600cc1008e38e30000cdf6000005fd000001ddf60000ae19e2007f401cc03f80003e8"},
+		'y':  {9, 0, -9, 9, 13, "4b20000891e80001f809d0007f203f500da000ba04f50006f29d00000e8f8000008ff2000002fa0000004f4000000bd00000bff40000034200000"},
+		'z':  {8, 0, -9, 8, 9, "0bbbbbb8088888fa00001cc10000ae200009e300006f600005f700002ec444434ffffffb"},
+		'{':  {10, 2, -13, 7, 16, "0000041001cff4007f300008f000008f000008e00000ab00048f7000bed300000da000008c000008f000008f000008f000004fb820004882"},
+		'|':  {5, 2, -13, 2, 17, "41f4f4f4f4f4f4f4f4f4f4f4f4f4f4f4b3"},
+		'}':  {10, 2, -13, 7, 16, "4100000ffd300001d900000bb00000bb00000bb00000ac000005f851001beb3008e10000bb00000bb00000bb00000bb00089f70008860000"},
+		'~':  {13, 1, -7, 11, 4, "0004200000118fffc7448b4b5159effb310000003100"},
+		'°':  {8, 1, -12, 6, 6, "05bb503e55e38800885c11c508ff80000000"},
+		'À':  {11, 0, -15, 11, 15, "0001a40000000005e100000000032000000007b600000000dfc00000004f8f30000009d0e8000001e808e000006f203f60000cc000ca0002f84449f2008fffffff700da00000ad05f5000006f4ae0000001e9"},
+		'Á':  {11, 0, -15, 11, 15, "000006a100000002d300000000230000000007b600000000dfc00000004f8f30000009d0e8000001e808e000006f203f60000cc000ca0002f84449f2008fffffff700da00000ad05f5000006f4ae0000001e9"},
+		'Â':  {11, 0, -15, 11, 15, "00008b700000006c2c40000003101300000007b600000000dfc00000004f8f30000009d0e8000001e808e000006f203f60000cc000ca0002f84449f2008fffffff700da00000ad05f5000006f4ae0000001e9"},
+		'Ã':  {11, 0, -15, 11, 15, "0006b60b000000e49f80000000000000000007b600000000dfc00000004f8f30000009d0e8000001e808e000006f203f60000cc000ca0002f84449f2008fffffff700da00000ad05f5000006f4ae0000001e9"},
+		'Ä':  {11, 0, -15, 11, 15, "00066066000000bb0bb0000000000000000007b600000000dfc00000004f8f30000009d0e8000001e808e000006f203f60000cc000ca0002f84449f2008fffffff700da00000ad05f5000006f4ae0000001e9"},
+		'Å':  {11, 0, -15, 11, 15, "00019b80000000892a7000000a50680000005e8e40000000dfc00000004f8f30000009d0e8000001e808e000006f203f60000cc000da0002f84449f2008fffffff700da00000ad05f5000006f4ae0000001e9"},
+		'Æ':  {16, 0, -12, 15, 12, "00002bbbbbbbbb600008f8febbbbb60000e90fb0000000006f40fb000000000cc00fb000000003f600fffffff4009e000fd88888201fa444fb00000008ffffffb0000000da0000fb0000005f50000fc444442bd00000fffffff8"},
+		'Ç':  {11, 0, -12, 11, 16, "00028bbb940006ed888bf402fc100004309f200000000eb000000000f8000000000f8000000000fa000000000ce0000000006f70000012009f94026d40008dfffe81000003980000000005b00000004ff800000000000000"},
+		'È':  {10, 1, -15, 9, 15, "003b200000008b00000000410006bbbbbbb08fcbbbbb08f40000008f40000008f40000008ffffffb08f98888608f40000008f40000008f40000008f74444408fffffff0"},
+		'É':  {10, 1, -15, 9, 15, "0000880000005d10000003200006bbbbbbb08fcbbbbb08f40000008f40000008f40000008ffffffb08f98888608f40000008f40000008f40000008f74444408fffffff0"},
+		'Ê':  {10, 1, -15, 9, 15, "000ab400000893d2000040022006bbbbbbb08fcbbbbb08f40000008f40000008f40000008ffffffb08f98888608f40000008f40000008f40000008f74444408fffffff0"},
+		'Ë':  {10, 1, -15, 9, 15, "00840840000f80f8000000000006bbbbbbb08fcbbbbb08f40000008f40000008f40000008ffffffb08f98888608f40000008f40000008f40000008f74444408fffffff0"},
+		'Ì':  {5, 0, -15, 4, 15, "2b3006d1003206b308f408f408f408f408f408f408f408f408f408f408f4"},
+		'Í':  {5, 1, -15, 4, 15, "06903e3032006b308f408f408f408f408f408f408f408f408f408f408f40"},
+		'Î':  {5, -1, -15, 6, 15, "008a6007b2e3041023006b30008f40008f40008f40008f40008f40008f40008f40008f40008f40008f40008f40"},
+		'Ï':  {5, 0, -15, 5, 15, "86086fb0fb0000006b3008f4008f4008f4008f4008f4008f4008f4008f4008f4008f4008f40"},
+		'Ð':  {12, 0, -12, 12, 12, "03bbbb86200004fcbbbff80004f400019f8004f400000bf104f4000006f489f9860004f889f9860004f804f4000005f504f4000009f204f400004fb004f7447afc1004ffffeb6000"},
+		'Ñ':  {12, 1, -15, 10, 15, "001a92660000896de30000000000006b900003b68ff50004f88fbd0004f88f4f6004f88f0bd004f88f02f704f88f009e14f88f002f84f88f0009e5f88f0001ebf88f00008ff88f00001ef8"},
+		'Ò':  {13, 0, -15, 12, 16, "00003b300000000006c1000000000041000000029bbb7100006fd889fc1003fb10003eb009f2000008f40eb0000002f80f80000000fb0f80000000fb0fa0000001f80ce0000006f606f700001ce1009f8205cf500008efffc400000003420000"},
+		'Ó':  {13, 0, -15, 12, 16, "000000780000000004e2000000000320000000029bbb7100006fd889fc1003fb10003eb009f2000008f40eb0000002f80f80000000fb0f80000000fb0fa0000001f80ce0000006f606f700001ce1009f8205cf500008efffc400000003420000"},
+		'Ô':  {13, 0, -15, 12, 16, "000008b500000000893d300000004002200000029bbb7100006fd889fc1003fb10003eb009f2000008f40eb0000002f80f80000000fb0f80000000fb0fa0000001f80ce0000006f606f700001ce1009f8205cf500008efffc400000003420000"},
+		'Õ':  {13, 0, -15, 12, 16, "00008a5290000003c5bf600000000000000000029bbb7100006fd889fc1003fb10003eb009f2000008f40eb0000002f80f80000000fb0f80000000fb0fa0000001f80ce0000006f606f700001ce1009f8205cf500008efffc400000003420000"},
+		'Ö':  {13, 0, -15, 12, 16, "0000840860000000f80fb00000000000000000029bbb7100006fd889fc1003fb10003eb009f2000008f40eb0000002f80f80000000fb0f80000000fb0fa0000001f80ce0000006f606f700001ce1009f8205cf500008efffc400000003420000"},
+		'×':  {13, 2, -10, 10, 10, "13000000408e300009e109e3009e30009e39e3000009fe30000009fe3000009e39e30009e3009e308e300009e11300000040"},
+		'Ø':  {13, 0, -13, 12, 14, "00000000000000029bbb7198006fd889fdc103fb10007fb009f20003eaf30eb0001d62f80f8001c900fb0f8009a000fb0fa08c1001f80cd6e20006f606fe30001ce102ff8205cf501c88efffc400050003420000"},
+		'Ù':  {12, 1, -15, 10, 16, "00088000000001c7000000001300006b000003b38f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000005f46f500009f10de5017f8003bffff8000001440000"},
+		'Ú':  {12, 1, -15, 10, 16, "00001a30000000a9000000014000006b000003b38f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000005f46f500009f10de5017f8003bffff8000001440000"},
+		'Û':  {12, 1, -15, 10, 16, "0003aa1000001d38900000230041006b000003b38f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000005f46f500009f10de5017f8003bffff8000001440000"},
+		'Ü':  {12, 1, -15, 10, 16, "0048248200008f48f40000000000006b000003b38f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000004f48f000005f46f500009f10de5017f8003bffff8000001440000"},
+		'Ý':  {10, -1, -15, 11, 15, "000001a500000000a9000000001400000099000001b704f70000ae1008e3005f50001dc01ea000004f8ae10000008ff500000000fc000000000fb000000000fb000000000fb000000000fb000000000fb0000"},
+		'Þ':  {10, 1, -12, 9, 12, "6b30000008f40000008f98872008fcbbef508f4001dd08f40008f08f40009f08f4004eb08fffffd308f74440008f40000008f4000000"},
+		'ß':  {10, 1, -13, 9, 14, "00022000006effd3003f9119e108f0004f408f00ad8308f06f10008f08f10008f03fc3008f004df608f00009f28f00004f48f23008f38f3fffe60000044000"},
+		'à':  {10, 0, -13, 9, 14, "008900000001c800000002e4000000000000039dfd910078546eb00000005f30027888f406fca88f40da0002f40f80006f40dc204df403effe3f4000440000"},
+		'á':  {10, 0, -13, 9, 14, "000007a1000004e3000001e5000000230000039dfd910078546eb00000005f30027888f406fca88f40da0002f40f80006f40dc204df403effe3f4000440000"},
+		'â':  {10, 0, -13, 9, 14, "0003b6000000b8e200007a07b00003100400039dfd910078546eb00000005f30027888f406fca88f40da0002f40f80006f40dc204df403effe3f4000440000"},
+		'ã':  {10, 0, -13, 9, 14, "00172062000abd5d2000b03b700000000000039dfd910078546eb00000005f30027888f406fca88f40da0002f40f80006f40dc204df403effe3f4000440000"},
+		'ä':  {10, 0, -13, 9, 14, "00340240000bf08f00006804800000000000039dfd910078546eb00000005f30027888f406fca88f40da0002f40f80006f40dc204df403effe3f4000440000"},
+		'å':  {10, 0, -15, 9, 16, "000000000001bfd300007a07a00007805b00001cbd400000041000039dfd910078546eb00000005f30027888f406fca88f40da0002f40f80006f40dc204df403effe3f4000440000"},
+		'æ':  {16, 0, -9, 15, 10, "039dfd913affa30078546edfa55ae20000005fb0000d90027888f84444ab06fca88fffffffb0da0002f50000000f80006f90000000dc204eaf81016503effe607efffe5000440000034200"},
+		'ç':  {9, 0, -9, 8, 13, "0029efc703ec64680ad100000f8000000f8000000f8000000cb0000005f91025006efff900003c40000008800008ff5000000000"},
+		'è':  {10, 0, -13, 9, 14, "003b300000007d100000009a000000000000002aefa4003eb54af40ad0000ba0f944449f0ffffffff0f80000000cb00000005f920158005dfffe8000034300"},
+		'é':  {10, 0, -13, 9, 14, "000002b4000000c90000008b000000041000002aefa4003eb54af40ad0000ba0f944449f0ffffffff0f80000000cb00000005f920158005dfffe8000034300"},
+		'ê':  {10, 0, -13, 9, 14, "00008a0000005ca800001d31e30002300220002aefa4003eb54af40ad0000ba0f944449f0ffffffff0f80000000cb00000005f920158005dfffe8000034300"},
+		'ë':  {10, 0, -13, 9, 14, "001411420004f44f80002822840000000000002aefa4003eb54af40ad0000ba0f944449f0ffffffff0f80000000cb00000005f920158005dfffe8000034300"},
+		'ì':  {4, -1, -13, 5, 13, "1a50006e20006c000000006b0008f0008f0008f0008f0008f0008f0008f0008f0"},
+		'í':  {4, 1, -13, 4, 13, "01a609b06c1031006b008f008f008f008f008f008f008f008f00"},
+		'î':  {4, -1, -13, 6, 13, "008b1003e9a00c50c5130023006b00008f00008f00008f00008f00008f00008f00008f00008f00"},
+		'ï':  {4, -1, -13, 6, 13, "0420420f80f8084084000000006b00008f00008f00008f00008f00008f00008f00008f00008f00"},
+		'ð':  {10, 0, -13, 9, 14, "002410000001ec27b00029fe61003a65f80000068cf6001cea9de209e3001f80e80000bb0f800008f0f80000ad0db0000da05f7019f3008effd50000043000"},
+		'ñ':  {10, 1, -13, 8, 13, "0046026002ea989004708b30000000006b3afd808fd74af58f4000da8f0000bb8f0000bb8f0000bb8f0000bb8f0000bb8f0000bb"},
+		'ò':  {10, 0, -13, 9, 14, "005b100000009b00000000c8000000000000004afea2004fa55ce10bd0002f80f80000bb0f800008f0f80000bd0db0001e906f7019f4008fffe50000044000"},
+		'ó':  {10, 0, -13, 9, 14, "000004b3000001e6000000b8000000140000004afea2004fa55ce10bd0002f80f80000bb0f800008f0f80000bd0db0001e906f7019f4008fffe50000044000"},
+		'ô':  {10, 0, -13, 9, 14, "0000a80000008ad500003d13e10002200320004afea2004fa55ce10bd0002f80f80000bb0f800008f0f80000bd0db0001e906f7019f4008fffe50000044000"},
+		'õ':  {10, 0, -13, 9, 14, "000640440007cd7a6000831a900000000000004afea2004fa55ce10bd0002f80f80000bb0f800008f0f80000bd0db0001e906f7019f4008fffe50000044000"},
+		'ö':  {10, 0, -13, 9, 14, "002411410008f44f40004822820000000000004afea2004fa55ce10bd0002f80f80000bb0f800008f0f80000bd0db0001e906f7019f4008fffe50000044000"},
+		'÷':  {13, 1, -9, 11, 8, "00003b8000000004fb0000000000000003bbbbbbbbb83bbbbbbbbb80000000000000004fb000000003b80000"},
+		'ø':  {10, 0, -10, 10, 11, "0000000030004afe97d104fa55cf500bd001ee800f800c7bc00f809908f00f87c00bd00dde101e9007f8019f401c9effe5003600440000"},
+		'ù':  {10, 1, -13, 8, 14, "04b20000009c0000000a80000000000088000088bb0000bbbb0000bbbb0000bbbb0000bbbb0000bb8d0001eb5f802aeb09fff8bb00241000"},
+		'ú':  {10, 1, -13, 8, 14, "00003b300001d700000a90000014000088000088bb0000bbbb0000bbbb0000bbbb0000bbbb0000bb8d0001eb5f802aeb09fff8bb00241000"},
+		'û':  {10, 1, -13, 8, 14, "000a9000008bc70002d13d100220032088000088bb0000bbbb0000bbbb0000bbbb0000bbbb0000bb8d0001eb5f802aeb09fff8bb00241000"},
+		'ü':  {10, 1, -13, 8, 14, "0141141004f44f40028228200000000088000088bb0000bbbb0000bbbb0000bbbb0000bbbb0000bb8d0001eb5f802aeb09fff8bb00241000"},
+		'ý':  {9, 0, -13, 9, 17, "000006a1000003e4000001c60000001300004b20000891e80001f809d0007f203f500da000ba04f50006f29d00000e8f8000008ff2000002fa0000004f4000000bd00000bff40000034200000"},
+		'þ':  {10, 1, -13, 9, 17, "2400000008f00000008f00000008f00000008f3bfd7008fd648f708f6000ae08f00005f38f00004f48f00004f48f40008f18fc204e808f6fffa108f01420008f00000008f0000000240000000"},
+		'ÿ':  {9, 0, -13, 9, 17, "002402400008f08f000048048000000000004b20000891e80001f809d0007f203f500da000ba04f50006f29d00000e8f8000008ff2000002fa0000004f4000000bd00000bff40000034200000"},
+		'–':  {8, 0, -5, 8, 2, "4ffffff414444441"},
+		'—':  {16, 0, -5, 16, 2, "4ffffffffffffff41444444444444441"},
+		'‘':  {5, 1, -12, 3, 5, "0771e68f1bf0340"},
+		'’':  {5, 1, -12, 3, 5, "0b80fa3f2890000"},
+		'“':  {8, 1, -12, 6, 5, "0770481e60b88f14f5bf08f4340241"},
+		'”':  {8, 1, -12, 6, 5, "0b80880fa0bb3f40f67b04d0320220"},
+		'…':  {16, 1, -2, 14, 2, "4f8000bb0008f44f8000bb0008f4"},
+		'•':  {9, 2, -9, 6, 6, "0042001dff608fffe08ffff02eff80014300"},
+		'€':  {10, 0, -12, 10, 13, "00018bba40002ed889f000be10006002f700000069f988850049f444420008f0000000cfffff600004f600000000db000010005f9205c00005dffe800000034000"},
+		'£':  {10, 1, -12, 8, 12, "0008bbb4008f888700f9000002f8000004f8000004f80000bfffff8004f8000004f8000004f8000047f94443fffffffb"},
+	},
+}
+
+// Sans20 is DejaVu Sans at 20 pixels, the size of the firmware's FONT_20
+var Sans20 = &Face{
+	Height: 23,
+	Ascent: 19,
+	glyphs: map[rune]glyph{
+		' ':  {6, 0, 0, 0, 0, ""},
+		'!':  {8, 3, -15, 2, 15, "88ffffffffffffffefbb330088ffff"},
+		'"':  {9, 1, -15, 7, 6, "08404820f808f40f808f40f808f40f808f40b606b3"},
+		'#':  {17, 1, -15, 15, 15, "000000430024100000000f8009f000000004f500db000000008f102f800001444cd448f744104ffffffffffff401447f744ec444100008f101f800000000bc005f400004888fc88bf888008ffffffffffff000008f101f800000000bc005f400000000f8008f000000004f500cb000000"},
+		'$':  {13, 1, -16, 11, 19, "0000130000000004b0000000004b00000006adfdb81009fd9d8bf402fb04b002104f804b000004fb04b000000cfdac30000018dfffe80000005d8ef8000004b01ef000004b00bf024004b02ed04fc89d8ef5017aeffe940000004b0000000004b0000000004b00000"},
+		'%':  {19, 1, -15, 17, 16, "04aba3000001a70003fb8ce200008e1000ae101f90002f70000db000bb000bc00000eb000bb005f400000bd000da01d90000005f849f408e100000008efe602f7018b8200000000bc01ed8de20000006f408f201e9000001e900bb000bc000008e100bb000be00003f7000bd000cb0000bb00006f606f70006f3000009fff9000033000000024200"},
+		'&':  {16, 1, -15, 14, 16, "0004abba610000005ffbbef4000000df300063000000fb000000000000ee1000000000008fa000000000009ff90000000009f9cf900006b34fa01cf9000af19f5001cf900eb0bf40001cf97f509f600001cffb006fd100004ff90009fe8459fecf90008effff921cf600004440000000"},
+		'\'': {5, 1, -15, 3, 6, "0840f80f80f80f80b6"},
+		'(':  {8, 1, -16, 6, 19, "000241000bd0006f6000dd0004f80009f3000df0001fb0004fb0004fa0004fb0003fb0000fd0000bf10007f60001ea00009f20001e900006b1"},
+		')':  {8, 1, -16, 6, 19, "1410001e800008f20002f90000af10006f60003fa0000fd0000df0000bf0000bf0000ff0001fb0005f80008f3000dd0005f6000bd0003b4000"},
+		'*':  {10, 0, -15, 10, 10, "000066000000008800003d508805d305db99bd500007ff7000006edde6003db3883bd3060088006000008800000000220000"},
+		'+':  {17, 2, -13, 13, 13, "0000048200000000008f400000000008f400000000008f400000000008f400000000008f400000ffffffffffffb88888bf988886000008f400000000008f400000000008f400000000008f400000000008f400000"},
+		',':  {6, 1, -3, 4, 6, "06840bf80bf40fb04f402400"},
+		'-':  {7, 0, -7, 7, 3, "04444410fffff40444441"},
+		'.':  {6, 2, -3, 3, 3, "682bf4bf4"},
+		'/':  {7, 0, -15, 7, 17, "000008500004f600008f20000dc00003f700008f30000cd00002f800007f40000ae00001f900006f500009f00000ea00005f600008f100009900000"},
+		'0':  {13, 1, -15, 11, 16, "0018bba600001cfdbef90009f9001cf501fe00004fc06f900000df18f800000bf4af4000008f5bf4000008f8bf4000008f78f600000af48f800000bf33fc00001fe00df40008f8004fe748fe10005efffb30000004430000"},
+		'1':  {13, 2, -15, 9, 15, "025886000bffffb0009a87fb0000004fb0000004fb0000004fb0000004fb0000004fb0000004fb0000004fb0000004fb0000004fb0000004fb0006bbcfebbb8ffffffff"},
+		'2':  {13, 1, -15, 10, 15, "038bbb94008fffbdff808930004ef400000008f800000004fa00000008f70000002ee2000001cf6000001cf9000001cf9000000bf90000009f90000009f90000007ffbbbbbb88ffffffffb"},
+		'3':  {13, 1, -15, 11, 16, "068bbba60000ffebdffc100620002cf8000000005fb000000004fb00000000af6000088adf800000ffffc5000000015df6000000002fe000000000cf000000000ef020000007fc08d8888bff405dfffffb30000144410000"},
+		'4':  {13, 0, -15, 12, 15, "000000188400000000aff800000005fcf80000001ea8f8000000ae28f8000005f708f800001db008f800008f2008f80004f80008f8000dc00008f8000ffffffffff80888888bfb8400000008f80000000008f80000000008f800"},
+		'5':  {13, 1, -15, 10, 16, "06888888800bfffffff00bf00000000bf00000000bf00000000bf8a871000bfffffe600741028ff400000008fa00000001fe00000000ff00000003fd2000001bf88d8888dfc16efffff9100024440000"},
+		'6':  {13, 1, -15, 11, 16, "00028bbb830006efebef8003fe50002300bf400000002fc000000007f8179860008faeffffc108ffc2019fb08ff20000df38fb000008f76fb000008f82fd000009f60bf40002ef103ee846df80003dfffe70000003440000"},
+		'7':  {13, 1, -15, 11, 15, "288888888804ffffffffd000000008f800000000df200000005fb00000000af600000001fe100000007f900000000df300000003fd000000009f700000001ef100000006fa00000000bf500000002fd000000"},
+		'8':  {13, 1, -15, 11, 16, "0049bbb810006ffcbdfe301ef40009fb04fb00000ff04fb00000ff00ee20006f9003de889fb10007ffffd5000cf8304cf806fa00001df29f600000af48f600000af46fb00002ef21dfb647df8001affffe80000014440000"},
+		'9':  {13, 1, -15, 11, 16, "0039bba400006ffcbff6002fe3001cf408f800005fa0bf400000ff0bf400000ff39f700003ff44fd1000aff409fd88dfef4008dffc4bf400000000ff000000006f900000002ef300a9888ef60009ffffd500000144300000"},
+		':':  {7, 2, -11, 3, 11, "342bf8bf8342000000000000684bf8bf8"},
+		';':  {7, 1, -11, 4, 14, "03420bf80bf80342000000000000000006840bf80bf40fb04f402400"},
+		'<':  {17, 2, -12, 13, 12, "00000000000360000000027dfb0000016bffd8300059ffe9500039effa6000000fff6100000000affe830000000016cffd820000000028dffc720000000039eff9000000000059b0000000000000"},
+		'=':  {17, 2, -10, 13, 7, "0000000000000ffffffffffffb888888888888600000000000000000000000000ffffffffffffb8888888888886"},
+		'>':  {17, 2, -12, 13, 12, "7200000000000ffb610000000059eff950000000016affe930000000017cffd820000000028ffb000000059ffe8000049effa500038dffc610000cffd820000000e9300000000000000000000000"},
+		'?':  {11, 1, -15, 9, 15, "049bba5007ffbcff80781004ff1000000bf4000001ef1000009f8000009f9000008f9000000fd0000000fb0000000fb0000000000000002860000004fb0000004fb0000"},
+		'@':  {20, 1, -15, 18, 19, "000000000000000000000004aefffc8100000002bfc85479ee6000003ed400000018f80001ec10000000006f5009e10017a842820ad02f6001cfccf9f402f57f1009f4004ef400e88b000f900008f400b8bb000f800008f400d8ab000f800008f402f68d000dd0000bf40ad04f4005fb54aef8be300db0007effb5fe920005f600003001200000009f700000000510000008fb610015bf700000004bffffffc50000000000258862000000"},
+		'A':  {14, 0, -15, 14, 15, "0000038810000000000aff60000000001fdfb0000000007f6bf200000000df16f800000003fa01ed00000009f5009f5000000ee0004f9000006f80000df10000bf98888cf60002fffffffffc0008f8444444cf300df20000007f805fc00000001fe09f600000000af5"},
+		'B':  {14, 1, -15, 12, 15, "0888888730000ffffffff9000ff00015ef600ff000006fa00ff000004fa00ff00000af700ff8888df9000fffffffc6000ff00003af800ff000001ef10ff000000bf40ff000000df40ff000006fe10ff888acff600ffffffea400"},
+		'C':  {14, 1, -15, 12, 16, "00016abbb830004effcbdffa04ff8100029f0df6000000056fc0000000009f7000000000bf4000000000bf4000000000bf4000000000bf60000000008f90000000002ff20000000108fc2000003c009fe9748aff0006dffffe92000002444000"},
+		'D':  {15, 1, -15, 14, 15, "088888863000000ffffffffd50000ff000149ff8000ff0000003ef400ff00000008fa00ff00000002ff00ff00000000ff30ff00000000cf40ff00000000ef40ff00000000ff10ff00000005fd00ff0000001cf800ff000002cfc100ff889bdffb1000ffffffb940000"},
+		'E':  {13, 1, -15, 11, 15, "088888888820fffffffff40ff000000000ff000000000ff000000000ff000000000ff888888800fffffffff00ff000000000ff000000000ff000000000ff000000000ff000000000ffbbbbbbb30fffffffff4"},
+		'F':  {12, 1, -15, 10, 15, "08888888820ffffffff40ff00000000ff00000000ff00000000ff00000000ff88888600fffffffb00ff00000000ff00000000ff00000000ff00000000ff00000000ff00000000ff0000000"},
+		'G':  {15, 1, -15, 13, 16, "00016abbb9610004dffcbcffe504ff8100016d80df60000000136fc0000000000af70000000000bf40000000000bf40000288886bf400004ffffbbf500000000fb8f900000000fb2fe20000000fb08fc2000000fb009fe97468dfa0006cfffffc600000024441000"},
+		'H':  {15, 1, -15, 13, 15, "08800000008800ff0000000ff00ff0000000ff00ff0000000ff00ff0000000ff00ff0000000ff00ff8888888ff00fffffffffff00ff0000000ff00ff0000000ff00ff0000000ff00ff0000000ff00ff0000000ff00ff0000000ff00ff0000000ff0"},
+		'I':  {6, 1, -15, 3, 15, "0880ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff"},
+		'J':  {6, -2, -15, 6, 20, "0000880000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0003fc0008f90bcfe20ffa30000000"},
+		'K':  {13, 1, -15, 13, 15, "08800000078500ff000009fc100ff00019fc1000ff001cf910000ff01cf9000000ff1cf90000000ffcf900000000ffff300000000ff9fe30000000ff09fe3000000ff009fe300000ff0009fe30000ff00009fe3000ff000009fe300ff0000009fe3"},
+		'L':  {11, 1, -15, 11, 15, "088000000000ff000000000ff000000000ff000000000ff000000000ff000000000ff000000000ff000000000ff000000000ff000000000ff000000000ff000000000ff000000000ffbbbbbbb00fffffffff0"},
+		'M':  {17, 1, -15, 15, 15, "0888000000068820fff5000001fff40ffea000006fbf40ff9f10000cd8f40ff4f70003f88f40ff0dc0008f28f40ff08f300eb08f40ff02f805f608f40ff00be0ae108f40ff006f6f9008f40ff001eef4008f40ff0009fd0008f40ff0002430008f40ff0000000008f40ff0000000008f4"},
+		'N':  {15, 1, -15, 12, 15, "0886000000880fff400000ff0fffb00000ff0ffbf40000ff0ff4fb0000ff0ff0bf5000ff0ff02fd000ff0ff009f600ff0ff002fd00ff0ff0008f70ff0ff0001ee1ff0ff00008f8ff0ff00001eeff0ff000008fff0ff000000dff"},
+		'O':  {16, 1, -15, 14, 16, "00017bbba60000005efebbffc30004ff700019fe100df60000009f906fc00000001ff2af700000000bf6bf4000000008f8bf4000000008f8bf4000000008f8bf6000000009f88f900000000df42ff20000006fd008fc100003ef5000bfe8569ff8000008dffffc500000000344200000"},
+		'P':  {12, 1, -15, 11, 15, "088888850000fffffffd300ff0003afd00ff00001ef40ff00000bf40ff00000bf40ff00003ff20ff8889ff800ffffffd8000ff444000000ff000000000ff000000000ff000000000ff000000000ff00000000"},
+		'Q':  {16, 1, -15, 14, 18, "00017bbba60000005efebbffc30004ff700019fe100df60000009f906fc00000001ff2af700000000bf6bf4000000008f8bf4000000008f8bf4000000008f8bf6000000009f88f900000000df42ff20000006fd008fc100003ef5000bfe8569ff6000008dffffd400000000345ef6000000000003ef40000000000038700"},
+		'R':  {14, 1, -15, 13, 15, "08888885100000fffffffe30000ff0003afe0000ff00000df4000ff00000bf5000ff00000cf4000ff00007fe1000ffbbbdfd30000ffbbcff800000ff0002cf70000ff00002ee1000ff000008f8000ff000001ef200ff0000008f900ff0000001ef2"},
+		'S':  {13, 1, -15, 11, 16, "0049bbba73008ffdbbffb04fe400005809f600000000bf5000000008fc100000002effb84100002afffff910000148bffc000000003ef6000000008f8000000008f842000001df68fa8448dfc04afffffe91000034440000"},
+		'T':  {12, -1, -15, 14, 15, "088888888888820ffffffffffff4000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000"},
+		'U':  {15, 1, -15, 12, 16, "2860000000884fb0000000ff4fb0000000ff4fb0000000ff4fb0000000ff4fb0000000ff4fb0000000ff4fb0000000ff4fb0000000ff4fb0000000ff4fb0000003fc1ff1000006fa0af700001cf603ef9647dfb0003bffffe810000014440000"},
+		'V':  {14, 0, -15, 14, 15, "683000000005837f900000000ef21fe10000005fa009f6000000af6005fb000001fe0000df200007f900008f80000df300002fd0003fc000000bf4009f70000006f900ef10000001ee16fa000000009f6af5000000003fcfd0000000000dff800000000007ff200000"},
+		'W':  {20, 0, -15, 20, 15, "286000002880000008801fe000008ff400002fd00cf30000bdf800006f9008f70000f9cb00009f6005fa0004f68f0000df2001fe0008f25f4002fd0000cf300bd01f8006f900008f700f900cb009f500005fa04f6009f00df100001fe08f2006f42fc000000cf3bd0002f86f80000008f7fa0000db9f50000005fdf700009fdf10000001fff300006ffc00000000cfe000002ff80000"},
+		'X':  {14, 0, -15, 14, 15, "0485000000585001ee200002ee10005fb0000bf500000af7007fa0000001ee22ee100000005fbbf5000000000affa00000000007ff40000000002eefb000000000bf7af700000007fb01ee2000002ee2005fb00000bf70000af70007fb000001ee202ee20000006fb0"},
+		'Y':  {12, -1, -15, 14, 15, "0783000000188005fc0000008f8000af800004fc00001ef3001df3000004fc008f800000008f84fc000000001dfdf30000000004ff800000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000000000ff000000"},
+		'Z':  {14, 0, -15, 13, 15, "08888888888840fffffffffff80000000003fe3000000002ef5000000001cf80000000009fa0000000007fc1000000004fe3000000002ef4000000001cf7000000000af90000000008fc1000000005fe2000000000efdbbbbbbbb80fffffffffffb"},
+		'[':  {8, 1, -16, 5, 19, "144434fffb4f9434f8004f8004f8004f8004f8004f8004f8004f8004f8004f8004f8004f8004f8004f8004fdb83bbb8"},
+		'\\': {7, 0, -15, 7, 17, "7600000af000006f500001f900000ae000007f300002f800000cd000008f200003f700000dc000008f100005f600000ea000009f100006f500001b7"},
+		']':  {8, 1, -16, 6, 19, "0444400ffff0044cf0000bf0000bf0000bf0000bf0000bf0000bf0000bf0000bf0000bf0000bf0000bf0000bf0000bf0000bf00bbef00bbbb0"},
+		'^':  {17, 2, -15, 13, 6, "000007850000000009fff600000009fc4ef6000009f9101cf60009f900001cf606b700000018b3"},
+		'_':  {10, -1, 3, 12, 2, "3bbbbbbbbbb33bbbbbbbbbb3"},
+		'`':  {10, 1, -16, 6, 4, "1cd10002ea00003e700005b2"},
+		'a':  {12, 1, -12, 10, 13, "000243000009efffe8000e9747bf800100000bf200000006f5018beffff82efb8889f89f700007f8bf000009f8bf20003ef86fc546ebf808ffff84f80024410000"},
+		'b':  {13, 1, -16, 11, 17, "142000000004f8000000004f8000000004f8000000004f8003400004f85effe7004fbf847df704ff70001ee14fd000008f64fb000005f84fb000004f84fb000004f84fd000008f64ff60001ef14fbe845cf804f86efff80000001441000"},
+		'c':  {11, 1, -12, 9, 13, "000024300006dfffe808fd8469a4fd1000009f6000000bf1000000ff0000000cf10000009f50000004fc10000009fd6448a008effff8000044400"},
+		'd':  {13, 1, -16, 10, 17, "000000004400000000ff00000000ff00000000ff00014200ff019fffb3ff0bfb55bdff5fb0000affaf500003ffbf000000ffff000000ffcf000000ffaf300003ff6fa0000aff0cfa44aeff01bfffd3ff0002430000"},
+		'e':  {12, 1, -12, 11, 13, "00002420000007dfffc30008fd748ee304fc10003fb09f500000af1bf888888bf4ffffffffff4cf0000000009f5000000004fc1000001009fd7447ab0007effffd7000003442000"},
+		'f':  {7, 0, -16, 8, 16, "00001442001bfff8008fa44200bf000000bf00008ffffff048df888000bf000000bf000000bf000000bf000000bf000000bf000000bf000000bf000000bf0000"},
+		'g':  {13, 1, -12, 10, 17, "0001420000019fffb3ff0cfb55adff6fa0000affaf300003ffcf000000ffff000000ffbf000000ff9f500004ff4fc1001cff09fd88dcfe008dfe91fb00000002fa00000009f608a747bfc006effff9100000420000"},
+		'h':  {13, 1, -16, 10, 16, "14200000004f800000004f800000004f800000004f800340004f84dfff804faf968ef64ff60004fb4fc00000df4fa00000bf4f800000bf4f800000bf4f800000bf4f800000bf4f800000bf4f800000bf"},
+		'i':  {6, 1, -16, 3, 16, "0430fb0fb0000000fb0fb0fb0fb0fb0fb0fb0fb0fb0fb0fb"},
+		'j':  {6, -1, -16, 5, 21, "00043000fb000fb0000000000000fb000fb000fb000fb000fb000fb000fb000fb000fb000fb000fb001fb004f816cf54ff8014000"},
+		'k':  {12, 1, -16, 11, 16, "142000000004f8000000004f8000000004f8000000004f8000000004f800008fb14f80009f9004f801bf80004f81cf600004faee5000004fefc1000004f88fc100004f806fc10004f8006fc1004f80006fc104f800006fc3"},
+		'l':  {6, 1, -16, 3, 16, "0430fb0fb0fb0fb0fb0fb0fb0fb0fb0fb0fb0fb0fb0fb0fb"},
+		'm':  {19, 1, -12, 17, 12, "000003400000340004f85dffe504dffe604faf858fe5e968ef24ff40008ff60006f84fc00004fd00001fb4fa00000fb00000fb4f800000fb00000fb4f800000fb00000fb4f800000fb00000fb4f800000fb00000fb4f800000fb00000fb4f800000fb00000fb"},
+		'n':  {13, 1, -12, 10, 12, "00000340004f84dfff804faf968ef64ff60004fb4fc00000df4fa00000bf4f800000bf4f800000bf4f800000bf4f800000bf4f800000bf4f800000bf"},
+		'o':  {12, 1, -12, 11, 13, "00003400000008efff910009fc65afc105fc00009f80af500001fd0bf100000cf0ff000000bf4cf000000cf0af500001fe06fb00008f900bfb549fe10019ffffb30000014420000"},
+		'p':  {13, 1, -12, 11, 17, "000003400004f85effe7004fbf847df704ff70001ee14fd000008f64fb000005f84fb000004f84fb000004f84fd000008f64ff60001ef14fbe845cf804f86efff8004f8014410004f8000000004f8000000004f80000000014200000000"},
+		'q':  {13, 1, -12, 10, 17, "0001420000019fffb3ff0bfb55bdff5fb0000affaf500003ffbf000000ffff000000ffcf000000ffaf300003ff6fa0000aff0cfa44aeff01bfffd3ff00024300ff00000000ff00000000ff00000000ff0000000044"},
+		'r':  {8, 1, -12, 8, 12, "000003404f85dff44fbf98834ff600004fd000004fb000004f8000004f8000004f8000004f8000004f8000004f800000"},
+		's':  {10, 1, -12, 9, 13, "00034300008effff808fb646890bf1000000bf10000008fe96200008dfffb3000026afe20000008f71000008f7f96448ee2afffffc30003442000"},
+		't':  {8, 0, -15, 8, 15, "0000000004fb000004fb000004fb00008ffffff449fd888204fb000004fb000004fb000004fb000004fb000004fb000000fb000000bf9882003afff4"},
+		'u':  {13, 1, -12, 10, 13, "00000000004f800000fb4f800000fb4f800000fb4f800000fb4f800000fb4f800000fb4f800000fb4f800002fb2fd00008fb0bfa55adfb01bfffc3fb0003430000"},
+		'v':  {12, 0, -11, 12, 11, "4f9000000cf10df100003fa008f600008f5002fc0000ee0000bf2005f800006f800af300001ed01fc0000009f57f70000004f9cf10000000defa000000008ff50000"},
+		'w':  {16, 0, -11, 16, 11, "1fb0000ff60006f60cf0004ff90009f208f5008fbd000ed004f800cc7f203f9000fc01f83f607f6000bf15f40da0af20008f58f009e0ec00003f9cb006f7f800000edf8002fef500000aff3000dff1000007fe00009fc000"},
+		'x':  {12, 0, -11, 12, 11, "0bf600008f9001ee3003fd10004fc11df3000008f9af70000000bffa000000006ff400000002eefc1000000cf58f8000008f800cf50005fc0002ee202ee200005fc0"},
+		'y':  {12, 0, -11, 12, 16, "4f9000000df10cf100004f9006f700009f4001ed0001fd00009f4007f700002f900df100000bf14f90000006f79f40000000edfd000000008ff7000000002ff1000000004f90000000009f4000000248fb00000008ffc2000000024200000000"},
+		'z':  {10, 0, -11, 10, 11, "0ffffffffb0888888cfa0000004fd1000003ee3000001df4000001cf60000009f80000008f90000006fc0000003ff88888864ffffffffb"},
+		'{':  {13, 2, -16, 9, 20, "00000034100008fff40003fc5410007f70000008f40000008f40000008f40000008f4000000df20006bde700006bee60000001df20000008f40000008f40000008f40000008f40000008f70000003fc44100008fff4000001441"},
+		'|':  {7, 2, -16, 3, 21, "2418f48f48f48f48f48f48f48f48f48f48f48f48f48f48f48f48f48f48f46b3"},
+		'}':  {13, 2, -16, 9, 20, "2420000008ffe60000246ee0000000bf20000008f40000008f40000008f40000008f40000007f80000001bfcb300009fdb30006f90000008f40000008f40000008f40000008f4000000bf3000245ee00008ffe60000244000000"},
+		'~':  {17, 2, -8, 13, 4, "028ba720000388ffffffa889fae810059fffe803000000033000"},
+		'°':  {10, 1, -15, 8, 7, "008bb80008e88e800f5005f00f4004f00d9009d003effe3000144100"},
+	},
+}
+
+// Sans22 is DejaVu Sans at 22 pixels, the size of the firmware's FONT_22
+var Sans22 = &Face{
+	Height: 26,
+	Ascent: 20,
+	glyphs: map[rune]glyph{
+		' ':  {7, 0, 0, 0, 0, ""},
+		'!':  {9, 3, -17, 3, 17, "000bf8bf8bf8bf8bf8bf8bf8bf88f88f56b30000008b6bf8bf8"},
+		'"':  {10, 2, -17, 7, 7, "0000000ff00bf0ff00bf0ff00bf0ff00bf0ff00bf0ff00bf0"},
+		'#':  {18, 1, -16, 16, 16, "0000003b6004b5000000007f5008f300000000af100ce000000000ec001fa000004446fa447f944300fffffffffffffb00444cf444de444300000ec001fa000000003f8005f7000000007f5008f300004fffffffffffff802888fd888fc888400003f8005f7000000007f5008f300000000af100ce000000000ec001fa000000"},
+		'$':  {14, 1, -17, 12, 21, "00000860000000000b80000000001c920000006dfffffb2008fe8c98ae400ef20b8001104fb00b8000001fe10b8000000bfd7c800000019ffffd820000027deffe5000000b819fd000000b800df300000b800cf248200b806fd04ffb8dccfe30059cfffc820000000b80000000000b80000000000b800000000003200000"},
+		'%':  {21, 1, -17, 19, 18, "001441000000024100006fffe5000000dc00004fb12ce100008f400009f2005f70002e900000bf0002f8000ae100000bf0001f8005f70000009f2005f701dc00000004fa11cf208f4000000008ffff602f90026620000266200be106ffff6000000005f703fa11bf20000001db008f3003f80000008f300bf0000fb000002f8000bf0000fb00000be10008f3005f800005f600002fc22cf20001db0000006effe600001420000000144100"},
+		'&':  {17, 1, -17, 16, 18, "00000444200000000005effffc200000004ff968af40000000af80000220000000bf400000000000009f800000000000003ff40000000000003efe300000000003eeafe3000028600df509fe30006f806fb0009fe3009f508f800009fe31ed008f8000009fe9f6007fd0000009ffc0001ef9000007ffe30005ffd888cfeafe30003bffffe9109fc10000244400000000"},
+		'\'': {6, 2, -17, 2, 7, "00ffffffffffff"},
+		'(':  {9, 1, -17, 6, 20, "0001b80009f2002fa0009f4001fd0006f9000af6000df4000ff0000ff0000ff0000ff0000ef3000af50007f80002fd0000af30004f90000bf20002f9"},
+		')':  {9, 1, -17, 6, 20, "1b800009f30002fb0000af30005f90001fe0000bf40008f80008f80008fb0008fb0008f90008f8000bf5000ff1005fa0009f5001ed0008f5001eb000"},
+		'*':  {11, 0, -17, 11, 11, "0000040000000000f0000004000f000402eb20f02be2029f8f8f9200002cfc2000004bdfdb4001ae80f08ea119200f0029100000f0000000000b00000"},
+		'+':  {18, 2, -14, 15, 14, "0000008b0000000000000bf0000000000000bf0000000000000bf0000000000000bf0000000000000bf00000008bbbbbefbbbbbb0bfffffffffffff0000000bf0000000000000bf0000000000000bf0000000000000bf0000000000000bf0000000000000bf0000000"},
+		',':  {7, 1, -3, 4, 6, "06b808fb08f90bf21f902820"},
+		'-':  {8, 1, -7, 6, 2, "fffffbbbbbb8"},
+		'.':  {7, 2, -3, 3, 3, "8b6bf8bf8"},
+		'/':  {7, 0, -17, 8, 20, "00000000000008f400000de000003f9000008f500000cf100002fa000007f600000bf100001fc000006f700000af200000ed000005f8000009f300000de000003f9000008f500000cf00000000000000"},
+		'0':  {14, 1, -17, 12, 18, "000024420000001bffffb10001cfc88cfc1008fc1001cf800ef500005fd03ff000000ff36fb000000bf68fb000000bf88fb000000bf88fb000000bf88fb000000bf86fb000000bf63ff000000ff30ef500005fd008fc1001cf8001cfd88dfc10001bffffa100000024420000"},
+		'1':  {14, 2, -17, 10, 17, "000000000028adff80008fffff80005841bf80000000bf80000000bf80000000bf80000000bf80000000bf80000000bf80000000bf80000000bf80000000bf80000000bf80000000bf80003bbbefdbbb4fffffffff"},
+		'2':  {14, 1, -17, 11, 17, "0002444000018dfffff8104ffb88affc038200003ff6000000009fa000000008fb00000000af800000003ff20000001df80000001cf90000001cfc1000001cfc1000001cfc1000000cfc10000009fc10000007ffcbbbbbb88fffffffffb"},
+		'3':  {14, 1, -17, 12, 18, "00034442000008ffffffb3000bda889efe2002000001cf90000000006fb0000000005fb000000000bf800004888df9000008ffff81000002447bfe30000000009fd0000000001ff3000000000ff4000000002ff222000001cfb04fc988aefe302cffffff9200000444400000"},
+		'4':  {14, 1, -17, 12, 17, "0000000000000000008ff800000004fff80000001ddcf80000008f4bf8000004f90bf800001de10bf800008f500bf80003fa000bf8000ce2000bf8008f70000bf800fe88888dfb86fffffffffffb4444444cf9430000000bf8000000000bf8000000000bf800"},
+		'5':  {14, 1, -17, 12, 18, "0000000000000bffffffff000bfcbbbbbb000bf4000000000bf4000000000bf4000000000bf8888500000bffffffc3000a95447dfe2000000001cf90000000005fe0000000001ff0000000003ff0000000008fd022000004ef804fc988cffc103dfffffe8100001444300000"},
+		'6':  {14, 1, -17, 12, 18, "0000024440000003bfffff60005ffc889d8002ef7000001009f9000000000ef3000000004fe0388840006fb8fffffb108fffa426efb08ffa00003ff37ff400000bf84ff1000008f82ff2000008f80cf600000cf706fc10006fe100bfd889ff600018ffffd500000014430000"},
+		'7':  {14, 1, -17, 12, 17, "0000000000004ffffffffff03bbbbbbbdfd000000000bf8000000002ff2000000008fa000000000ef6000000005fe000000000af8000000002ff3000000007fc000000000df6000000004ff1000000009f9000000001ef4000000006fd000000000cf8000000"},
+		'8':  {14, 1, -17, 12, 18, "000034430000006effffd60006ff9889ff600ef700008fe01ff100001ff00ff100001ff00bf700007fb003df9559fd20001cffffc10004ef9889fe401ef600006fe16fc000000cf68fb000000bf87fc000000cf72ff600006ff208ff9889ff80008effffe800000034430000"},
+		'9':  {14, 1, -17, 12, 18, "000044410000006effff810006ff988dfb002ff60001cf607fc000006fc08f8000002ff18f8000001ff48fb000005ff73ff30000aff80afe644afff801afffff8bf6000388820ef4000000003fe000000000af9001000007fe1008d988dfe40006fffffb3000000444200000"},
+		':':  {7, 2, -12, 3, 12, "4868fb8fb2430000000000000006b88fb8fb"},
+		';':  {7, 1, -12, 4, 15, "048608fb08fb02430000000000000000000006b808fb08f90bf21f902820"},
+		'<':  {18, 2, -13, 15, 12, "00000000000038000000000027dff000000016bfffb60000059fffc72000038effd82000000affe93000000000bffa6100000000016cffe95000000000028dffe93000000000039effd8300000000005afff00000000000016c0"},
+		'=':  {18, 2, -10, 15, 7, "bfffffffffffff08bbbbbbbbbbbbb0000000000000000000000000000000688888888888880bfffffffffffff0344444444444440"},
+		'>':  {18, 2, -13, 15, 12, "861000000000000bfe95000000000039effd83000000000059fffc7200000000016afffa6100000000027cffe000000000038eff000000028dffe83000027cfff95000016afffb61000000bffd72000000000a83000000000000"},
+		'?':  {12, 1, -17, 10, 17, "000444100029effff8008fd889ff806600007ff00000000ff30000004fe0000003ef7000003ef9000001df90000008fa0000000bf50000000bf400000008b3000000000000000008b60000000bf80000000bf80000"},
+		'@':  {22, 1, -16, 20, 20, "00000002588740000000000005bffffffe9100000001afd8410259fe5000001cf8000000003cf60000bf600000000001ce2006f70001788408402e900dd0003effff8f8008f13f6000df7006ef8004f57f2005f800008f8001f88f0008f400004f8001f88f0008f400003f8004f58f1007f600005f8009e14f5002fc1000bf806f801e90008fd88defbbf90009f30008effa2ffa400001ec1000000000000000005fc2000000001400000005ee82000016de100000002bffdbbcffb4000000000027bbbb83000000"},
+		'A':  {15, 0, -17, 15, 17, "000000000000000000000dfe000000000005fff60000000000afbfa0000000001fe1ef2000000007f909f800000000cf503fd00000003fd000df40000009f80007f9000000ef20002fe100006fc00000bf60000afffffffffc0002fffffffffff2008fa00000009f800df600000005fd04fe100000000ef59f90000000008fa"},
+		'B':  {15, 2, -17, 12, 17, "000000000000bffffffd9100bfcbbbcffe20bf400002cf90bf4000006fb0bf4000005fb0bf400000af90bf98888cfc10bfffffffc200bf744468ef60bf4000004ff2bf4000000cf7bf4000000bf8bf4000000ef7bf4000019ff2bfcbbbbfff60bffffffd9400"},
+		'C':  {15, 1, -17, 14, 18, "0000004444000000029efffffa40005efe9888dff303ef91000004d40bfa00000000123ff200000000008fc00000000000bf900000000000bf800000000000bf800000000000af9000000000008fc000000000003ff200000000000bfa000000001203ef91000004d4004efea888dff300029efffff93000000034440000"},
+		'D':  {17, 2, -17, 14, 17, "00000000000000bffffffb840000bfcbbbcfffb200bf4000016efe20bf40000001dfa0bf400000005ff2bf400000000ef6bf400000000bf8bf400000000bf9bf400000000bf9bf400000000bf8bf400000000ef6bf400000006ff2bf40000002ef90bf4000016efd10bfcbbbdfffb100bfffffeb830000"},
+		'E':  {14, 2, -17, 11, 17, "00000000000bfffffffff4bfcbbbbbbb3bf400000000bf400000000bf400000000bf400000000bf988888880bfffffffff0bf744444440bf400000000bf400000000bf400000000bf400000000bf400000000bfcbbbbbbb6bfffffffff8"},
+		'F':  {13, 2, -17, 10, 17, "0000000000bffffffff8bfcbbbbbb6bf40000000bf40000000bf40000000bf40000000bf98888860bfffffffb0bf74444430bf40000000bf40000000bf40000000bf40000000bf40000000bf40000000bf40000000"},
+		'G':  {17, 1, -17, 15, 18, "00000034442000000029efffffd810005efea888bffb003ef910000018b00bfa000000000203ff2000000000008fc000000000000bf9000000000000bf8000004888882bf8000008fffff4bf9000004888ff48fc000000000ff43ff200000000ff40bfa00000000ff403ef91000001ff4004efea888aefe200029efffffd810000000344410000"},
+		'H':  {17, 2, -17, 13, 17, "0000000000000bf40000000bf8bf40000000bf8bf40000000bf8bf40000000bf8bf40000000bf8bf40000000bf8bf98888888df8bfffffffffff8bf74444444cf8bf40000000bf8bf40000000bf8bf40000000bf8bf40000000bf8bf40000000bf8bf40000000bf8bf40000000bf8"},
+		'I':  {6, 2, -17, 3, 17, "000bf4bf4bf4bf4bf4bf4bf4bf4bf4bf4bf4bf4bf4bf4bf4bf4"},
+		'J':  {6, -2, -17, 7, 22, "00000000000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000cf40000ff40004ff0288ef904fffb102853000"},
+		'K':  {14, 2, -17, 13, 17, "0000000000000bf4000003efa1bf400003ef900bf40003ef9000bf4004ef90000bf406ff700000bf46ff6000000bf9ff60000000bfff900000000bf9ff60000000bf46ff6000000bf406ff600000bf4006ff60000bf40006ff6000bf400006ff600bf4000006ff60bf40000006ff6"},
+		'L':  {12, 2, -17, 11, 17, "00000000000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000bfcbbbbbbb3bfffffffff4"},
+		'M':  {19, 2, -17, 15, 17, "000000000000000bff900000009ffbbffe0000000effbbfcf6000006fbfbbf6fa00000bf6fbbf4bf20002fb4fbbf46f70008f64fbbf41ed000de14fbbf409f304f904fbbf404f909f404fbbf400de1ed004fbbf4008fbf8004fbbf4002fff2004fbbf4000bfb0004fbbf40000000004fbbf40000000004fbbf40000000004fb"},
+		'N':  {16, 2, -17, 13, 17, "0000000000000bff6000000bf4bffd000000bf4bfef700000bf4bf8fe10000bf4bf4bf80000bf4bf43fe1000bf4bf409f8000bf4bf402ff200bf4bf4009f900bf4bf4002ef20bf4bf40008f90bf4bf40001ef4bf4bf400008fbbf4bf400001efef4bf4000006fff4bf4000000dff4"},
+		'O':  {17, 1, -17, 16, 18, "00000144420000000003afffffd50000006efd888cff900003ff9000005ef8000bfa00000007ff203ff200000000df808fc0000000008fc0bf90000000004ff0bf80000000004ff0bf80000000004ff0af90000000004ff08fc0000000008fc03ff200000000df800bfa00000007ff2003ff9000006ff800006efd888cff90000002afffffc500000000014442000000"},
+		'P':  {13, 2, -17, 11, 17, "00000000000bfffffea400bfcbbbeff60bf400019ff2bf400001ef6bf400000bf8bf400000cf8bf400004ff4bf74448efc0bfffffffb10bf988883000bf400000000bf400000000bf400000000bf400000000bf400000000bf400000000"},
+		'Q':  {17, 1, -17, 16, 20, "00000144420000000003afffffd50000006efd888cff900003ff9000005ef8000bfa00000007ff203ff200000000df808fc0000000008fc0bf90000000004ff0bf80000000004ff0bf80000000004ff0af90000000004ff08fc0000000008fc03ff200000000df800bfa00000007ff2003ff9000006ff800006efd888cff900000029fffffe40000000001445ef600000000000006ff600000000000006bb200"},
+		'R':  {15, 2, -17, 13, 17, "0000000000000bffffffa50000bfcbbbeff8000bf400009ff200bf400000ef700bf400000bf800bf400000df700bf400006ff200bf9888cff6000bfffffff50000bf74449fe3000bf400008fc000bf400001df600bf4000006fd00bf4000000df60bf40000006fd0bf40000000df6"},
+		'S':  {14, 1, -17, 12, 18, "000034441000008efffffd8009ffa888bfb03ff3000001508fb0000000008fb0000000006fe3000000001effa841000003bfffffc50000038befff9000000003aff4000000000cf90000000008fb0000000009fa771000003ff68ffb888affc039dfffffe810000244430000"},
+		'T':  {13, -1, -17, 15, 17, "0000000000000000fffffffffffff80bbbbbcfebbbbb60000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb000000"},
+		'U':  {16, 1, -17, 14, 18, "000000000000000ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff20000000ff40ff40000002ff10bf80000006fd006fe300002ef80009ff9889efc000008effffe810000000344400000"},
+		'V':  {15, 0, -17, 15, 17, "0000000000000009f90000000009f94ff100000000ef50df600000006fd007fc0000000af8002ff2000002ff2000af8000007fb00006fd00000df600000ef50003fe1000008f90009f90000003ff101ef40000000cf606fd000000007fc0bf7000000001ff4ff20000000009fefa00000000005fff500000000000dfe000000"},
+		'W':  {22, 0, -17, 22, 17, "00000000000000000000002ff1000008ff4000005fd00df500000bff8000008f9009f800000fcfb00000cf6006fc00004f8bf00001ff2002ff10008f58f40005fd0000df5000af14f80008f900009f8000ec00fb000cf600006fc003f800cf001ff200002ff107f5008f405fd000000df50af1005f808f90000009f80ec0001fa0cf60000006fc3f80000ce0ff20000002ff8f500008f7fd00000000dfef100005fef9000000009ffd000001fff6000000006ff9000000dff20000"},
+		'X':  {15, 0, -17, 15, 17, "00000000000000004fe2000000afa0008fb000005fe10001df70001ef5000004fe200afa00000008fb05fe100000001df8ef50000000004fffa00000000000cff100000000005fff70000000001ef8fe200000000afa08fb00000005fe101df7000001ef50004fe20000afa000008fb0005fe1000001df701ef500000004fe2"},
+		'Y':  {13, -1, -17, 15, 17, "0000000000000000afa00000004fe201ef5000001df70005fe100008fb00000afa0004fe2000001ef501df700000005fe18fb000000000afcfe20000000001dff7000000000005fc0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb000000"},
+		'Z':  {15, 0, -17, 15, 17, "0000000000000000bfffffffffffb008bbbbbbbbbffb000000000007fe300000000004ff500000000002ef800000000001cfa000000000009fc100000000008fe300000000005ff500000000003ef700000000001cf900000000000afc100000000008fe200000000006ff400000000000efebbbbbbbbbb00fffffffffffff0"},
+		'[':  {9, 1, -17, 6, 20, "0bbbb60febb60fb0000fb0000fb0000fb0000fb0000fb0000fb0000fb0000fb0000fb0000fb0000fb0000fb0000fb0000fb0000fb0000febb60ffff8"},
+		'\\': {7, 0, -17, 8, 20, "00000000cf0000008f5000003f9000000de0000009f3000005f8000000ed000000af2000006f7000001fc000000bf1000007f6000002fa000000cf0000008f5000003f9000000de0000008f400000000"},
+		']':  {9, 2, -17, 5, 20, "8bbb88bcfb004fb004fb004fb004fb004fb004fb004fb004fb004fb004fb004fb004fb004fb004fb004fb004fb8bcfbbfffb"},
+		'^':  {18, 2, -17, 15, 7, "000000000000000000006ffc10000000006ffdfc100000006ff61cfa0000006fe4001bf900006fe3000009f9003ec300000009f90"},
+		'_':  {11, -1, 3, 13, 3, "14444444444414fffffffffff41444444444441"},
+		'`':  {11, 1, -18, 6, 5, "07810003fb00006f800007f4000077"},
+		'a':  {13, 1, -13, 11, 14, "0002444000008effffe8000bc8668ef8002000001ef1000000008f500168888bf806efffffff84fe610008f88f7000008f8bf400000df88f900008ff83ff957bfbf806efffe58f800044400000"},
+		'b':  {14, 1, -17, 12, 18, "0bb0000000000ff0000000000ff0000000000ff0000000000ff0034410000ff1bfffe7000ffcd758ff700ffd10004fe10ff600000af70ff2000007fa0ff0000004fb0ff0000004fb0ff2000007fa0ff600000af70ffd10004fe10ffcd858ff700ff1bfffe700000002441000"},
+		'c':  {12, 1, -13, 10, 14, "0000244400003bfffff805ffb758ab1ef70000017fb0000000af80000000bf40000000bf40000000af800000006fc00000001ef700000105ffb858bb003bfffff80000244400"},
+		'd':  {14, 1, -17, 11, 18, "000000000bb000000000ff000000000ff000000000ff000144200ff008efffb1ff08fe847dcff2ff30001eff7f9000006ffaf6000002ffbf4000000ffbf4000000ffaf6000002ff7f9000006ff2ff30001eff07fe858dcff007efffb1ff00014420000"},
+		'e':  {14, 1, -13, 12, 14, "000024430000003bffffd30004ff9769fe301ef600006fb06f9000000df29f7000000af4bffffffffff4bf9888888882af70000000007fb0000000001ef80000004003efb8588df0003bfffffd80000014442000"},
+		'f':  {8, 0, -17, 9, 17, "00017abb3001cffff4006fa1000008f80000008f800008ffffffb048bfb8860008f80000008f80000008f80000008f80000008f80000008f80000008f80000008f80000008f80000008f80000"},
+		'g':  {14, 1, -13, 11, 18, "00014420000008ffffb1ff08fe847dcff2ff30001dff8f9000006ffbf6000002ffbf4000000ffbf4000000ff9f7000003ff6fb000008ff1ef70004eff05ffdbcf8ff003affc60ff000000003fb00000000af80394104afe104ffffffd3000378885000"},
+		'h':  {14, 1, -17, 12, 17, "0bb0000000000ff0000000000ff0000000000ff0000000000ff0024410000ff1affff8000ffbd888ff600ffc10007fc00ff500001ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff0"},
+		'i':  {6, 2, -17, 3, 17, "bb0ff0bb0000000ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0"},
+		'j':  {6, -1, -17, 6, 22, "000bb0000ff0000bb0000000000000000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0028fa08ffe30487200"},
+		'k':  {13, 1, -17, 12, 17, "0bb0000000000ff0000000000ff0000000000ff0000000000ff0000000000ff000019fc10ff0001cf9000ff003cf80000ff03ef600000ff6ee6000000ffff40000000ff9fc1000000ff09fc300000ff009fe30000ff0008fe3000ff00006fe300ff000006fe3"},
+		'l':  {6, 2, -17, 3, 17, "bb0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0ff0"},
+		'm':  {21, 1, -13, 19, 13, "00000244100003440000ff1bfffe503dfffd300ffcd88afe4eb88cfd00ffc1000aff90001df40ff500005ff100008f80ff000004fb000008f80ff000004fb000008f80ff000004fb000008f80ff000004fb000008f80ff000004fb000008f80ff000004fb000008f80ff000004fb000008f80ff000004fb000008f8"},
+		'n':  {14, 1, -13, 12, 13, "0000024410000ff1affff8000ffbd888ff600ffc10007fc00ff500001ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff0"},
+		'o':  {13, 1, -13, 12, 14, "000044410000006effff910006ff957dfc102ef60001cf807fb000005fe0af7000000ff3bf4000000cf4bf4000000cf4af7000000ff27fb000005fe01ef60001cf8006ff968dfc10005dffff9100000034410000"},
+		'p':  {14, 1, -13, 12, 18, "0000034410000ff1bfffe7000ffcd758ff700ffd10004fe10ff600000af70ff2000007fa0ff0000004fb0ff0000004fb0ff2000007fa0ff600000af70ffd10004fe10ffcd858ff700ff1bfffe7000ff0024410000ff0000000000ff0000000000ff000000000088000000000"},
+		'q':  {14, 1, -13, 11, 18, "00014420000008efffb1ff08fe847dcff2ff30001eff7f9000006ffaf6000002ffbf4000000ffbf4000000ffaf6000002ff7f9000006ff2ff30001eff07fe858dcff007efffb1ff000144200ff000000000ff000000000ff000000000ff00000000088"},
+		'r':  {9, 1, -13, 9, 13, "0000024400ff1bfff00ffce88800ffd100000ff6000000ff1000000ff0000000ff0000000ff0000000ff0000000ff0000000ff0000000ff000000"},
+		's':  {11, 1, -13, 10, 14, "000444410006efffff904fe8548ab0af50000010bf500000007fd62000001bfffd94000048bfff900000017ff30000000bf74000000cf4bd8747bfc08efffff9100024441000"},
+		't':  {9, 0, -16, 9, 16, "00880000000ff0000000ff0000000ff000008fffffff048ff8888000ff0000000ff0000000ff0000000ff0000000ff0000000ff0000000ff0000000cf40000008febbb00008dfff0"},
+		'u':  {14, 1, -13, 11, 14, "000000000004fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff2fc000001ff0ff000005ff0df70001dff06ff888ebff008ffff91ff00014420000"},
+		'v':  {13, 0, -13, 13, 13, "00000000000002fe0000000ef20cf5000005fc006fa00000af6001ff10001ff10009f70006f900005fc000cf500000df302fd0000008f808f80000002fe0df20000000cf9fc000000006fff6000000001fff10000"},
+		'w':  {18, 0, -13, 18, 13, "0000000000000000000ef10005ff50001fe00af50008ff80005fa007f8000cddc0008f6002fc002f99f100cf2000df206f66f602fd00009f609f22f906f900006f90dd00dd09f600002fd2f8008f2df200000df8f5005f8fc0000008fef1001fef80000005ffc0000cff50000001ff800008ff1000"},
+		'x':  {13, 0, -13, 13, 13, "000000000000008fb000009fa000cf80006fd10002ef403ef3000005fe2cf700000008fefa000000001dfd1000000005fff400000001ef9fd1000000bf809fa000008fc001cf70004fe20003ef301ef5000006fd1"},
+		'y':  {13, 0, -13, 13, 18, "00000000000002fe0000000ef20af6000006fb005fb00000bf6000df20002fe00008f80008f800001fe000ef2000009f606fb0000004fb0bf60000000df4fe000000007fff8000000001eff20000000009fb0000000000bf60000000002fd0000000002cf800000004fffc00000000288610000000"},
+		'z':  {12, 0, -13, 11, 13, "000000000000bffffffff806888888ef800000006fd10000005fe30000003ef40000002ef60000001cf80000000bf900000009fc10000007fd10000000ffa88888840fffffffff8"},
+		'{':  {14, 2, -17, 10, 21, "0000048bb300005ffeb30000bf70000000df20000000ff00000000ff00000000ff00000000ff00000002fe0000148df800004fff800000145cf800000002fe00000000ff00000000ff00000000ff00000000ff00000000df20000000af800000004ffff40000027882"},
+		'|':  {7, 2, -17, 3, 23, "3b64f84f84f84f84f84f84f84f84f84f84f84f84f84f84f84f84f84f84f84f84f8142"},
+		'}':  {14, 2, -17, 10, 21, "3bb84000003bdff500000007fb00000002fd00000000ff00000000ff00000000ff00000000ff00000000ef200000008fd841000008fff400008fc5410000ff20000000ff00000000ff00000000ff00000000ff00000002fc00000008fa00004ffff400002887200000"},
+		'~':  {18, 2, -9, 15, 4, "0037862000000502bfffffb6205af0bf9548cffffff80820000038bb8200"},
+		'°':  {11, 2, -17, 7, 8, "003430009fff908e606e8c80008cd80008d9e303e91cfffc10068600"},
+		'À':  {15, 0, -21, 15, 21, "000007800000000000006f800000000000006f5000000000000077000000000000000000000000000dfe000000000005fff60000000000afbfa0000000001fe1ef2000000007f909f800000000cf503fd00000003fd000df40000009f80007f9000000ef20002fe100006fc00000bf60000afffffffffc0002fffffffffff2008fa00000009f800df600000005fd04fe100000000ef59f90000000008fa"},
+		'Á':  {15, 0, -21, 15, 21, "00000000870000000000008f6000000000005f7000000000000770000000000000000000000000000dfe000000000005fff60000000000afbfa0000000001fe1ef2000000007f909f800000000cf503fd00000003fd000df40000009f80007f9000000ef20002fe100006fc00000bf60000afffffffffc0002fffffffffff2008fa00000009f800df600000005fd04fe100000000ef59f90000000008fa"},
+		'Â':  {15, 0, -21, 15, 21, "000000585000000000003fdf40000000001e909e20000000057000750000000000000000000000000dfe000000000005fff60000000000afbfa0000000001fe1ef2000000007f909f800000000cf503fd00000003fd000df40000009f80007f9000000ef20002fe100006fc00000bf60000afffffffffc0002fffffffffff2008fa00000009f800df600000005fd04fe100000000ef59f90000000008fa"},
+		'Ã':  {15, 0, -21, 15, 21, "00000330014000000008ffd58e00000000f729ff60000000000000000000000000000000000000000dfe000000000005fff60000000000afbfa0000000001fe1ef2000000007f909f800000000cf503fd00000003fd000df40000009f80007f9000000ef20002fe100006fc00000bf60000afffffffffc0002fffffffffff2008fa00000009f800df600000005fd04fe100000000ef59f90000000008fa"},
+		'Ä':  {15, 0, -21, 15, 21, "0000000000000000000bf808fb00000000bf808fb0000000000000000000000000000000000000000dfe000000000005fff60000000000afbfa0000000001fe1ef2000000007f909f800000000cf503fd00000003fd000df40000009f80007f9000000ef20002fe100006fc00000bf60000afffffffffc0002fffffffffff2008fa00000009f800df600000005fd04fe100000000ef59f90000000008fa"},
+		'Å':  {15, 0, -21, 15, 21, "000000383000000000009fff90000000003f504f4000000008f000d8000000003f403f50000000009fdf900000000005fff60000000000afbfa0000000001fe1ef2000000007f909f800000000cf503fd00000003fd000df40000009f80008f9000000ef30002fe100006fc00000bf60000afffffffffc0002fffffffffff2008fa00000009f800df600000005fd04fe100000000ef59f90000000008fa"},
+		'Æ':  {21, 0, -17, 21, 17, "0000000000000000000000000006ffffffffffffb0000000dfccfebbbbbbb80000004fe04fb00000000000000af804fb00000000000002ff204fb00000000000008f9004fb0000000000000ef4004fd8888888400006fd0004fffffffff80000bf60004fc444444420003fe10004fb000000000009ffffffffb00000000001effffffffb00000000007fb000004fb0000000000df6000004fb0000000005fd0000004febbbbbbbb0af80000004ffffffffff0"},
+		'Ç':  {15, 1, -17, 14, 22, "0000004444000000029efffffa40005efe9888dff303ef91000004d40bfa00000000123ff200000000008fc00000000000bf900000000000bf800000000000bf800000000000af9000000000008fc000000000003ff200000000000bfa000000001203ef91000004d4004efea888dff300029efffff93000000037f6000000000000c9000000000412db000000000bfff6000000000044100000"},
+		'È':  {14, 2, -21, 11, 21, "003850000000009f4000000000ce100000000185000000000000000bfffffffff4bfcbbbbbbb3bf400000000bf400000000bf400000000bf400000000bf988888880bfffffffff0bf744444440bf400000000bf400000000bf400000000bf400000000bf400000000bfcbbbbbbb6bfffffffff8"},
+		'É':  {14, 2, -21, 11, 21, "0000038500000001ce100000009e300000001840000000000000000bfffffffff4bfcbbbbbbb3bf400000000bf400000000bf400000000bf400000000bf988888880bfffffffff0bf744444440bf400000000bf400000000bf400000000bf400000000bf400000000bfcbbbbbbb6bfffffffff8"},
+		'Ê':  {14, 2, -21, 11, 21, "000078300000008ecd1000006f61cb0000075001830000000000000bfffffffff4bfcbbbbbbb3bf400000000bf400000000bf400000000bf400000000bf988888880bfffffffff0bf744444440bf400000000bf400000000bf400000000bf400000000bf400000000bfcbbbbbbb6bfffffffff8"},
+		'Ë':  {14, 2, -21, 11, 21, "0000000000000ff40bf80000ff40bf8000000000000000000000000bfffffffff4bfcbbbbbbb3bf400000000bf400000000bf400000000bf400000000bf988888880bfffffffff0bf744444440bf400000000bf400000000bf400000000bf400000000bf400000000bfcbbbbbbb6bfffffffff8"},
+		'Ì':  {6, 0, -21, 5, 21, "2860009f5000ae2001850000000bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf4"},
+		'Í':  {6, 1, -21, 5, 21, "0028500ce308e3018500000000bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf400bf40"},
+		'Î':  {6, -1, -21, 8, 21, "00078300008fde1005f61cc00750018300000000000bf400000bf400000bf400000bf400000bf400000bf400000bf400000bf400000bf400000bf400000bf400000bf400000bf400000bf400000bf400000bf400"},
+		'Ï':  {6, 0, -21, 7, 21, "0000000ff40bf8ff40bf80000000000000000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf40000bf400"},
+		'Ð':  {17, 0, -17, 16, 17, "000000000000000000bffffffc95000000bfdbbbcfffc30000bf8000006dfe3000bf80000001cfb000bf800000004ff300bf800000000cf800bf8000000009faffffffff000008fb88dfb888000008fb00bf800000000afa00bf800000000df800bf800000004ff300bf80000001cfb000bf8000016dfe3000bfdbbbdfffb30000bffffffb840000"},
+		'Ñ':  {16, 2, -21, 13, 21, "0000420023000000cffa4ca000004f34bfe300000000000000000000000000000bff6000000bf4bffd000000bf4bfef700000bf4bf8fe10000bf4bf4bf80000bf4bf43fe1000bf4bf409f8000bf4bf402ff200bf4bf4009f900bf4bf4002ef20bf4bf40008f90bf4bf40001ef4bf4bf400008fbbf4bf400001efef4bf4000006fff4bf4000000dff4"},
+		'Ò':  {17, 1, -21, 16, 22, "0000078100000000000003eb000000000000005f70000000000000058000000000000144420000000003afffffd50000006efd888cff900003ff9000005ef8000bfa00000007ff203ff200000000df808fc0000000008fc0bf90000000004ff0bf80000000004ff0bf80000000004ff0af90000000004ff08fc0000000008fc03ff200000000df800bfa00000007ff2003ff9000006ff800006efd888cff90000002afffffc500000000014442000000"},
+		'Ó':  {17, 1, -21, 16, 22, "000000007810000000000007f70000000000003e90000000000000570000000000000144420000000003afffffd50000006efd888cff900003ff9000005ef8000bfa00000007ff203ff200000000df808fc0000000008fc0bf90000000004ff0bf80000000004ff0bf80000000004ff0af90000000004ff08fc0000000008fc03ff200000000df800bfa00000007ff2003ff9000006ff800006efd888cff90000002afffffc500000000014442000000"},
+		'Ô':  {17, 1, -21, 16, 22, "0000004870000000000002ebf600000000001cc06f300000000038100570000000000144420000000003afffffd50000006efd888cff900003ff9000005ef8000bfa00000007ff203ff200000000df808fc0000000008fc0bf90000000004ff0bf80000000004ff0bf80000000004ff0af90000000004ff08fc0000000008fc03ff200000000df800bfa00000007ff2003ff9000006ff800006efd888cff90000002afffffc500000000014442000000"},
+		'Õ':  {17, 1, -21, 16, 22, "000002400141000000006ffd68f200000000b818ef800000000000000000000000000144420000000003afffffd50000006efd888cff900003ff9000005ef8000bfa00000007ff203ff200000000df808fc0000000008fc0bf90000000004ff0bf80000000004ff0bf80000000004ff0af90000000004ff08fc0000000008fc03ff200000000df800bfa00000007ff2003ff9000006ff800006efd888cff90000002afffffc500000000014442000000"},
+		'Ö':  {17, 1, -21, 16, 22, "000000000000000000008fb04fb0000000008fb04fb00000000000000000000000000144420000000003afffffd50000006efd888cff900003ff9000005ef8000bfa00000007ff203ff200000000df808fc0000000008fc0bf90000000004ff0bf80000000004ff0bf80000000004ff0af90000000004ff08fc0000000008fc03ff200000000df800bfa00000007ff2003ff9000006ff800006efd888cff90000002afffffc500000000014442000000"},
+		'×':  {18, 3, -14, 13, 14, "00000000000006c100000006c09fc1000006fe209fc10006fe30009fc106fe3000009fc7fe300000009ffe3000000006ffc100000006feafc1000006fe309fc10006fe30009fc106fe3000009fc19e300000009c10200000000010"},
+		'Ø':  {17, 1, -17, 16, 18, "00000144420003600003afffffc51dd0006efd888cffee3003ff9000006ff8000bfa0000008fff203ff2000006f9df808fc000003ea08fc0bf900002ec104ff0bf80001ce2004ff0bf8000ae30004ff0af9009f600004ff08fc06f8000008fc03ff6f9000000df800bffc0000007ff2004ff9100006ff8000ceefe888cff90008f429fffffc500003600004442000000"},
+		'Ù':  {16, 1, -21, 14, 22, "0000385000000000000ce3000000000001cc10000000000028300000000000000000000ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff20000000ff40ff40000002ff10bf80000006fd006fe300002ef80009ff9889efc000008effffe810000000344400000"},
+		'Ú':  {16, 1, -21, 14, 22, "000000038400000000001ec10000000000be10000000000383000000000000000000000ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff20000000ff40ff40000002ff10bf80000006fd006fe300002ef80009ff9889efc000008effffe810000000344400000"},
+		'Û':  {16, 1, -21, 14, 22, "0000018810000000000aecc0000000008e33e9000000018300381000000000000000000ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff20000000ff40ff40000002ff10bf80000006fd006fe300002ef80009ff9889efc000008effffe810000000344400000"},
+		'Ü':  {16, 1, -21, 14, 22, "000000000000000004ff00ff40000004ff00ff400000000000000000000000000000000ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff00000000ff40ff20000000ff40ff40000002ff10bf80000006fd006fe300002ef80009ff9889efc000008effffe810000000344400000"},
+		'Ý':  {13, -1, -21, 15, 21, "00000000781000000000005f8000000000002e90000000000005810000000000000000000000afa00000004fe201ef5000001df70005fe100008fb00000afa0004fe2000001ef501df700000005fe18fb000000000afcfe20000000001dff7000000000005fc0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb0000000000004fb000000"},
+		'Þ':  {13, 2, -17, 11, 17, "00000000000bf400000000bf400000000bf744410000bffffffd700bf9888cff80bf400008ff2bf400000ef7bf400000bf8bf400000df8bf400006ff3bf98889ffa0bfffffff810bf744441000bf400000000bf400000000bf400000000"},
+		'ß':  {14, 1, -17, 12, 18, "00048bb8200000afffffe50008fc2006fe100df400008f500ff00017df800ff001cf95200ff009f700000ff00bf200000ff00bf700000ff005ff81000ff0006efd300ff00001afe30ff0000008fa0ff0000004fb0ff0000006fb0ff098748ef50ff0affffe60000002444000"},
+		'à':  {13, 1, -18, 11, 19, "00881000000006f90000000007f60000000009e30000000007600000002444000008effffe8000bc8668ef8002000001ef1000000008f500168888bf806efffffff84fe610008f88f7000008f8bf400000df88f900008ff83ff957bfbf806efffe58f800044400000"},
+		'á':  {13, 1, -18, 11, 19, "00000038500000001de30000000ae300000007f60000000085000000002444000008effffe8000bc8668ef8002000001ef1000000008f500168888bf806efffffff84fe610008f88f7000008f8bf400000df88f900008ff83ff957bfbf806efffe58f800044400000"},
+		'â':  {13, 1, -18, 11, 19, "000058300000002fed1000000bc4e8000007e306f300007500075000002444000008effffe8000bc8668ef8002000001ef1000000008f500168888bf806efffffff84fe610008f88f7000008f8bf400000df88f900008ff83ff957bfbf806efffe58f800044400000"},
+		'ã':  {13, 1, -18, 11, 19, "00000000000006fe608e0000e98f8ca0003f406ec200000000000000002444000008effffe8000bc8668ef8002000001ef1000000008f500168888bf806efffffff84fe610008f88f7000008f8bf400000df88f900008ff83ff957bfbf806efffe58f800044400000"},
+		'ä':  {13, 1, -17, 11, 18, "008b306b60000bf408f80000682048400000000000000002444000008effffe8000bc8668ef8002000001ef1000000008f500168888bf806efffffff84fe610008f88f7000008f8bf400000df88f900008ff83ff957bfbf806efffe58f800044400000"},
+		'å':  {13, 1, -20, 11, 21, "000034200000009fff6000006f408f200008b000f400007e104f300001cebf9000000178600000002444000008effffe8000bc8668ef8002000001ef1000000008f500168888bf806efffffff84fe610008f88f7000008f8bf400000df88f900008ff83ff957bfbf806efffe58f800044400000"},
+		'æ':  {22, 1, -13, 20, 14, "0002444000002443000008effffe803bffffd4000bc8668efaefa769ff4002000001eff600006fd0000000008fb000000cf300168888bf80000008f606effffffffffffffff84fe610008fa8888888848f7000008f8000000000bf400000dfd0000000008f900008fff9000000403ff957bf93efb8468df005efffe8002afffffd8000044410000014442000"},
+		'ç':  {12, 1, -13, 10, 18, "0000244400003bfffff805ffb758ab1ef70000017fb0000000af80000000bf40000000bf40000000af800000006fc00000001ef700000105ffb858bb003bfffff8000024e8000000008e00000121af000004fff9000000343000"},
+		'è':  {14, 1, -18, 12, 19, "003850000000000af40000000001ce10000000001db00000000003830000000024430000003bffffd30004ff9769fe301ef600006fb06f9000000df29f7000000af4bffffffffff4bf9888888882af70000000007fb0000000001ef80000004003efb8588df0003bfffffd80000014442000"},
+		'é':  {14, 1, -18, 12, 19, "0000000683000000005f9000000002ec100000000cc10000000038300000000024430000003bffffd30004ff9769fe301ef600006fb06f9000000df29f7000000af4bffffffffff4bf9888888882af70000000007fb0000000001ef80000004003efb8588df0003bfffffd80000014442000"},
+		'ê':  {14, 1, -18, 12, 19, "00000880000000008ff800000003f88f3000000cb00bc000003810018300000024430000003bffffd30004ff9769fe301ef600006fb06f9000000df29f7000000af4bffffffffff4bf9888888882af70000000007fb0000000001ef80000004003efb8588df0003bfffffd80000014442000"},
+		'ë':  {14, 1, -17, 12, 18, "003bb00bb300004ff00ff400002880088200000000000000000024430000003bffffd30004ff9769fe301ef600006fb06f9000000df29f7000000af4bffffffffff4bf9888888882af70000000007fb0000000001ef80000004003efb8588df0003bfffffd80000014442000"},
+		'ì':  {6, -1, -18, 6, 18, "38600009f50000ce20001cc0000283000000000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0"},
+		'í':  {6, 1, -18, 6, 18, "000583004fb001ec100be1003830000000000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff0000ff000"},
+		'î':  {6, -1, -18, 8, 18, "00088100007ff80002e87f400bc00ad02820018300000000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000"},
+		'ï':  {6, -1, -17, 8, 17, "3bb00bb34ff00ff4288008820000000000000000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000000ff000"},
+		'ð':  {13, 1, -17, 12, 18, "004ba10003000009fc59ed000005eff8300007ed8cf90000043001df70000006abdff50001cffccffe100bfc2001bf805fd100005fd09f8000000ff2bf5000000cf4bf4000000bf4af7000000ff37fa000004fe01ef60001cf8006ff968dfc10005dffff9100000034410000"},
+		'ñ':  {14, 1, -18, 12, 18, "0000000000000009fd30ba00003f7ae8e700007f008fa0000000000000000000024410000ff1affff8000ffbd888ff600ffc10007fc00ff500001ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff00ff000000ff0"},
+		'ò':  {13, 1, -18, 12, 19, "005830000000001de10000000003eb00000000004f800000000005810000000044410000006effff910006ff957dfc102ef60001cf807fb000005fe0af7000000ff3bf4000000cf4bf4000000cf4af7000000ff27fb000005fe01ef60001cf8006ff968dfc10005dffff9100000034410000"},
+		'ó':  {13, 1, -18, 12, 19, "0000000881000000008f6000000005f8000000002e900000000058100000000044410000006effff910006ff957dfc102ef60001cf807fb000005fe0af7000000ff3bf4000000cf4bf4000000cf4af7000000ff27fb000005fe01ef60001cf8006ff968dfc10005dffff9100000034410000"},
+		'ô':  {13, 1, -18, 12, 19, "0000286000000000bff400000007f4bd1000002e801e8000005700048000000044410000006effff910006ff957dfc102ef60001cf807fb000005fe0af7000000ff3bf4000000cf4bf4000000cf4af7000000ff27fb000005fe01ef60001cf8006ff968dfc10005dffff9100000034410000"},
+		'õ':  {13, 1, -18, 12, 19, "000000000000002df901f400009d5ebae10000b803be6000000000000000000044410000006effff910006ff957dfc102ef60001cf807fb000005fe0af7000000ff3bf4000000cf4bf4000000cf4af7000000ff27fb000005fe01ef60001cf8006ff968dfc10005dffff9100000034410000"},
+		'ö':  {13, 1, -17, 12, 18, "006b803bb000008fb04ff000004860288000000000000000000044410000006effff910006ff957dfc102ef60001cf807fb000005fe0af7000000ff3bf4000000cf4bf4000000cf4af7000000ff27fb000005fe01ef60001cf8006ff968dfc10005dffff9100000034410000"},
+		'÷':  {18, 2, -13, 15, 12, "000000442000000000000ff8000000000000ff80000000000008840000000000000000000008bbbbbbbbbbbbb0bfffffffffffff0000000000000000000000442000000000000ff8000000000000ff8000000000000884000000"},
+		'ø':  {13, 0, -14, 13, 16, "000000000000000000444100b60006effff99e3006ff958dff6002ef60005ff8007fb0003ebfe00af8001cc0ff30bf400be10bf40bf408e300cf40af76f6000ff207fcf80005fe001efa0001cf8001dff868dfc1009e7dffff91001b300344100000000000000000"},
+		'ù':  {14, 1, -18, 11, 19, "00584000000001ce2000000002ec1000000003e9000000000481000000000000004fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff2fc000001ff0ff000005ff0df70001dff06ff888ebff008ffff91ff00014420000"},
+		'ú':  {14, 1, -18, 11, 19, "000000078100000008f800000004f900000001ec000000005810000000000000004fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff2fc000001ff0ff000005ff0df70001dff06ff888ebff008ffff91ff00014420000"},
+		'û':  {14, 1, -18, 11, 19, "000018700000000aff50000005f5ae100001e801da0000480003810000000000004fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff2fc000001ff0ff000005ff0df70001dff06ff888ebff008ffff91ff00014420000"},
+		'ü':  {14, 1, -17, 11, 18, "003b803bb00004fb04ff000028602880000000000000000000000004fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff4fb000000ff2fc000001ff0ff000005ff0df70001dff06ff888ebff008ffff91ff00014420000"},
+		'ý':  {13, 0, -18, 13, 23, "00000002870000000000ce30000000008f60000000005f700000000007700000000000000000002fe0000000ef20af6000006fb005fb00000bf6000df20002fe00008f80008f800001fe000ef2000009f606fb0000004fb0bf60000000df4fe000000007fff8000000001eff20000000009fb0000000000bf60000000002fd0000000002cf800000004fffc00000000288610000000"},
+		'þ':  {14, 1, -17, 12, 22, "0bb0000000000ff0000000000ff0000000000ff0000000000ff0034410000ff1bfffe7000ffcd758ff700ffd10004fe10ff600000af70ff2000007fa0ff0000004fb0ff0000004fb0ff2000007fa0ff600000af70ffd10004fe10ffcd858ff700ff1bfffe7000ff0024410000ff0000000000ff0000000000ff000000000088000000000"},
+		'ÿ':  {13, 0, -17, 13, 22, "0008b606b8000000bf808fb0000006840486000000000000000000000000000002fe0000000ef20af6000006fb005fb00000bf6000df20002fe00008f80008f800001fe000ef2000009f606fb0000004fb0bf60000000df4fe000000007fff8000000001eff20000000009fb0000000000bf60000000002fd0000000002cf800000004fffc00000000288610000000"},
+		'–':  {11, 1, -7, 9, 2, "bbbbbbbbbbbbbbbbbb"},
+		'—':  {22, 1, -7, 20, 2, "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb"},
+		'‘':  {7, 1, -17, 5, 7, "00000009d002f9009f602ff404ff4014410"},
+		'’':  {7, 1, -17, 5, 7, "0000004ff004ff007f900af200e80000000"},
+		'“':  {11, 1, -17, 9, 7, "000000000009d004f502f900bf009f604fb02ff40af804ff40bf80144103420"},
+		'”':  {11, 1, -17, 9, 7, "00000000004ff00bf804ff00bf807f900fe20af204f800e9008e10041003300"},
+		'…':  {22, 2, -3, 18, 3, "6b800003bb300008b68fb00004ff40000bf88fb00004ff40000bf8"},
+		'•':  {13, 3, -12, 7, 8, "003430009fff906fffff6bfffffa9fffff94fffff405dfd500000000"},
+		'€':  {14, 0, -17, 13, 18, "0000001444000000018ffffe800001cfe888cf8000afc1000078002ff20000001008fa0000000048dfb888884009bffcbbbbb40000ff40000000000ff4000000009fffffffd000078dfb88840000008fa00000000002ff200000010009fc10000780001cfe888df8000018efffe800000000444000"},
+		'£':  {14, 1, -17, 12, 17, "00000044410000006effff900004ff988ab0000af8000010000ff4000000000ff1000000000ff0000000000ff0000000144ff44441004ffffffff400144ff4444100000ff0000000000ff0000000000ff0000000000ff00000006bbffbbbbbb08ffffffffff0"},
+	},
+}
+
+// Sans26 is DejaVu Sans at 26 pixels, the size of the firmware's FONT_26
+var Sans26 = &Face{
+	Height: 30,
+	Ascent: 24,
+	glyphs: map[rune]glyph{
+		' ':  {8, 0, 0, 0, 0, ""},
+		'!':  {10, 3, -19, 4, 19, "0ff80ff80ff80ff80ff80ff80ff80ff80ff80ff80ff60ef40bf40000000004420ff80ff80ff8"},
+		'"':  {12, 2, -19, 8, 8, "8fb00bf88fb00bf88fb00bf88fb00bf88fb00bf88fb00bf88fb00bf800000000"},
+		'#':  {22, 2, -19, 18, 19, "00000008b4000bb1000000000ef2003fd0000000003fd0007f90000000007f9000af6000000000af6000ef2000048888ef9888ff888608fffffffffffffffb04888bfb888df9888600000af6000ef2000000000ef2003fd0000000003fd0007f90000044448fb444bf844410ffffffffffffffff40bbbbffbbbcfebbbb300003fd0007f90000000007f9000af6000000000af6000ef2000000000ef2003fd0000000003fd0007f90000000"},
+		'$':  {17, 2, -20, 13, 24, "0000068000000000008b000000000008b0000000017adeba840006effffffff404ffa38b148d40afb008b000010bf8008b000000bf9008b0000008ff718b0000001cfffdd730000018efffffd50000003aecfff60000008b02cff2000008b002ff4000008b000ff5200008b004ff3bb5108b05efc0bfffddefffc10059bfffea6000000008b000000000008b000000000008b0000000000068000000"},
+		'%':  {25, 1, -20, 23, 21, "0002440000000000341000001afffe600000004fc000000afc57ef5000000cf4000003fe1006fc000007f90000007f80000ff10001ee10000008f80000bf40009f700000008f80000cf4004fc000000006f90001ff000cf3000000002ff3008fa007f800000000008fe9bfe301ee1000000000006dffa3009f6004afea3000000000004fb006ffbcfe30000000000cf300ef4008fb0000000008f8005fc0000ff100000002ee1008f80000bf40000000af60008f80000bf40000004fb00006fa0000df3000000df300002fe1004fd0000008f80000009fc55ef7000002ee10000001affff80000002420000000003442000"},
+		'&':  {20, 1, -20, 19, 21, "000000344300000000000004dffffe920000000005fffbbdff4000000000dfc2000294000000003ff50000000000000004ff40000000000000000ef900000000000000008ff60000000000000004ffe300000000000003efefe3000000342002ef91efe300000cf800bfc003efe30000ff502ff60003efe3005ff104ff200003efe309f9004ff2000003efe5ff2004ff60000003efff80000efd10000004fff300006ffc400004cfffe300008fffcbbdffc6efe200005cfffffd8003efc10000024443000000000"},
+		'\'': {7, 2, -19, 3, 8, "8fb8fb8fb8fb8fb8fb8fb000"},
+		'(':  {10, 2, -20, 7, 24, "0002b90000bf60004fd0000bf70003ff10009fa0000ef70003ff30007ff00008fc0000bfb0000bfb0000bfb0000bfb00008fd00006ff00002ff40000df800007fc00002ff200009f900002fe100008f800001880"},
+		')':  {10, 2, -20, 6, 24, "8b40004fd0000bf60005fd0000df60008fa0005ff1000ff6000cf8000bfb0008fc0008ff0008fe000afb000bfb000df8002ff5006fe0009f9001ff4007fb000df4006fa000782000"},
+		'*':  {13, 0, -20, 13, 13, "0000014100000000004f400000000004f4000000b8004f4008b018fd44f44df810029fcfcf920000003efe300000006defed600004df85f58fd401eb304f403be1020004f400020000004f4000000000028200000"},
+		'+':  {22, 2, -17, 18, 17, "00000001440000000000000004ff0000000000000004ff0000000000000004ff0000000000000004ff0000000000000004ff0000000000000004ff0000000014444447ff444444404ffffffffffffffff04ffffffffffffffff000000004ff0000000000000004ff0000000000000004ff0000000000000004ff0000000000000004ff0000000000000004ff0000000000000004ff00000000"},
+		',':  {8, 2, -4, 4, 8, "04430ffb0ffb1ff86fd19f60dd000000"},
+		'-':  {9, 1, -9, 8, 3, "34444440bffffff0bffffff0"},
+		'.':  {8, 2, -4, 4, 4, "14424ff84ff84ff8"},
+		'/':  {9, 0, -19, 9, 22, "0000008f9000000df5000002ff0000007fa000000cf6000001ff1000006fc000000af7000001ff2000005fd0000009f8000000ef3000004fd0000008f9000000df5000003fe0000007fa000000cf6000002ff1000006fb000000af7000000882000000"},
+		'0':  {17, 1, -20, 14, 21, "0000014430000000019ffffd7000002effcbeff80000bfe40019ff4004ff700000dfc009fe0000006ff30efa0000002ff71ff80000000ff94ff60000000bfb4ff40000000bfb4ff40000000bfb4ff40000000bfb4ff60000000bfb1ff80000000ff90ef90000002ff70afe0000006ff305ff600000dfd000cfe30009ff50003effbbdff9000003bffffe800000000244400000"},
+		'1':  {17, 2, -19, 13, 19, "0368bfff000004fffffff000004ffb8bff00000130008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000034449ff444410bffffffffff40bffffffffff4"},
+		'2':  {17, 1, -20, 13, 20, "0000244410000038dfffffb4000fffffcffff600fc620006eff30400000004ff90000000000cfb0000000000bfb0000000000efa0000000007ff6000000003efb000000001cfe200000001cfe300000001cfe300000001cfe300000001cff500000001cff600000001cff600000000cff9444444440ffffffffffff0ffffffffffff"},
+		'3':  {17, 1, -20, 14, 21, "0000244420000004befffffd800008ffffbffffc10068400002aff800000000000dfd000000000008ff000000000008fe00000000001ef90000034447efc100000bfffff71000000bfffffe700000000003aff800000000000aff200000000004ff600000000000ff800000000004ff60000000000aff20b6100002affa00fffdbbefffc1009dffffffd800000024444200000"},
+		'4':  {17, 1, -19, 15, 19, "00000003fff80000000000cfff80000000008fdff8000000002ee6ff800000000bf74ff800000007fb04ff80000002ef204ff8000000bf8004ff8000007fc0004ff800002ef40004ff80000bf800004ff80005fd100004ff8000bfa888889ffb880bfffffffffffff0688888889ffb880000000004ff8000000000004ff8000000000004ff8000000000004ff8000"},
+		'5':  {17, 2, -19, 13, 20, "4fffffffffb004fffffffffb004ff74444443004ff40000000004ff40000000004ff40000000004ff78885100004fffffffe80004febbbcfff90025000002cff70000000001efd00000000008ff20000000004ff40000000005ff40000000008ff2000000003efd0b6100006eff50fffdbbffff800aeffffffc50000034444200000"},
+		'6':  {17, 1, -20, 14, 21, "00000004442000000029fffffd800003efffdeffb0003efd5000158000bfd10000000004ff600000000009fe00000000000dfa01688510000ff87effffe7003ffdff989eff804fffe30001cff24fff6000002ff81fff0000000cfb0ffc0000000bfe0cfc0000000bfe08ff1000000dfb02ff7000004ff700afe40003efe1001cffcbbfff5000019fffffb30000000144420000"},
+		'7':  {17, 2, -19, 13, 19, "bfffffffffff4bfffffffffff3344444444efc0000000004ff60000000009ff1000000001ff90000000006ff4000000000cfd0000000003ff80000000009ff2000000000efa0000000006ff6000000000bfe0000000002ff80000000008ff2000000000dfc0000000005ff60000000009fe1000000001ff90000000"},
+		'8':  {17, 1, -20, 14, 21, "000002444100000007dfffffa300009fffbbdffe3006ffb10005efd00aff1000008ff30bfb0000004ff40bfc0000004ff406ff300000afe000bfe61039ff500008dfffffa300002affffffd70003efc50028ff900bfd1000007ff42ff80000000ef94ff40000000bfb4ff70000000dfb0ffb0000004ff809ff910003eff201cffebbcfff600019efffffd50000000444420000"},
+		'9':  {17, 1, -20, 14, 21, "000003442000000007dffffc4000009ffebbfff60007ff91001aff300dfd000001df903ff70000008ff14ff40000004ff54ff40000004ff84ff50000007ff91ff9000000bffb09ff600006fffb01effa88bfedfb002bfffffd3ff800003888502ff700000000006ff30000000000bfd00000000006ff60037200018ffb0004ffdbcfffc10002cfffffe8000000014443000000"},
+		':':  {9, 3, -14, 3, 14, "886ffbffbbb8000000000000000000443ffbffbffb"},
+		';':  {9, 2, -14, 4, 18, "08860ffb0ffb0bb800000000000000000000000004430ffb0ffb1ff86fd19f60dd000000"},
+		'<':  {22, 2, -16, 18, 15, "0000000000000000000000000000000038d00000000000027cfff00000000016affffb6000000059ffffc7200000038efffd8300000017dfffe930000000004fff950000000000004fffe9300000000000038dfffd8200000000000059efffc720000000000006affffb610000000000017cffffa000000000000028dff0000000000000000490"},
+		'=':  {22, 2, -12, 18, 8, "3bbbbbbbbbbbbbbbb04ffffffffffffffff01444444444444444400000000000000000000000000000000000003bbbbbbbbbbbbbbbb04ffffffffffffffff0288888888888888880"},
+		'>':  {22, 2, -16, 18, 15, "0000000000000000004d72000000000000004fffb610000000000017cffff9500000000000038dfffe8300000000000049efffd720000000000005affffb600000000000016bfff00000000000059ffff00000000049efffc7200000038dfffd8300000027dfffe9500000002cffffa610000000004ffc72000000000000383000000000000000"},
+		'?':  {14, 1, -20, 11, 20, "00004442000049fffffb303fffdbeffe24f820007ffa22000000cfe000000008ff00000001dfa00000009ff40000009ff60000009ff60000006ff60000000cfb00000000ff800000000ff800000000ff8000000000000000000044200000000ff800000000ff800000000ff80000"},
+		'@':  {26, 1, -19, 24, 24, "00000000003444200000000000000005affffffd82000000000003cffda888bfff81000000006ffb400000016dfc10000006fe5000000000019fc100003fe300000000000009f80000cf5000027883024200cf4006f900006fffffa8f8005f900af30005ff9559fff8000ee00fd0000df700007ff8000bf23f90003fe000000df8000bf44f80004fb0000009f8000bf34f80004fb0000008f8000df04f80004fc000000bf8003fa00fc0000ef400003ff801cf400cf20008fe4004cff84cf80007f80001cfffffeaffff800001ee200007bdb818db720000007fc10000000000000000000009fc10000000000020000000009fe7000000005de20000000008ffe984468dff91000000000029efffffff94000000000000000478884100000000"},
+		'A':  {18, 0, -19, 18, 19, "0000000bff800000000000002fffd00000000000008fdff5000000000000df8cf9000000000004ff36ff100000000009fc01ff70000000001ff7009fc0000000006ff1005ff300000000cfa0000df800000002ff600008fe00000008fe000003ff6000000ef9000000cfa000005ffffffffffff20000affffffffffff70002ff844444444bfd0007ff2000000006ff400dfc0000000000ef903ff700000000009fe19ff200000000005ff6"},
+		'B':  {18, 2, -19, 14, 19, "8fffffffda60008ffffffffffc108ff444445bff908ff0000000bff18ff00000007ff48ff00000007ff38ff0000000bfe08ff444445bff608fffffffffc4008ffffffffffa108ff0000006dfd18ff00000003ff88ff00000000cfd8ff00000000bff8ff00000000cff8ff00000004ffa8ff0000148eff48fffffffffff608ffffffffb8200"},
+		'C':  {18, 1, -20, 16, 21, "0000000144430000000018dfffffe9400003dfffebbffff8003eff82000039fb01efe3000000004a08ff7000000000000efd0000000000003ff80000000000007ff50000000000008ff40000000000008ff40000000000008ff40000000000007ff40000000000004ff80000000000000efd00000000000008ff50000000000001efe30000000038004ffe81000029fb0005efffcbbdfff8000018effffffa400000000344440000"},
+		'D':  {20, 2, -19, 17, 19, "8ffffffeb961000008fffffffffff910008ff4444458effe3008ff000000018ffd108ff0000000008ff808ff0000000001efd08ff00000000009ff38ff00000000006ff58ff00000000004ff88ff00000000004ff88ff00000000004ff88ff00000000006ff58ff00000000008ff38ff0000000001efe08ff0000000008ff808ff000000008ffd108ff0001448dffe3008fffffffffff910008fffffffca7200000"},
+		'E':  {16, 2, -19, 13, 19, "8fffffffffff88fffffffffff88ff44444444428ff00000000008ff00000000008ff00000000008ff00000000008ff44444444418fffffffffff48fffffffffff48ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff44444444438fffffffffffb8fffffffffffb"},
+		'F':  {15, 2, -19, 12, 19, "8ffffffffff88ffffffffff88ff4444444428ff0000000008ff0000000008ff0000000008ff0000000008ff4444444308fffffffffb08fffffffffb08ff0000000008ff0000000008ff0000000008ff0000000008ff0000000008ff0000000008ff0000000008ff0000000008ff000000000"},
+		'G':  {20, 1, -20, 18, 21, "000000014444000000000017cffffffc81000003dffffbbefffe50003eff83000027df8001efe300000000088008ff600000000000000efd000000000000003ff8000000000000007ff5000000000000008ff4000000000000008ff4000000bffffff08ff4000000bffffff07ff400000034449ff04ff800000000008ff00efc00000000008ff009ff50000000008ff001efe3000000008ff0005ffe82000004cff00005efffdbbbffff80000018dffffffd8200000000024444200000"},
+		'H':  {20, 2, -19, 15, 19, "8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff4444444449ff8ffffffffffffff8ffffffffffffff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff8ff0000000008ff"},
+		'I':  {8, 2, -19, 4, 19, "8ff08ff08ff08ff08ff08ff08ff08ff08ff08ff08ff08ff08ff08ff08ff08ff08ff08ff08ff0"},
+		'J':  {8, -2, -19, 8, 25, "00008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff000008ff00000dfc00019ff804ffffc104fff910014300000"},
+		'K':  {17, 2, -19, 16, 19, "8ff00000001cff608ff0000001cff6008ff000002cff60008ff00003efe500008ff0003efe3000008ff003efe30000008ff04efe300000008ff6ffc2000000008ffffc10000000008ffffe30000000008ff6ffe3000000008ff06ffe300000008ff006ffe30000008ff0006ffe3000008ff00006ffe300008ff000006ffe30008ff0000006ffe3008ff00000006ffe308ff000000006ffe3"},
+		'L':  {14, 2, -19, 13, 19, "8ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff44444444418fffffffffff48fffffffffff4"},
+		'M':  {22, 2, -19, 18, 19, "8fff8000000002ffff8fffd000000007ffff8ffdf50000000dfdff8ff8f90000003fe8ff8ff2ff1000009f98ff8ff0cf600001ef38ff8ff06fc00006fd08ff8ff01ff2000bf708ff8ff009f8002ff208ff8ff005fd008fa008ff8ff000df50df6008ff8ff0008f94fe0008ff8ff0002ffaf90008ff8ff0000cfff30008ff8ff00006ffc00008ff8ff0000144200008ff8ff0000000000008ff8ff0000000000008ff8ff0000000000008ff"},
+		'N':  {19, 2, -19, 15, 19, "8fff400000008ff8fffb00000008ff8ffff40000008ff8ffbfd0000008ff8ff4ff6000008ff8ff0bfd000008ff8ff03ff600008ff8ff009fe10008ff8ff002ff80008ff8ff0009fe1008ff8ff0002ef8008ff8ff00008ff208ff8ff00001ef908ff8ff000008ff28ff8ff000001df98ff8ff0000006ffbff8ff0000000dffff8ff00000006ffff8ff00000000cfff"},
+		'O':  {20, 1, -20, 19, 21, "0000000344410000000000018efffffb4000000004efffcbefff90000004ffe710004bff900001efe300000009ff70008ff7000000001dfe100efd00000000006ff603ff800000000001ffa07ff500000000000dfd08ff400000000000bff08ff400000000000bff08ff400000000000bff07ff400000000000cfd04ff800000000001ffa00efd00000000006ff7009ff5000000000dfe1001efe300000009ff800005ffe600002affc0000006effebbcfffa1000000029efffffc6000000000000444420000000"},
+		'P':  {16, 2, -19, 13, 19, "8ffffffeb71008fffffffffe308ff44444affe18ff0000008ff78ff0000001ffb8ff0000000ffb8ff0000000ffb8ff0000005ff88ff000004eff48ffbbbbcfff908ffffffffd7008ff88864300008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff00000000008ff0000000000"},
+		'Q':  {20, 1, -20, 19, 24, "0000000344410000000000018efffffb4000000004efffcbefff90000004ffe710004bff900001efe300000009ff70008ff7000000001dfe100efd00000000006ff603ff800000000001ffa07ff500000000000dfd08ff400000000000bff08ff400000000000bff08ff400000000000bff07ff400000000000cfd04ff800000000001ffa00efd00000000006ff6009ff5000000000dfe1001efe300000009ff800005ffe600002affb0000006effebbcfffa1000000029effffff50000000000004449ff900000000000000009ff800000000000000009ff60000000000000000444000"},
+		'R':  {18, 2, -19, 16, 19, "8ffffffeb82000008fffffffffe600008ff444449ffe20008ff0000007ff80008ff0000001ffb0008ff0000000ffb0008ff0000000ffb0008ff0000007ff70008ff000248ffd10008fffffffffb200008ffffffffd5000008ff00003bff500008ff000001cfe10008ff0000004ff80008ff00000009fe1008ff00000002ff8008ff000000009fe108ff000000002ff808ff000000000aff2"},
+		'S':  {17, 1, -20, 15, 21, "0000024443000000018dffffffb70001cfffdbbffff0009ff81000038e001ff9000000001004ff5000000000004ff5000000000002ffb100000000000bffd840000000001cfffffc9400000018dffffffc30000000268cfffe200000000002cff9000000000001efe000000000000bff000000000000bff022000000001efc04f95000004cff604ffffbbbdfff90016afffffffd6000000034444200000"},
+		'T':  {16, -1, -19, 17, 19, "0ffffffffffffffff0ffffffffffffffff04444447ff744444400000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff4000000"},
+		'U':  {19, 2, -19, 15, 20, "bfb000000000bfbbfb000000000bfbbfb000000000bfbbfb000000000bfbbfb000000000bfbbfb000000000bfbbfb000000000bfbbfb000000000bfbbfb000000000bfbbfb000000000bfbbfb000000000bfbbfb000000000bfbbfd000000000bfb9ff000000000ffa7ff300000003ff82ffa00000009ff209ff8100018ffa001cfffbbbfffc100018efffffe8100000003444300000"},
+		'V':  {18, 0, -19, 18, 19, "9ff100000000005ff64ff700000000009fe10dfc0000000001ff9007ff3000000006ff4002ff800000000cfd0000afe00000002ff800006ff50000008ff200000efa000000dfa0000008ff100005ff60000003ff700009fe00000000cfc0001ff9000000007ff3006ff3000000001ff800cfc00000000009fe02ff700000000005ff58ff100000000000dfaefa0000000000008ffff50000000000002fffd00000000000000bff80000000"},
+		'W':  {26, 0, -19, 25, 19, "0ff80000000aff70000000dfb0bfc0000000effa0000002ff808ff1000003fdfd0000006ff404ff5000007f9df2000009ff000ff800000af69f600000dfb000bfc00000ef27f900002ff80008ff10003fd03fd00006ff40004ff50007fa00ef20008ff00000ff8000af700af6000cfb00000bfc000ef3007f9001ff8000008ff103fe0003fd005ff4000004ff507fa0000ef208ff0000000ff80af70000af60cfb0000000bfc0ef300007f91ff800000008ff4fe000004fd5ff400000004ffbfa000000ffaff000000000ffff7000000bfffb000000000bfff30000008fff80000000008ffe00000004fff40000"},
+		'X':  {18, 0, -19, 17, 19, "02efa000000008ff4007ff50000003ff80000bfe100000cfd100002efa00008ff40000007ff5003ff800000000bfe10cfd1000000002efa8ff400000000007ffff8000000000000bffd1000000000000cffb0000000000008ffff700000000004ff8bfe2000000001dfc02efb000000008ff3007ff50000004ff80000bfe100001dfc000002efa00008ff30000007ff5004ff800000000bfe11dfd0000000002efa"},
+		'Y':  {16, -1, -19, 17, 19, "0bfe1000000003ff902efa00000000cfd1007ff50000008ff40000bfe100003ff8000002efa0000cfd10000005ff7008ff400000000afe23ff80000000001efbcfd100000000005ffff4000000000000aff800000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff400000000000004ff4000000"},
+		'Z':  {18, 1, -19, 16, 19, "8ffffffffffffff48ffffffffffffff4244444444447ffd100000000001cfe300000000000aff6000000000008ff8000000000005ffa000000000003efc100000000001dfe300000000000bff5000000000008ff8000000000006ffa000000000003efc100000000001dfe200000000000cff4000000000009ff7000000000006ffc444444444443bffffffffffffffbbffffffffffffffb"},
+		'[':  {10, 2, -20, 6, 24, "8bbbb6bffff8bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bf8000bfb884bffff8688884"},
+		'\\': {9, 0, -19, 9, 22, "df50000008f90000004fe0000000ef30000009f80000005fd0000000ff2000000af70000006fc0000001ff1000000cf60000007fa0000002ff0000000df50000008f90000003fe0000000ef40000009f80000005fd0000000ef3000000af7000000486"},
+		']':  {10, 2, -20, 6, 24, "6bbbbb8fffff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff0008ff488bff8fffff488888"},
+		'^':  {22, 2, -19, 18, 8, "0000001cff90000000000001cffff900000000000aff69ff90000000009ff6009ff800000009fe400006ff6000009fe30000006ff60009fc3000000004ef60000000000000000000"},
+		'_':  {13, -1, 4, 15, 3, "3bbbbbbbbbbbbb34fffffffffffff4144444444444441"},
+		'`':  {13, 2, -21, 7, 5, "6ba10000af900001cf600001de300003ec1"},
+		'a':  {16, 1, -15, 13, 16, "000368885100005dffffffe60008fc8888dff600420000009fe10000000001ef50000000000bf80017beffffff803effffbbbef80dfc500000bf84ff2000000cf88ff0000002ff87ff1000008ff83ff900007fff80affd89dfbbf8019fffff81bf80002444100000"},
+		'b':  {17, 2, -20, 14, 21, "8b800000000000bfb00000000000bfb00000000000bfb00000000000bfb00000000000bfb00588720000bfb3dfffff8000bfcee888dff700bffe30000aff20bff6000001ef80bff00000009fc0bfb00000008ff0bfb00000004ff0bfb00000005ff0bfc00000008ff0bff1000000afb0bff8000002ff70bfff60001cfe10bfccfc8aeff500bfb1bffffd400000000244400000"},
+		'c':  {14, 1, -15, 12, 16, "0000158886200008effffff9009ffd8889eb08ff900000040efa000000004ff5000000008ff0000000008ff0000000008ff0000000008ff0000000003ff5000000000dfc0000000005ffa1000027008fffb8bcfb0005dfffffd7000002444300"},
+		'd':  {17, 1, -20, 14, 21, "00000000003bb300000000004ff400000000004ff400000000004ff400000000004ff400005887204ff4002cfffff84ff401cff988bfbff409ff300009fff41ff8000000dff45ff20000008ff48ff00000004ff48fc00000004ff48fc00000004ff48ff00000005ff44ff30000008ff40ef9000001eff408ff60001bfff400cffc8aef9ff40018ffffe64ff400002444000000"},
+		'e':  {16, 1, -15, 14, 16, "000015888400000008efffffc300009ffc888efe3007ff600001cfb00ef80000002ff34ff20000000cf88ff44444588df88ffffffffffff88ff888888888848ff000000000004ff500000000000dfc000000000005ffa200000490006fffb99beff00004bffffffc8000000144441000"},
+		'f':  {9, 0, -20, 10, 20, "000028bbb80003effffb000cfc5443000ff50000004ff40000247ff744408ffffffff0489ff98880004ff40000004ff40000004ff40000004ff40000004ff40000004ff40000004ff40000004ff40000004ff40000004ff40000004ff40000004ff40000"},
+		'g':  {17, 1, -15, 14, 21, "00005887201441003cfffff84ff401eff988bfbff409fe300008fff41ff8000000dff45ff20000007ff48ff00000004ff48fb00000004ff48fd00000004ff47ff00000006ff43ff50000009ff40dfc000003fff405ffb3005eeff4008ffffffe7ff30004affd914ff000000000006fe00000000000bfa00041000009ff4000bfb889eff900009ffffffe800000014686400000"},
+		'h':  {16, 2, -20, 13, 20, "8b80000000000bfb0000000000bfb0000000000bfb0000000000bfb0000000000bfb0058872000bfb2cfffff800bfcce988dff60bffd20001cfd0bff4000005ff2bfd0000002ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4"},
+		'i':  {7, 2, -20, 3, 20, "6b88fb8fb2430002438fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb"},
+		'j':  {7, -1, -20, 6, 26, "0006b80008fb0008fb0002430000000002430008fb0008fb0008fb0008fb0008fb0008fb0008fb0008fb0008fb0008fb0008fb0008fb0008fb0008fb0008fb0009fb000df848dff38fff60484100"},
+		'k':  {15, 2, -20, 13, 20, "8b80000000000bfb0000000000bfb0000000000bfb0000000000bfb0000000000bfb0000002442bfb000003efc1bfb00006ef910bfb0006ff9000bfb008ff60000bfb09ff600000bfccfe3000000bffff60000000bfccfe3000000bfb1cff600000bfb01aff60000bfb0009ff6000bfb00009ff600bfb000009ff60bfb0000009ff6"},
+		'l':  {7, 2, -20, 3, 20, "6b88fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb8fb"},
+		'm':  {25, 2, -15, 22, 15, "3430058871000038882000bfb3cffffe401bfffff600bfcde988efe2cfa88dff40bffc20003ffde30001dfa0bff400000aff7000008fe0bfd0000008ff1000004ff0bfb0000008ff0000004ff0bfb0000008ff0000004ff0bfb0000008ff0000004ff0bfb0000008ff0000004ff0bfb0000008ff0000004ff0bfb0000008ff0000004ff0bfb0000008ff0000004ff0bfb0000008ff0000004ff0bfb0000008ff0000004ff0"},
+		'n':  {16, 2, -15, 13, 15, "3430058872000bfb2cfffff800bfcce988dff60bffd20001cfd0bff4000005ff2bfd0000002ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4bfb0000000ff4"},
+		'o':  {16, 1, -15, 14, 16, "00002788720000001affffff910001cffa88bffc0008ff600006ff801ff9000000bfe05ff30000005ff48ff00000001ff78ff00000000ff88ff00000000ff88ff00000002ff64ff50000006ff30efb000000cfd008ff900009ff60009ffdaadff9000008effffe700000000444400000"},
+		'p':  {17, 2, -15, 14, 21, "34300588720000bfb3dfffff8000bfcee888dff700bffe30000aff20bff6000001ef80bff00000009fc0bfb00000008ff0bfb00000004ff0bfb00000005ff0bfc00000008ff0bff1000000afb0bff8000002ff70bfff60001cfe10bfccfc8aeff500bfb1bffffd4000bfb00244400000bfb00000000000bfb00000000000bfb00000000000bfb0000000000068600000000000"},
+		'q':  {17, 1, -15, 14, 21, "00005887201441002cfffff84ff401cff988bfbff409ff300009fff41ff8000000dff45ff20000008ff48ff00000004ff48fc00000004ff48fc00000004ff48ff00000005ff44ff30000008ff40ef9000001eff408ff60001bfff400cffc8aef9ff40018ffffe64ff400002444004ff400000000004ff400000000004ff400000000004ff400000000004ff400000000002882"},
+		'r':  {11, 2, -15, 9, 15, "343005886bfb3cfffbbfcefa889bffe30000bff600000bfe000000bfb000000bfb000000bfb000000bfb000000bfb000000bfb000000bfb000000bfb000000bfb000000"},
+		's':  {14, 1, -15, 12, 16, "00038888620003cfffffff701dfe8888ae806fe2000000208fb0000000007fe3000000002effa730000003dffffe920000059cffff6000000016efe1000000005ff4000000004ff4661000009fe18ffca8adff604cffffffd500000444430000"},
+		't':  {10, 0, -19, 10, 19, "0024300000008fb00000008fb00000008fb00000149fc444424ffffffff828bfd88884008fb00000008fb00000008fb00000008fb00000008fb00000008fb00000008fb00000008fb00000008fc00000006ff40000001dfffff800029dfff8"},
+		'u':  {16, 2, -15, 13, 16, "3420000001440bf80000004ff0bf80000004ff0bf80000004ff0bf80000004ff0bf80000004ff0bf80000004ff0bf80000004ff0bf80000004ff0bf80000004ff0bf90000007ff08fd000000dff05ff800019fff00bffdbbff8ff001bffffd44ff00002444000000"},
+		'v':  {15, 0, -15, 15, 15, "1441000000004420ef800000002ff609fd00000008fe003ff4000000df9000df9000004ff30007fe100009fd00002ff60001ef700000afb0006ff2000006ff200bfa0000000ef802ff600000009fd07fe000000003ff4df9000000000dfcff30000000007fffd00000000002fff700000"},
+		'w':  {21, 1, -15, 20, 15, "44200000344000001441af900000eff300006ff07fd00003fff700009fb03ff20007fdfb0000df700ef6000af6ff0002ff300afa000ff1cf4006fe0007fe004fc08f800afa0002ff308f804fc00ef70000df70bf500ff13ff200009fa1ff000bf57fd000006ff5fb0008f8af9000002ffcf80003fcef6000000dfff40000efff20000008ffe00000affd00000005ffa000007ff80000"},
+		'x':  {15, 0, -15, 15, 15, "03440000000244104ff8000001efb0008ff40000bfe10000bfe1008ff4000001efb04ff800000004ff8efb0000000008fffe10000000000dff500000000007fffb0000000003ffbff700000001dfc08ff30000009fe200cfd100006ff60002efa0003ef9000005ff701cfc10000008ff3"},
+		'y':  {15, 0, -15, 15, 21, "1441000000004420ef800000002ff508fe00000008fd002ff6000000ef8000afb000006ff20005ff20000bfa00000df80002ff5000007fe0008fd0000001ff600ef800000009fb06ff200000004ff2bfa000000000cfaff50000000006fffd00000000001eff8000000000009ff200000000000bfa000000000002ff500000000000afd00000000088bff5000000000ffff800000000008862000000000"},
+		'z':  {14, 1, -15, 12, 15, "2444444444428ffffffffff86bbbbbbbcff800000001cfe200000009fe300000008ff600000006ff700000005ff900000003efa00000001efc10000001cfe10000000afe300000009ff500000000ffebbbbbbbb6fffffffffff8"},
+		'{':  {17, 3, -20, 11, 25, "00000179bb300001effff400007ff62000000bfa00000000bf800000000bf800000000bf800000000bf800000000bf800000000ff800000007ff300008bdff800000bfffb200000345cfe100000002ff600000000df800000000bf800000000bf800000000bf800000000bf800000000bf8000000009fd000000004ffd982000008dfff400000002441"},
+		'|':  {9, 3, -20, 3, 27, "8b6bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8bf8342"},
+		'}':  {17, 3, -20, 11, 25, "8bb84000000bffff800000003aff100000002ff400000000ff400000000ff400000000ff400000000ff400000000ff500000000ef800000000afd200000002cffbb3000006efff400007ff84410000cf900000000ff700000000ff400000000ff400000000ff400000000ff400000000ff400000005ff3000068bffd00000bfffb30000034400000000"},
+		'~':  {22, 2, -11, 18, 6, "000000000000000010004afffb71000004d01bffffffffa848bff04fd62037dffffffd4048000000038bb96000000000000000000000"},
+		'°':  {13, 2, -20, 9, 9, "00034300001bfffb100cf848fc05f70007f58f10001f88f30003f82fc101cf207ffdff60004ab9400"},
+	},
+}
@@ -0,0 +1,188 @@
+// Package render draws device screens as RGB565 images at the panel's
+// resolution, for devices that show server-rendered bitmaps instead of
+// building LVGL screens.
+package render
+
+//go:generate sh -c "python3 ../scripts/gen_font.py | gofmt > fonts.go"
+
+import (
+	"strings"
+	"unicode/utf8"
+)
+
+// Panel size, landscape as the device is rotated
+const (
+	Width  = 320
+	Height = 240
+)
+
+// Color is an RGB colour as 0xRRGGBB, the form lv_color_hex() takes
+type Color uint32
+
+// Colours of the device screens
+const (
+	White    Color = 0xFFFFFF
+	Black    Color = 0x000000
+	Red      Color = 0xE31837
+	Grey     Color = 0x808080
+	TitleBar Color = 0x2196F3
+)
+
+// rgb565 packs c into the panel's 16-bit pixel format
+func rgb565(r, g, b uint32) uint16 {
+	return uint16((r>>3)<<11 | (g>>2)<<5 | b>>3)
+}
+
+func (c Color) rgb565() uint16 {
+	return rgb565(uint32(c)>>16&0xFF, uint32(c)>>8&0xFF, uint32(c)&0xFF)
+}
+
+// glyph is one character's coverage bitmap. x and y place its top left
+// corner relative to the pen position on the baseline; alpha holds one hex
+// digit of coverage (0-f) per pixel, row by row.
+type glyph struct {
+	advance int
+	x, y    int
+	w, h    int
+	alpha   string
+}
+
+// Face is a bitmap font at one pixel size
+type Face struct {
+	// Height is the line height, Ascent the distance from the top of a line
+	// to its baseline
+	Height int
+	Ascent int
+	glyphs map[rune]glyph
+}
+
+func (f *Face) glyph(r rune) glyph {
+	if g, exists := f.glyphs[r]; exists {
+		return g
+	}
+	return f.glyphs['?']
+}
+
+// Width returns the width of s in pixels
+func (f *Face) Width(s string) int {
+	width := 0
+	for _, r := range s {
+		width += f.glyph(r).advance
+	}
+	return width
+}
+
+// Wrap breaks s into lines no wider than width, between words where it can
+func (f *Face) Wrap(s string, width int) []string {
+	var lines []string
+	line := ""
+	for _, word := range strings.Fields(s) {
+		candidate := word
+		if line != "" {
+			candidate = line + " " + word
+		}
+		if f.Width(candidate) <= width {
+			line = candidate
+			continue
+		}
+		if line != "" {
+			lines = append(lines, line)
+		}
+		// A word wider than the line is broken wherever it has to be
+		for f.Width(word) > width {
+			i, w := 0, 0
+			for i < len(word) {
+				r, size := utf8.DecodeRuneInString(word[i:])
+				if w+f.glyph(r).advance > width && i > 0 {
+					break
+				}
+				w += f.glyph(r).advance
+				i += size
+			}
+			lines = append(lines, word[:i])
+			word = word[i:]
+		}
+		line = word
+	}
+	if line != "" {
+		lines = append(lines, line)
+	}
+	return lines
+}
+
+// Canvas is a screen being drawn, in RGB565
+type Canvas struct {
+	Pix []uint16
+}
+
+// NewCanvas returns a panel-sized canvas filled with bg
+func NewCanvas(bg Color) *Canvas {
+	c := &Canvas{Pix: make([]uint16, Width*Height)}
+	c.Rect(0, 0, Width, Height, bg)
+	return c
+}
+
+// Rect fills a rectangle, clipped to the canvas
+func (c *Canvas) Rect(x, y, w, h int, color Color) {
+	x0, y0, x1, y1 := max(x, 0), max(y, 0), min(x+w, Width), min(y+h, Height)
+	pixel := color.rgb565()
+	for row := y0; row < y1; row++ {
+		line := c.Pix[row*Width : (row+1)*Width]
+		for col := x0; col < x1; col++ {
+			line[col] = pixel
+		}
+	}
+}
+
+// blend mixes color over the pixel at i with coverage alpha (0-15)
+func (c *Canvas) blend(i int, color Color, alpha uint32) {
+	if alpha == 15 {
+		c.Pix[i] = color.rgb565()
+		return
+	}
+	dst := uint32(c.Pix[i])
+	// Expand the destination to 8 bits per channel
+	dr, dg, db := (dst>>11)<<3, (dst>>5&0x3F)<<2, (dst&0x1F)<<3
+	sr, sg, sb := uint32(color)>>16&0xFF, uint32(color)>>8&0xFF, uint32(color)&0xFF
+	mix := func(s, d uint32) uint32 {
+		return (s*alpha + d*(15-alpha) + 7) / 15
+	}
+	c.Pix[i] = rgb565(mix(sr, dr), mix(sg, dg), mix(sb, db))
+}
+
+// Text draws s with the top of its line at y, starting at x
+func (c *Canvas) Text(x, y int, f *Face, color Color, s string) {
+	baseline := y + f.Ascent
+	for _, r := range s {
+		g := f.glyph(r)
+		for row := 0; row < g.h; row++ {
+			py := baseline + g.y + row
+			if py < 0 || py >= Height {
+				continue
+			}
+			for col := 0; col < g.w; col++ {
+				px := x + g.x + col
+				if px < 0 || px >= Width {
+					continue
+				}
+				if alpha := hexDigit(g.alpha[row*g.w+col]); alpha > 0 {
+					c.blend(py*Width+px, color, alpha)
+				}
+			}
+		}
+		x += g.advance
+	}
+}
+
+func hexDigit(b byte) uint32 {
+	if b <= '9' {
+		return uint32(b - '0')
+	}
+	return uint32(b-'a') + 10
+}
+
+// Centered draws s centred horizontally on centerX, with the top of its line
+// at y, like an LVGL label aligned TOP_MID
+func (c *Canvas) Centered(centerX, y int, f *Face, color Color, s string) {
+	c.Text(centerX-f.Width(s)/2, y, f, color, s)
+}
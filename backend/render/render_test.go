@@ -0,0 +1,109 @@
+package render
+
+import (
+	"encoding/binary"
+	"testing"
+
+	"daysync/api/models"
+)
+
+// decode expands an encoded screen back into pixels, as the device does
+func decode(t *testing.T, data []byte) []uint16 {
+	t.Helper()
+	if string(data[:4]) != Magic {
+		t.Fatalf("Expected magic %q, got %q", Magic, data[:4])
+	}
+	width, height := binary.LittleEndian.Uint16(data[4:]), binary.LittleEndian.Uint16(data[6:])
+	colors := int(binary.LittleEndian.Uint16(data[8:]))
+	if width != Width || height != Height {
+		t.Fatalf("Expected %dx%d, got %dx%d", Width, Height, width, height)
+	}
+	palette := make([]uint16, colors)
+	for i := range palette {
+		palette[i] = binary.LittleEndian.Uint16(data[10+2*i:])
+	}
+
+	var pix []uint16
+	runs := data[10+2*colors:]
+	if len(runs)%2 != 0 {
+		t.Fatalf("Runs have an odd length %d", len(runs))
+	}
+	for i := 0; i < len(runs); i += 2 {
+		if int(runs[i+1]) >= colors {
+			t.Fatalf("Run %d uses colour %d of %d", i/2, runs[i+1], colors)
+		}
+		for n := 0; n <= int(runs[i]); n++ {
+			pix = append(pix, palette[runs[i+1]])
+		}
+	}
+	return pix
+}
+
+func TestEncodeRoundTrip(t *testing.T) {
+	c := Race("MotoGP - Upcoming", models.RaceDisplay{
+		Name:     "Grand Prix of Aragón",
+		Place:    "Alcañiz, Spain",
+		Circuit:  "MotorLand Aragón",
+		Date:     "Sunday 8th June 2025",
+		Sessions: []string{"Q1: 7th June 2025 at 18:50", "Race: 8th June 2025 at 21:30"},
+	})
+	data, err := Encode(c)
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	pix := decode(t, data)
+	if len(pix) != Width*Height {
+		t.Fatalf("Expected %d pixels, got %d", Width*Height, len(pix))
+	}
+	for i := range pix {
+		if pix[i] != c.Pix[i] {
+			t.Fatalf("Pixel %d,%d: expected %04x, got %04x", i%Width, i/Width, c.Pix[i], pix[i])
+		}
+	}
+	// Flat colour should compress well below the raw 150KB
+	if len(data) > len(c.Pix)/4 {
+		t.Errorf("Expected the screen to compress to under %d bytes, got %d", len(c.Pix)/4, len(data))
+	}
+}
+
+func TestText(t *testing.T) {
+	c := NewCanvas(White)
+	c.Text(10, 10, Sans16, Black, "Hi")
+
+	// Only the box the text was drawn into changes
+	drawn := 0
+	for i, pixel := range c.Pix {
+		if pixel == White.rgb565() {
+			continue
+		}
+		drawn++
+		x, y := i%Width, i/Width
+		if x < 10 || x >= 10+Sans16.Width("Hi") || y < 10 || y >= 10+Sans16.Height {
+			t.Fatalf("Unexpected pixel drawn at %d,%d", x, y)
+		}
+	}
+	if drawn == 0 {
+		t.Errorf("Expected text to be drawn")
+	}
+
+	// Characters without a glyph are drawn as '?'
+	if Sans16.Width("中") != Sans16.Width("?") {
+		t.Errorf("Expected a missing glyph to fall back to '?'")
+	}
+}
+
+func TestWrap(t *testing.T) {
+	lines := Sans12.Wrap("1. Markets rally as central banks signal an end to rate rises this year", 280)
+	if len(lines) != 2 {
+		t.Fatalf("Expected two lines, got %q", lines)
+	}
+	for _, line := range lines {
+		if Sans12.Width(line) > 280 {
+			t.Errorf("Line %q is wider than 280 pixels", line)
+		}
+	}
+	if lines := Sans12.Wrap("Supercalifragilisticexpialidocious", 60); len(lines) < 2 {
+		t.Errorf("Expected a long word to be broken, got %q", lines)
+	}
+}
@@ -0,0 +1,56 @@
+package render
+
+import (
+	"encoding/binary"
+	"fmt"
+)
+
+// Magic starts every encoded screen and names the format version
+const Magic = "DSR1"
+
+// Encode compresses the canvas for the device. The format is made to be
+// decoded straight into the panel with a few hundred bytes of RAM:
+//
+//	"DSR1"                    magic
+//	width, height   uint16    little endian
+//	colors          uint16    palette size, 1-256
+//	palette         uint16    RGB565 per colour
+//	runs            2 bytes   length - 1, palette index
+//
+// Runs cover the image row by row from the top left and may continue onto
+// the next row. Screens are mostly flat colour with anti-aliased text, so
+// they need far fewer than 256 colours; Encode fails if a canvas has more.
+func Encode(c *Canvas) ([]byte, error) {
+	index := make(map[uint16]byte)
+	var palette []uint16
+	for _, pixel := range c.Pix {
+		if _, exists := index[pixel]; exists {
+			continue
+		}
+		if len(palette) == 256 {
+			return nil, fmt.Errorf("screen has more than 256 colours")
+		}
+		index[pixel] = byte(len(palette))
+		palette = append(palette, pixel)
+	}
+
+	out := make([]byte, 0, 4+6+2*len(palette)+len(c.Pix)/8)
+	out = append(out, Magic...)
+	out = binary.LittleEndian.AppendUint16(out, Width)
+	out = binary.LittleEndian.AppendUint16(out, Height)
+	out = binary.LittleEndian.AppendUint16(out, uint16(len(palette)))
+	for _, color := range palette {
+		out = binary.LittleEndian.AppendUint16(out, color)
+	}
+
+	for i := 0; i < len(c.Pix); {
+		pixel := c.Pix[i]
+		n := 1
+		for n < 256 && i+n < len(c.Pix) && c.Pix[i+n] == pixel {
+			n++
+		}
+		out = append(out, byte(n-1), index[pixel])
+		i += n
+	}
+	return out, nil
+}
@@ -0,0 +1,135 @@
+package render
+
+import (
+	"strconv"
+
+	"daysync/api/models"
+)
+
+// Screen layouts. Positions and fonts follow the firmware's LVGL screens in
+// esp32/src/main.cpp, so a device shows the same thing in either mode.
+
+// center returns the y of a label of face f aligned CENTER with offset dy
+func center(f *Face, dy int) int {
+	return Height/2 + dy - f.Height/2
+}
+
+// bottom returns the y of a label of face f aligned BOTTOM_MID with offset dy
+func bottom(f *Face, dy int) int {
+	return Height + dy - f.Height
+}
+
+// hexColor parses a display model colour such as "00AA00"
+func hexColor(s string) Color {
+	c, err := strconv.ParseUint(s, 16, 32)
+	if err != nil {
+		return Black
+	}
+	return Color(c)
+}
+
+// newScreen returns a white canvas with the blue title bar
+func newScreen(title string) *Canvas {
+	c := NewCanvas(White)
+	c.Rect(0, 0, Width, 40, TitleBar)
+	c.Centered(Width/2, 20-Sans16.Height/2, Sans16, White, title)
+	return c
+}
+
+// Error is shown in place of a feed's screen until its data has loaded
+func Error(title, feed string) *Canvas {
+	c := newScreen(title)
+	c.Centered(Width/2, center(Sans20, 0), Sans20, Black, "Error loading "+feed+" data")
+	return c
+}
+
+// Weather draws the weather screen for a location
+func Weather(title string, m models.WeatherDisplay) *Canvas {
+	c := newScreen(title)
+	c.Centered(Width/2, 50, Sans20, Red, m.Date)
+	c.Centered(Width/2, center(Sans16, -40), Sans16, Black, "Temperature")
+	c.Centered(Width/2, center(Sans26, -10), Sans26, Black, m.Temperature)
+	c.Centered(Width/2, center(Sans16, 30), Sans16, Black, "Humidity")
+	c.Centered(Width/2, center(Sans20, 60), Sans20, Black, m.Humidity)
+	c.Centered(Width/2, bottom(Sans16, -30), Sans16, Black, m.Details)
+	c.Centered(Width/2, bottom(Sans14, -5), Sans14, Grey, m.Updated)
+	return c
+}
+
+// Race draws the next race of a series and its sessions
+func Race(title string, m models.RaceDisplay) *Canvas {
+	c := newScreen(title)
+	c.Centered(Width/2, 50, Sans22, Red, m.Name)
+	c.Centered(Width/2, 80, Sans16, Black, m.Place)
+	c.Centered(Width/2, 100, Sans14, Black, m.Circuit)
+	c.Centered(Width/2, 120, Sans14, Red, m.Date)
+	for i, session := range m.Sessions {
+		c.Centered(Width/2, 150+20*i, Sans14, Black, session)
+	}
+	return c
+}
+
+// Finance draws the stocks screen. The first quote is the headline index;
+// labels name each quote and quotes that failed to load are nil.
+func Finance(labels []string, quotes []*models.StockDisplay) *Canvas {
+	if len(quotes) == 0 || quotes[0] == nil {
+		return Error("Stocks", "finance")
+	}
+
+	c := newScreen("Stocks")
+	index := quotes[0]
+	c.Centered(Width/2, 50, Sans22, Red, labels[0])
+	c.Centered(Width/2, 80, Sans22, Black, index.Range)
+	c.Centered(Width/2, 110, Sans22, hexColor(index.Color), index.Change)
+
+	// Rows of 280 pixels, 20 high, centred on the screen
+	for i := 1; i < len(quotes); i++ {
+		stock := quotes[i]
+		if stock == nil {
+			continue
+		}
+		y := 140 + 25*(i-1) + (20-Sans14.Height)/2
+		c.Text(20, y, Sans14, Red, labels[i])
+		c.Text(70, y, Sans14, Black, stock.Range)
+		c.Text(300-Sans14.Width(stock.Change), y, Sans14, hexColor(stock.Color), stock.Change)
+	}
+	return c
+}
+
+// Crypto draws the crypto screen, the first quote large and the rest below
+func Crypto(labels []string, quotes []*models.CryptoDisplay) *Canvas {
+	if len(quotes) == 0 || quotes[0] == nil {
+		return Error("Crypto Prices", "crypto")
+	}
+
+	c := newScreen("Crypto Prices")
+	c.Centered(Width/2, 60, Sans26, Red, labels[0])
+	c.Centered(Width/2, 100, Sans26, Black, quotes[0].Headline)
+	for i := 1; i < len(quotes); i++ {
+		if quotes[i] != nil {
+			c.Centered(Width/2, 140+20*(i-1), Sans16, Black, labels[i]+" "+quotes[i].Price)
+		}
+	}
+	return c
+}
+
+// News draws headlines first to last, wrapped to the width of the list
+func News(title string, headlines []string, first, last int) *Canvas {
+	c := newScreen(title)
+	for i := first; i < last && i < len(headlines); i++ {
+		y := 50 + 35*(i-first)
+		for n, line := range Sans12.Wrap(headlines[i], 280) {
+			c.Text(20, y+n*Sans12.Height, Sans12, Black, line)
+		}
+	}
+	return c
+}
+
+// About draws the about screen, which needs no data
+func About() *Canvas {
+	c := newScreen("About")
+	c.Centered(Width/2, 70, Sans26, Red, "Daysync v0.1")
+	c.Centered(Width/2, 110, Sans16, Red, "by bindok")
+	c.Centered(Width/2, 140, Sans14, Grey, "github.com/intothevoid/daysync")
+	return c
+}
@@ -0,0 +1,298 @@
+"""
+Generate the bitmap fonts used by the screen renderer (render/fonts.go).
+
+    python3 scripts/gen_font.py [path/to/DejaVuSans.ttf] | gofmt > render/fonts.go
+
+Glyphs are rasterized from the TrueType outlines with 4x4 supersampling and
+stored as 4-bit coverage, one hex digit per pixel. The sizes match the
+firmware's FONT_12 ... FONT_26 so server-rendered screens lay out like the
+LVGL ones. Only the standard library is needed.
+"""
+
+import os
+import struct
+import sys
+
+FONT_SIZES = [12, 14, 16, 20, 22, 26]
+
+# Every size gets printable ASCII and the degree sign. The sizes that show
+# calendar names and headlines (see esp32/scripts/subset_fonts.py) also get
+# Latin-1 letters and typographic punctuation.
+BASE_CHARS = [chr(c) for c in range(0x20, 0x7F)] + ["°"]
+TEXT_SIZES = [12, 14, 16, 22]
+TEXT_CHARS = [chr(c) for c in range(0xC0, 0x100)] + list("–—‘’“”…•€£")
+
+SUPERSAMPLE = 4
+CURVE_STEPS = 8
+
+DEFAULT_TTF = "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf"
+
+
+class TrueType:
+    def __init__(self, data):
+        self.data = data
+        num_tables = struct.unpack(">H", data[4:6])[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack(">4sIII", data[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode("latin-1")] = (offset, length)
+
+        head = self.tables["head"][0]
+        self.units_per_em = self.u16(head + 18)
+        self.long_loca = self.i16(head + 50) == 1
+
+        hhea = self.tables["hhea"][0]
+        self.ascender = self.i16(hhea + 4)
+        self.descender = self.i16(hhea + 6)
+        self.line_gap = self.i16(hhea + 8)
+        self.num_hmetrics = self.u16(hhea + 34)
+
+        self.cmap = self.parse_cmap()
+
+    def u16(self, offset):
+        return struct.unpack(">H", self.data[offset:offset + 2])[0]
+
+    def i16(self, offset):
+        return struct.unpack(">h", self.data[offset:offset + 2])[0]
+
+    def u32(self, offset):
+        return struct.unpack(">I", self.data[offset:offset + 4])[0]
+
+    def parse_cmap(self):
+        cmap = self.tables["cmap"][0]
+        for i in range(self.u16(cmap + 2)):
+            platform, encoding, offset = struct.unpack(">HHI", self.data[cmap + 4 + 8 * i:cmap + 12 + 8 * i])
+            if platform == 3 and encoding == 1 and self.u16(cmap + offset) == 4:
+                return self.parse_cmap4(cmap + offset)
+        raise ValueError("no Unicode BMP cmap")
+
+    def parse_cmap4(self, table):
+        segments = self.u16(table + 6) // 2
+        ends = table + 14
+        starts = ends + 2 * segments + 2
+        deltas = starts + 2 * segments
+        range_offsets = deltas + 2 * segments
+        mapping = {}
+        for s in range(segments):
+            end = self.u16(ends + 2 * s)
+            start = self.u16(starts + 2 * s)
+            delta = self.i16(deltas + 2 * s)
+            range_offset = self.u16(range_offsets + 2 * s)
+            for c in range(start, min(end, 0xFFFE) + 1):
+                if range_offset == 0:
+                    glyph = (c + delta) & 0xFFFF
+                else:
+                    glyph = self.u16(range_offsets + 2 * s + range_offset + 2 * (c - start))
+                    if glyph:
+                        glyph = (glyph + delta) & 0xFFFF
+                if glyph:
+                    mapping[c] = glyph
+        return mapping
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        return self.u16(hmtx + 4 * min(glyph, self.num_hmetrics - 1))
+
+    def glyph_offset(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = self.u32(loca + 4 * glyph), self.u32(loca + 4 * glyph + 4)
+        else:
+            start, end = 2 * self.u16(loca + 2 * glyph), 2 * self.u16(loca + 2 * glyph + 2)
+        return self.tables["glyf"][0] + start, end - start
+
+    def contours(self, glyph):
+        """Outline of glyph as a list of closed polygons in font units."""
+        offset, length = self.glyph_offset(glyph)
+        if length == 0:
+            return []
+        count = self.i16(offset)
+        if count < 0:
+            return self.composite_contours(offset + 10)
+
+        end_points = [self.u16(offset + 10 + 2 * i) for i in range(count)]
+        num_points = end_points[-1] + 1
+        pos = offset + 10 + 2 * count
+        pos += 2 + self.u16(pos)  # skip instructions
+
+        flags = []
+        while len(flags) < num_points:
+            flag = self.data[pos]
+            pos += 1
+            flags.append(flag)
+            if flag & 8:
+                repeat = self.data[pos]
+                pos += 1
+                flags.extend([flag] * repeat)
+
+        def coords(short_bit, same_bit):
+            nonlocal pos
+            values, value = [], 0
+            for flag in flags:
+                if flag & short_bit:
+                    delta = self.data[pos]
+                    pos += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += self.i16(pos)
+                    pos += 2
+                values.append(value)
+            return values
+
+        xs = coords(2, 16)
+        ys = coords(4, 32)
+
+        polygons, start = [], 0
+        for end in end_points:
+            points = [(xs[i], ys[i], flags[i] & 1) for i in range(start, end + 1)]
+            polygons.append(flatten(points))
+            start = end + 1
+        return polygons
+
+    def composite_contours(self, pos):
+        polygons = []
+        while True:
+            flags, glyph = struct.unpack(">HH", self.data[pos:pos + 4])
+            pos += 4
+            if flags & 1:
+                dx, dy = struct.unpack(">hh", self.data[pos:pos + 4])
+                pos += 4
+            else:
+                dx, dy = struct.unpack(">bb", self.data[pos:pos + 2])
+                pos += 2
+            if not flags & 2:
+                raise ValueError("point-matched composite glyphs are not supported")
+            # Components are only ever offset in the glyphs we use; skip any
+            # scale, it is 1 for them
+            if flags & 8:
+                pos += 2
+            elif flags & 0x40:
+                pos += 4
+            elif flags & 0x80:
+                pos += 8
+            for polygon in self.contours(glyph):
+                polygons.append([(x + dx, y + dy) for x, y in polygon])
+            if not flags & 0x20:
+                return polygons
+
+
+def flatten(points):
+    """Turn a TrueType contour of on- and off-curve points into a polygon."""
+    # Insert the implied on-curve points between consecutive off-curve ones
+    expanded = []
+    for i, (x, y, on) in enumerate(points):
+        px, py, pon = points[i - 1]
+        if not on and not pon:
+            expanded.append(((px + x) / 2, (py + y) / 2, 1))
+        expanded.append((x, y, on))
+
+    # Start on an on-curve point
+    first = next(i for i, p in enumerate(expanded) if p[2])
+    expanded = expanded[first:] + expanded[:first]
+
+    polygon = []
+    i, n = 0, len(expanded)
+    while i < n:
+        x0, y0, _ = expanded[i]
+        x1, y1, on1 = expanded[(i + 1) % n]
+        polygon.append((x0, y0))
+        if on1:
+            i += 1
+            continue
+        x2, y2, _ = expanded[(i + 2) % n]
+        for step in range(1, CURVE_STEPS):
+            t = step / CURVE_STEPS
+            u = 1 - t
+            polygon.append((u * u * x0 + 2 * u * t * x1 + t * t * x2, u * u * y0 + 2 * u * t * y1 + t * t * y2))
+        i += 2
+    return polygon
+
+
+def rasterize(polygons, scale):
+    """Coverage of the outline at scale, as (x, y, width, height, levels)."""
+    # Pixel space: y down, origin on the baseline at the pen position
+    polygons = [[(x * scale, -y * scale) for x, y in polygon] for polygon in polygons]
+    points = [p for polygon in polygons for p in polygon]
+    if not points:
+        return 0, 0, 0, 0, []
+    left = int(min(x for x, _ in points) // 1)
+    top = int(min(y for _, y in points) // 1)
+    width = int(-(-max(x for x, _ in points) // 1)) - left
+    height = int(-(-max(y for _, y in points) // 1)) - top
+
+    edges = []
+    for polygon in polygons:
+        for i in range(len(polygon)):
+            (x0, y0), (x1, y1) = polygon[i - 1], polygon[i]
+            if y0 != y1:
+                edges.append((x0 - left, y0 - top, x1 - left, y1 - top))
+
+    coverage = [0] * (width * height)
+    for row in range(height * SUPERSAMPLE):
+        y = (row + 0.5) / SUPERSAMPLE
+        crossings = []
+        for x0, y0, x1, y1 in edges:
+            if min(y0, y1) <= y < max(y0, y1):
+                crossings.append((x0 + (y - y0) * (x1 - x0) / (y1 - y0), 1 if y1 > y0 else -1))
+        crossings.sort()
+        winding = 0
+        for k, (x, direction) in enumerate(crossings[:-1]):
+            winding += direction
+            if winding == 0:
+                continue
+            # Non-zero winding: fill to the next crossing
+            start = max(0, int(x * SUPERSAMPLE + 0.5))
+            end = min(width * SUPERSAMPLE, int(crossings[k + 1][0] * SUPERSAMPLE + 0.5))
+            for column in range(start, end):
+                coverage[(row // SUPERSAMPLE) * width + column // SUPERSAMPLE] += 1
+
+    samples = SUPERSAMPLE * SUPERSAMPLE
+    levels = [min(15, (c * 15 + samples // 2) // samples) for c in coverage]
+    return left, top, width, height, levels
+
+
+def go_rune(char):
+    if char == "'":
+        return "'\\''"
+    if char == "\\":
+        return "'\\\\'"
+    return "'%s'" % char
+
+
+def generate(ttf_path):
+    with open(ttf_path, "rb") as f:
+        font = TrueType(f.read())
+
+    out = [
+        "// Code generated by scripts/gen_font.py from %s. DO NOT EDIT." % os.path.basename(ttf_path),
+        "",
+        "package render",
+        "",
+    ]
+    for size in FONT_SIZES:
+        scale = size / font.units_per_em
+        ascent = round(font.ascender * scale)
+        height = round((font.ascender - font.descender + font.line_gap) * scale)
+        chars = BASE_CHARS + (TEXT_CHARS if size in TEXT_SIZES else [])
+
+        out.append("// Sans%d is DejaVu Sans at %d pixels, the size of the firmware's FONT_%d" % (size, size, size))
+        out.append("var Sans%d = &Face{" % size)
+        out.append("\tHeight: %d," % height)
+        out.append("\tAscent: %d," % ascent)
+        out.append("\tglyphs: map[rune]glyph{")
+        for char in chars:
+            glyph = font.cmap.get(ord(char))
+            if glyph is None:
+                continue
+            left, top, width, height_px, levels = rasterize(font.contours(glyph), scale)
+            advance = round(font.advance(glyph) * scale)
+            alpha = "".join("%x" % level for level in levels)
+            out.append("\t\t%s: {%d, %d, %d, %d, %d, \"%s\"}," % (go_rune(char), advance, left, top, width, height_px, alpha))
+        out.append("\t},")
+        out.append("}")
+        out.append("")
+    return "\n".join(out)
+
+
+if __name__ == "__main__":
+    sys.stdout.write(generate(sys.argv[1] if len(sys.argv) > 1 else DEFAULT_TTF))
@@ -13,6 +13,7 @@ func GetTestStockInfo(symbol string) (interface{}, error) {
 		FiftyTwoWeekLow      float64 `json:"fiftyTwoWeekLow"`
 		RegularMarketDayHigh float64 `json:"regularMarketDayHigh"`
 		RegularMarketDayLow  float64 `json:"regularMarketDayLow"`
+		RegularMarketPrice   float64 `json:"regularMarketPrice"`
 		PreviousClose        float64 `json:"previousClose"`
 		Scale                int     `json:"scale"`
 		PriceHint            int     `json:"priceHint"`
@@ -26,6 +27,7 @@ func GetTestStockInfo(symbol string) (interface{}, error) {
 		FiftyTwoWeekLow:      80.0,
 		RegularMarketDayHigh: 95.0,
 		RegularMarketDayLow:  90.0,
+		RegularMarketPrice:   93.75,
 		PreviousClose:        92.5,
 		Scale:                3,
 		PriceHint:            2,
@@ -6,24 +6,38 @@ import (
 	"os"
 	"path/filepath"
 	"strings"
+	"sync"
 )
 
-var testData map[string]interface{}
-
-func init() {
-	// Load test data
-	data, err := os.ReadFile(filepath.Join("testdata", "test_responses.json"))
-	if err != nil {
-		panic("Failed to load test data: " + err.Error())
-	}
+var (
+	testData     map[string]interface{}
+	testDataErr  error
+	testDataOnce sync.Once
+)
 
-	if err := json.Unmarshal(data, &testData); err != nil {
-		panic("Failed to parse test data: " + err.Error())
-	}
+// loadTestData reads the canned responses on first use, so the package can
+// be imported (e.g. by handler tests) from any working directory.
+func loadTestData() error {
+	testDataOnce.Do(func() {
+		data, err := os.ReadFile(filepath.Join("testdata", "test_responses.json"))
+		if err != nil {
+			testDataErr = fmt.Errorf("failed to load test data: %v", err)
+			return
+		}
+
+		if err := json.Unmarshal(data, &testData); err != nil {
+			testDataErr = fmt.Errorf("failed to parse test data: %v", err)
+		}
+	})
+	return testDataErr
 }
 
 // GetTestWeather returns test weather data
 func GetTestWeather(location string) (interface{}, error) {
+	if err := loadTestData(); err != nil {
+		return nil, err
+	}
+
 	weatherData, ok := testData["weather"].(map[string]interface{})
 	if !ok {
 		return nil, nil
@@ -47,6 +61,10 @@ func GetTestWeather(location string) (interface{}, error) {
 
 // GetTestCryptoPrice returns test crypto data
 func GetTestCryptoPrice(symbol string) (interface{}, error) {
+	if err := loadTestData(); err != nil {
+		return nil, err
+	}
+
 	cryptoData, ok := testData["crypto"].(map[string]interface{})
 	if !ok {
 		return nil, nil
@@ -69,6 +87,10 @@ func GetTestCryptoPrice(symbol string) (interface{}, error) {
 
 // GetTestNews returns test news data
 func GetTestNews(category, lang, country, max string) (interface{}, error) {
+	if err := loadTestData(); err != nil {
+		return nil, err
+	}
+
 	newsData, ok := testData["news"].(map[string]interface{})
 	if !ok {
 		return nil, nil
@@ -89,6 +111,10 @@ func GetTestNews(category, lang, country, max string) (interface{}, error) {
 
 // GetTestMotoGPSeason returns test MotoGP season data
 func GetTestMotoGPSeason(timezone string) (interface{}, error) {
+	if err := loadTestData(); err != nil {
+		return nil, err
+	}
+
 	motogpData, ok := testData["motogp"].(map[string]interface{})
 	if !ok {
 		return nil, nil
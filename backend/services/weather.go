@@ -9,6 +9,7 @@ import (
 	"time"
 
 	"daysync/api/config"
+	"daysync/api/metrics"
 	"daysync/api/models"
 )
 
@@ -26,9 +27,81 @@ type WeatherAPIResponse struct {
 		Humidity   float64 `json:"humidity"`
 		FeelsLikeC float64 `json:"feelslike_c"`
 		UV         float64 `json:"uv"`
+		IsDay      int     `json:"is_day"`
+		Condition  struct {
+			Text string `json:"text"`
+			Code int    `json:"code"`
+		} `json:"condition"`
 	} `json:"current"`
 }
 
+// wmoCodes maps weatherapi.com condition codes to WMO weather interpretation
+// codes (WMO 4677, as used by Open-Meteo), so clients are not tied to one
+// provider's codes. Sleet has no WMO code and is reported as freezing rain.
+var wmoCodes = map[int]int{
+	1000: 0,  // Sunny / Clear
+	1003: 2,  // Partly cloudy
+	1006: 3,  // Cloudy
+	1009: 3,  // Overcast
+	1030: 45, // Mist
+	1063: 61, // Patchy rain possible
+	1066: 71, // Patchy snow possible
+	1069: 66, // Patchy sleet possible
+	1072: 56, // Patchy freezing drizzle possible
+	1087: 95, // Thundery outbreaks possible
+	1114: 73, // Blowing snow
+	1117: 75, // Blizzard
+	1135: 45, // Fog
+	1147: 48, // Freezing fog
+	1150: 51, // Patchy light drizzle
+	1153: 51, // Light drizzle
+	1168: 56, // Freezing drizzle
+	1171: 57, // Heavy freezing drizzle
+	1180: 61, // Patchy light rain
+	1183: 61, // Light rain
+	1186: 63, // Moderate rain at times
+	1189: 63, // Moderate rain
+	1192: 65, // Heavy rain at times
+	1195: 65, // Heavy rain
+	1198: 66, // Light freezing rain
+	1201: 67, // Moderate or heavy freezing rain
+	1204: 66, // Light sleet
+	1207: 67, // Moderate or heavy sleet
+	1210: 71, // Patchy light snow
+	1213: 71, // Light snow
+	1216: 73, // Patchy moderate snow
+	1219: 73, // Moderate snow
+	1222: 75, // Patchy heavy snow
+	1225: 75, // Heavy snow
+	1237: 77, // Ice pellets
+	1240: 80, // Light rain shower
+	1243: 81, // Moderate or heavy rain shower
+	1246: 82, // Torrential rain shower
+	1249: 66, // Light sleet showers
+	1252: 67, // Moderate or heavy sleet showers
+	1255: 85, // Light snow showers
+	1258: 86, // Moderate or heavy snow showers
+	1261: 77, // Light showers of ice pellets
+	1264: 77, // Moderate or heavy showers of ice pellets
+	1273: 95, // Patchy light rain with thunder
+	1276: 95, // Moderate or heavy rain with thunder
+	1279: 95, // Patchy light snow with thunder
+	1282: 95, // Moderate or heavy snow with thunder
+}
+
+// wmoCode is the WMO code for a weatherapi.com condition code, or -1 if it
+// has none
+func wmoCode(code int) int {
+	if wmo, ok := wmoCodes[code]; ok {
+		return wmo
+	}
+	return -1
+}
+
+// WeatherAPIURL is the weatherapi.com current conditions endpoint. The load
+// test points it at its fake upstream.
+var WeatherAPIURL = "http://api.weatherapi.com/v1/current.json"
+
 func GetWeather(location string) (*models.Weather, error) {
 	apiKey := config.GetWeatherAPIKey()
 	if apiKey == "" {
@@ -36,7 +109,7 @@ func GetWeather(location string) (*models.Weather, error) {
 	}
 
 	// Build URL
-	baseURL := "http://api.weatherapi.com/v1/current.json"
+	baseURL := WeatherAPIURL
 	params := url.Values{}
 	params.Add("key", apiKey)
 	params.Add("q", location)
@@ -45,7 +118,8 @@ func GetWeather(location string) (*models.Weather, error) {
 	url := fmt.Sprintf("%s?%s", baseURL, params.Encode())
 
 	// Make request
-	resp, err := http.Get(url)
+	client := &http.Client{Transport: metrics.Transport("weatherapi")}
+	resp, err := client.Get(url)
 	if err != nil {
 		return nil, fmt.Errorf("error making weather API request: %v", err)
 	}
@@ -73,6 +147,9 @@ func GetWeather(location string) (*models.Weather, error) {
 		Humidity:      apiResp.Current.Humidity,
 		FeelsLike:     apiResp.Current.FeelsLikeC,
 		UVIndex:       apiResp.Current.UV,
+		Condition:     apiResp.Current.Condition.Text,
+		ConditionCode: wmoCode(apiResp.Current.Condition.Code),
+		IsDay:         apiResp.Current.IsDay == 1,
 		UpdatedAt:     time.Now(),
 	}
 
@@ -0,0 +1,35 @@
+#ifndef BITMAP_SCREENS_H
+#define BITMAP_SCREENS_H
+
+#include "daysync_config.h"
+
+// Screens drawn by the backend (/api/screen) and streamed straight to the
+// panel, used instead of the LVGL screens when RENDER_BITMAP_SCREENS is set.
+// Each screen arrives as RLE-compressed RGB565 (see backend/render/rle.go)
+// and is decoded run by run into TFT_eSPI, so nothing the size of a frame is
+// ever held in RAM and no LVGL objects are created.
+
+#define BITMAP_WIDTH 320
+#define BITMAP_HEIGHT 240
+
+// Encoded screens up to this size are kept so showing a screen again only
+// needs an ETag check; larger ones are streamed every time. A rotation's
+// worth is around 100KB, so boards without PSRAM always stream.
+#if defined(BOARD_HAS_PSRAM)
+  #define BITMAP_CACHE_MAX 32768
+#else
+  #define BITMAP_CACHE_MAX 0
+#endif
+
+// Number of screens in the rotation
+int bitmap_screen_count();
+
+// Fetch screen `index` if it has changed and draw it. Returns false if there
+// was nothing to draw; the panel keeps the previous screen.
+bool bitmap_screen_show(int index);
+
+// Check every screen with the backend the next time it is shown, e.g. after
+// the device was offline
+void bitmap_screens_expire();
+
+#endif // BITMAP_SCREENS_H
@@ -0,0 +1,24 @@
+#ifndef CALENDAR_STORE_H
+#define CALENDAR_STORE_H
+
+#include <Arduino.h>
+
+#include "feeds.h"
+
+// Race calendars kept on flash (LittleFS), one file per series. A season is
+// downloaded once and again only when its ETag changes; the next race is
+// picked from the stored copy with the device clock, so the race screens keep
+// moving on to the next race without any requests, even while offline.
+
+// Download the season at `url` into the calendar called `name`, sending the
+// stored ETag so an unchanged calendar is not sent again. Sets `changed` if a
+// new copy was stored. Returns false if the stored copy could not be checked
+// or replaced, which leaves it as it was.
+bool calendar_fetch(const char * name, const String & url, bool & changed);
+
+// The first race in calendar `name` that has not started at `now`, with its
+// session times formatted in the device timezone. Returns false if the
+// calendar is not stored or has no races left.
+bool calendar_next_race(const char * name, uint32_t now, RaceData & out);
+
+#endif // CALENDAR_STORE_H
@@ -0,0 +1,124 @@
+#ifndef DAYSYNC_CONFIG_H
+#define DAYSYNC_CONFIG_H
+
+// Base URL for all API calls
+#define BASE_URL "https://daysync.karan.myds.me"
+
+// Base URL for local development - replace 192.168.50.180 with your computer's IP address
+// #define BASE_URL "http://192.168.50.180:5173"
+
+// Location used for the weather feed and timezone used for race session times
+#define WEATHER_LOCATION "adelaide"
+#define RACE_TIMEZONE "ACDT"
+#define NEWS_COUNTRY "au"
+
+// Timezone of the device clock as a POSIX TZ string, the same zone as
+// RACE_TIMEZONE, and the servers it is synced from
+#define CLOCK_TIMEZONE "ACST-9:30ACDT,M10.1.0,M4.1.0/3"
+#define NTP_SERVER_1 "pool.ntp.org"
+#define NTP_SERVER_2 "time.google.com"
+
+// HTTP data caching
+#define HTTP_CACHE_INTERVAL 3600000UL // 60 minutes in milliseconds
+// #define HTTP_CACHE_INTERVAL 60000UL // 1 minute in milliseconds for testing
+
+// Race calendars are stored on the device and checked for changes this often
+#define CALENDAR_CHECK_INTERVAL 86400000UL // 24 hours in milliseconds
+
+// A feed that failed to load is tried again after this long instead of waiting
+// a full cache interval
+#define FEED_RETRY_INTERVAL 60000UL // 1 minute in milliseconds
+
+// WiFi reconnects. A lost connection is retried after WIFI_BACKOFF_MIN, and
+// the wait doubles after each failed attempt up to WIFI_BACKOFF_MAX. An
+// attempt that has neither connected nor failed after WIFI_CONNECT_TIMEOUT is
+// given up.
+#define WIFI_BACKOFF_MIN 1000UL      // 1 second in milliseconds
+#define WIFI_BACKOFF_MAX 60000UL     // 1 minute in milliseconds
+#define WIFI_CONNECT_TIMEOUT 20000UL // 20 seconds in milliseconds
+
+// Main loop health (see loop_watch.h). A loop iteration that takes longer
+// than LOOP_STALL_THRESHOLD is logged with the stage that held it up. If a
+// single stage runs for LOOP_WATCHDOG_TIMEOUT the task watchdog resets the
+// board; it has to allow for the slowest fetch.
+#define LOOP_STALL_THRESHOLD 250UL // milliseconds
+#define LOOP_WATCHDOG_TIMEOUT 60   // seconds
+
+// Headlines the device keeps and pages through on the news screen. Each one
+// takes 137 bytes of RAM; the screen uses the same five labels whatever the
+// count. The free GNews plan returns at most 10. The since= cursor lists
+// every headline held, and the backend takes at most 100 (maxCursorIDs).
+#ifndef NEWS_MAX_ARTICLES
+  #define NEWS_MAX_ARTICLES 10
+#endif
+static_assert(NEWS_MAX_ARTICLES >= 1 && NEWS_MAX_ARTICLES <= 100,
+              "NEWS_MAX_ARTICLES must be 1-100, the backend rejects longer since= cursors");
+
+// Prices each crypto and stock symbol keeps for its sparkline, one added per
+// fetch (HTTP_CACHE_INTERVAL), at most 255. A symbol takes 2 bytes per point
+// plus 14, so 48 bytes per day at hourly fetches and 108 bytes for the
+// default of 48. With PRICE_HISTORY_PERSIST set they are written to flash
+// after each fetch that moves the price and survive a reboot.
+#ifndef PRICE_HISTORY_POINTS
+  #define PRICE_HISTORY_POINTS 48
+#endif
+static_assert(PRICE_HISTORY_POINTS >= 2 && PRICE_HISTORY_POINTS <= 255,
+              "PRICE_HISTORY_POINTS must be 2-255, a history counts its points in a byte");
+#ifndef PRICE_HISTORY_PERSIST
+  #define PRICE_HISTORY_PERSIST 1
+#endif
+
+// Feeds and the screens that show them. Set one to 0 (e.g. -D FEED_NEWS=0 in
+// platformio.ini) to leave its fetcher, parser, storage and screen out of the
+// firmware entirely.
+#ifndef FEED_WEATHER
+  #define FEED_WEATHER 1
+#endif
+#ifndef FEED_MOTOGP
+  #define FEED_MOTOGP 1
+#endif
+#ifndef FEED_F1
+  #define FEED_F1 1
+#endif
+#ifndef FEED_FINANCE
+  #define FEED_FINANCE 1
+#endif
+#ifndef FEED_CRYPTO
+  #define FEED_CRYPTO 1
+#endif
+#ifndef FEED_NEWS
+  #define FEED_NEWS 1
+#endif
+#ifndef SCREEN_ABOUT
+  #define SCREEN_ABOUT 1
+#endif
+
+// Touch panel (XPT2046). Swipe left or right to move between screens, tap to
+// keep the current one up; rotation pauses for TOUCH_PAUSE_INTERVAL after
+// either. The raw range is the calibration of the ESP32-2432S028 panel.
+#ifndef TOUCH_ENABLED
+  #define TOUCH_ENABLED 1
+#endif
+#define TOUCH_PAUSE_INTERVAL 60000UL // 1 minute in milliseconds
+#define TOUCH_READ_PERIOD 10         // milliseconds between reads
+#define TOUCH_SWIPE_DISTANCE 40      // pixels along the swipe
+#define TOUCH_TAP_DISTANCE 12        // pixels a tap may move
+#define TOUCH_TAP_TIME 400UL         // milliseconds a tap may last
+#define TOUCH_IRQ 36
+#define TOUCH_MOSI 32
+#define TOUCH_MISO 39
+#define TOUCH_CLK 25
+#define TOUCH_RAW_X_MIN 200
+#define TOUCH_RAW_X_MAX 3700
+#define TOUCH_RAW_Y_MIN 240
+#define TOUCH_RAW_Y_MAX 3800
+
+// Show the screens the backend draws (/api/screen) instead of building them
+// with LVGL. Each one is streamed to the panel as it downloads, which leaves
+// out the LVGL object trees and the on-device parsing; LVGL still draws the
+// startup screen.
+#ifndef RENDER_BITMAP_SCREENS
+  #define RENDER_BITMAP_SCREENS 0
+#endif
+
+#endif // DAYSYNC_CONFIG_H
@@ -0,0 +1,26 @@
+#ifndef DEVICE_CLOCK_H
+#define DEVICE_CLOCK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Wall clock set over SNTP, in the timezone from daysync_config.h. Times are
+// Unix seconds; anything shown from the clock (the time, countdowns, how old
+// data is) is worked out on the device rather than fetched.
+
+// Set the timezone and start syncing. Needs a network connection to sync,
+// and keeps the clock in sync from then on.
+void clock_begin();
+
+// Current time, or 0 until the first sync
+uint32_t clock_now();
+
+// Format a time in the local timezone with strftime(). Writes an empty string
+// if `epoch` is 0.
+void clock_format(char * out, size_t size, const char * format, uint32_t epoch);
+
+// Time left until `epoch` from now, e.g. "6d 21h", "4h 05m" or "12m 30s".
+// Writes an empty string if the clock is not set or `epoch` has passed.
+void clock_format_countdown(char * out, size_t size, uint32_t epoch);
+
+#endif // DEVICE_CLOCK_H
@@ -0,0 +1,212 @@
+#ifndef FEEDS_H
+#define FEEDS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "daysync_config.h"
+#include "price_history.h"
+
+// Feed data as the screens show it. Feeds are loaded from the backend's
+// /api/display endpoints, which send every value already formatted, with the
+// colour to draw it in. Responses are parsed once when they arrive, screens
+// only copy these strings into their labels. The race feeds are the exception:
+// their season calendars are stored on flash and the next race is picked and
+// formatted on the device (calendar_store.h).
+
+struct WeatherData {
+  char date[11];        // YYYY-MM-DD
+  char temperature[12]; // e.g. 18.5°C
+  char humidity[8];
+  char details[48];     // wind and feels like
+  char updated[24];     // Last Update: HH:MM
+  int code;             // WMO weather code, -1 if not known
+  bool day;             // daytime, for a sun or moon icon
+  uint32_t fetched_at;  // when it was loaded, 0 if the clock was not set
+};
+
+#define RACE_MAX_SESSIONS 4
+
+struct RaceData {
+  char name[64];
+  char place[64];       // location, country
+  char circuit[48];
+  char date[16];
+  int session_count;
+  char sessions[RACE_MAX_SESSIONS][48]; // e.g. Race: 8th June 2025 at 21:30
+  uint32_t session_times[RACE_MAX_SESSIONS]; // Unix seconds, 0 if not known
+};
+
+struct QuoteData {
+  char headline[16];    // whole dollars, for the large price
+  char price[24];
+  price_point point;    // the price again, for its history
+};
+
+struct StockData {
+  char range[40];       // day low - day high
+  char change[16];      // change since the previous close
+  uint32_t change_color;
+  price_point point;    // current price, for its history
+};
+
+#define NEWS_TITLE_SIZE 128
+#define NEWS_ID_SIZE 9
+
+// Headlines as a fixed ring of NEWS_MAX_ARTICLES, oldest first from `head`.
+// Each fetch sends the IDs held and merges back only the new headlines and the
+// IDs to drop.
+struct NewsData {
+  int count;
+  int head;             // slot of the oldest headline
+  char ids[NEWS_MAX_ARTICLES][NEWS_ID_SIZE];
+  char titles[NEWS_MAX_ARTICLES][NEWS_TITLE_SIZE]; // as published, not numbered
+};
+
+// Headline `index` counting from the newest, which is the top story
+inline const char * news_title(const NewsData & news, int index) {
+  return news.titles[(news.head + news.count - 1 - index) % NEWS_MAX_ARTICLES];
+}
+
+#define FEEDS_STR_(x) #x
+#define FEEDS_STR(x) FEEDS_STR_(x)
+
+// A value appended to a feed's path (symbol, location, ...) and the name the
+// UI shows for it
+struct feed_symbol {
+  const char * query;
+  const char * label;
+};
+
+struct feed_status {
+  unsigned long last_attempt;
+  unsigned long interval; // time until the next fetch, TTL or retry interval
+};
+
+// Feed registry entries. Each one names the endpoint, the values fetched from
+// it, the model its responses parse into and how long the data stays fresh.
+// The fetch and refresh code in feeds.cpp is a template instantiated per
+// entry, so a feed compiled out with its FEED_* switch costs nothing.
+//
+// A feed is fetched with one request per symbol, or with BATCHED set, with a
+// single symbols= request whose "quotes" array holds one entry per symbol.
+// Race feeds fetch their path as a calendar instead, see refresh_calendar().
+
+struct feed_defaults {
+  static const bool BATCHED = false;
+  // Responses are deltas, parsed straight into the stored model. parse() must
+  // leave the model as it was when it returns false.
+  static const bool MERGE = false;
+  static unsigned long ttl() { return HTTP_CACHE_INTERVAL; }
+  // Add parameters that depend on the data held, such as a cursor, to a
+  // request URL
+  static void append_query(String & url) { (void)url; }
+  // Fill in a deserialization filter. Returns false if the feed needs none.
+  static bool filter(JsonDocument & filter) { (void)filter; return false; }
+  // Called for each symbol that loaded, once the request is done
+  static void loaded(int index) { (void)index; }
+};
+
+struct WeatherFeed : feed_defaults {
+  typedef WeatherData Model;
+  static const int COUNT = 1;
+  static const char * name() { return "weather"; }
+  static const char * path() { return "/api/display/weather?location="; }
+  static const feed_symbol * symbols();
+  static bool parse(JsonVariant value, Model & out);
+};
+
+// The season fields a stored calendar keeps
+#define RACE_CALENDAR_FIELDS "?fields=races.name,races.location,races.country,races.circuit,races.date,races.starts"
+
+// Race feeds only check their calendar for changes, the race shown moves on
+// with the device clock
+struct RaceFeed : feed_defaults {
+  typedef RaceData Model;
+  static const int COUNT = 1;
+  static unsigned long ttl() { return CALENDAR_CHECK_INTERVAL; }
+};
+
+struct MotoGPFeed : RaceFeed {
+  static const char * name() { return "motogp"; }
+  static const char * path() { return "/api/motogp" RACE_CALENDAR_FIELDS; }
+  static const feed_symbol * symbols();
+};
+
+struct F1Feed : RaceFeed {
+  static const char * name() { return "f1"; }
+  static const char * path() { return "/api/formula1" RACE_CALENDAR_FIELDS; }
+  static const feed_symbol * symbols();
+};
+
+struct FinanceFeed : feed_defaults {
+  typedef StockData Model;
+  static const int COUNT = 4;
+  static const char * name() { return "finance"; }
+  static const bool BATCHED = true;
+  static const char * path() { return "/api/display/finance?symbols="; }
+  static const feed_symbol * symbols();
+  static bool parse(JsonVariant value, Model & out);
+  static void loaded(int index);
+};
+
+struct CryptoFeed : feed_defaults {
+  typedef QuoteData Model;
+  static const int COUNT = 5;
+  static const char * name() { return "crypto"; }
+  static const bool BATCHED = true;
+  static const char * path() { return "/api/display/crypto?symbols="; }
+  static const feed_symbol * symbols();
+  static bool parse(JsonVariant value, Model & out);
+  static void loaded(int index);
+};
+
+struct NewsFeed : feed_defaults {
+  typedef NewsData Model;
+  static const int COUNT = 1;
+  static const char * name() { return "news"; }
+  static const bool MERGE = true;
+  static const char * path() { return "/api/display/news?max=" FEEDS_STR(NEWS_MAX_ARTICLES) "&country="; }
+  static const feed_symbol * symbols();
+  static void append_query(String & url);
+  static bool parse(JsonVariant value, Model & out);
+};
+
+// Storage for a feed, one model per symbol. Only instantiated for feeds that
+// are referenced, and the price history only for feeds with prices.
+template <typename F>
+struct feed_store {
+  static typename F::Model data[F::COUNT];
+  static bool valid[F::COUNT];
+  static feed_status status;
+  static price_history history[F::COUNT];
+};
+
+template <typename F> typename F::Model feed_store<F>::data[F::COUNT];
+template <typename F> bool feed_store<F>::valid[F::COUNT];
+template <typename F> feed_status feed_store<F>::status;
+template <typename F> price_history feed_store<F>::history[F::COUNT];
+
+// Parsed data for symbol `index` of feed F, or NULL if it has never loaded
+template <typename F>
+const typename F::Model * feed_data(int index = 0) {
+  return feed_store<F>::valid[index] ? &feed_store<F>::data[index] : NULL;
+}
+
+// Recent prices of symbol `index` of feed F
+template <typename F>
+const price_history & feed_history(int index = 0) {
+  return feed_store<F>::history[index];
+}
+
+template <typename F>
+const char * feed_label(int index = 0) {
+  return F::symbols()[index].label;
+}
+
+// Fetch every enabled feed whose data has expired, or all of them if force is
+// set, and move the race feeds on to the next race. Fetches are skipped while
+// offline. Returns true if anything was fetched or a race changed.
+bool feeds_refresh(bool force);
+
+#endif // FEEDS_H
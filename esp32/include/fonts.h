@@ -0,0 +1,32 @@
+#ifndef FONTS_H
+#define FONTS_H
+
+#include <lvgl.h>
+
+// Fonts used by the UI. With USE_SUBSET_FONTS (set by scripts/subset_fonts.py
+// once it has generated src/fonts/) these are Montserrat subsets holding only
+// the glyphs the firmware can display, otherwise LVGL's built-in Montserrat.
+#if USE_SUBSET_FONTS
+  LV_FONT_DECLARE(daysync_font_12)
+  LV_FONT_DECLARE(daysync_font_14)
+  LV_FONT_DECLARE(daysync_font_16)
+  LV_FONT_DECLARE(daysync_font_20)
+  LV_FONT_DECLARE(daysync_font_22)
+  LV_FONT_DECLARE(daysync_font_26)
+
+  #define FONT_12 (&daysync_font_12)
+  #define FONT_14 (&daysync_font_14)
+  #define FONT_16 (&daysync_font_16)
+  #define FONT_20 (&daysync_font_20)
+  #define FONT_22 (&daysync_font_22)
+  #define FONT_26 (&daysync_font_26)
+#else
+  #define FONT_12 (&lv_font_montserrat_12)
+  #define FONT_14 (&lv_font_montserrat_14)
+  #define FONT_16 (&lv_font_montserrat_16)
+  #define FONT_20 (&lv_font_montserrat_20)
+  #define FONT_22 (&lv_font_montserrat_22)
+  #define FONT_26 (&lv_font_montserrat_26)
+#endif
+
+#endif // FONTS_H
@@ -0,0 +1,69 @@
+#ifndef JSON_ARENA_H
+#define JSON_ARENA_H
+
+#include <ArduinoJson.h>
+
+struct feed_stats;
+
+// Fixed reservation for all JSON parsing. Sized for the news feed, the
+// largest document the device parses.
+#ifndef JSON_ARENA_SIZE
+  #if defined(BOARD_HAS_PSRAM)
+    #define JSON_ARENA_SIZE (64 * 1024)
+  #else
+    #define JSON_ARENA_SIZE (16 * 1024)
+  #endif
+#endif
+
+// Bump allocator handed to every JsonDocument. Memory is only given back when
+// the enclosing JsonArenaScope ends, so parses never interleave with the
+// long-lived LVGL and String allocations on the general heap.
+class JsonArena : public ArduinoJson::Allocator {
+public:
+  bool begin(size_t size);
+
+  void * allocate(size_t size) override;
+  void deallocate(void * pointer) override;
+  void * reallocate(void * pointer, size_t new_size) override;
+
+  size_t used() const { return top; }
+  size_t capacity() const { return size; }
+
+private:
+  friend class JsonArenaScope;
+
+  uint8_t * base = nullptr;
+  size_t size = 0;
+  size_t top = 0;
+  size_t high = 0;
+  size_t last = SIZE_MAX; // offset of the most recent block header
+};
+
+// Marks the arena on construction and rewinds it on destruction. Declare it
+// before the JsonDocument so the document is destroyed first. Scopes nest, so
+// a screen can parse one feed while another document is still alive.
+class JsonArenaScope {
+public:
+  explicit JsonArenaScope(const char * feed);
+  ~JsonArenaScope();
+
+  JsonArenaScope(const JsonArenaScope &) = delete;
+  JsonArenaScope & operator=(const JsonArenaScope &) = delete;
+
+private:
+  feed_stats * stats;
+  feed_stats * parent_stats;
+  size_t mark;
+  size_t saved_high;
+  size_t saved_last;
+};
+
+// Reserve the arena. Call once from setup() after mem_pools_init().
+void json_arena_init();
+
+ArduinoJson::Allocator * json_arena_allocator();
+
+// Print arena size and the high-water mark recorded for each feed.
+void json_arena_report();
+
+#endif // JSON_ARENA_H
@@ -0,0 +1,36 @@
+#ifndef LOOP_WATCH_H
+#define LOOP_WATCH_H
+
+// Main loop health. loop() is split into stages; the time spent in each is
+// measured, and an iteration that takes longer than LOOP_STALL_THRESHOLD is
+// logged with the stage (and feed or screen) that took the longest. The loop
+// task is also watched by the task watchdog, which resets the board if no
+// stage is entered for LOOP_WATCHDOG_TIMEOUT. The stage being run is kept in
+// RTC memory, which survives that reset, so the next boot can say where the
+// previous run was stuck.
+
+enum loop_stage {
+  LOOP_STAGE_SETUP,
+  LOOP_STAGE_LVGL,
+  LOOP_STAGE_WIFI,
+  LOOP_STAGE_TOUCH,
+  LOOP_STAGE_REFRESH,
+  LOOP_STAGE_PRERENDER,
+  LOOP_STAGE_SWITCH,
+  LOOP_STAGE_IDLE,
+  LOOP_STAGE_COUNT
+};
+
+// Report why the board last reset, and where the previous run was if it was
+// a watchdog or a crash, then start the task watchdog. Call first in setup().
+void loop_watch_begin();
+
+// Enter `stage`. `detail` names the feed or screen it works on, or is NULL,
+// and must outlive the iteration. Entering the stage already being run starts
+// a new part of it, e.g. for each feed refreshed.
+void loop_watch_stage(loop_stage stage, const char * detail);
+
+// End the loop iteration: check how long it took and feed the watchdog.
+void loop_watch_end();
+
+#endif // LOOP_WATCH_H
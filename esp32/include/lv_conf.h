@@ -0,0 +1,83 @@
+/**
+ * LVGL configuration for Daysync
+ *
+ * Only the options Daysync relies on are set here, everything else falls back
+ * to the defaults in lv_conf_internal.h. Picked up through the
+ * LV_CONF_INCLUDE_SIMPLE build flag in platformio.ini.
+ */
+
+#if 1 /* Set it to "1" to enable content */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/*====================
+   COLOR SETTINGS
+ *====================*/
+
+#define LV_COLOR_DEPTH 16
+
+/*=========================
+   STDLIB WRAPPER SETTINGS
+ *=========================*/
+
+// LVGL keeps its own TLSF pool so its objects never share blocks with WiFi,
+// TLS or ArduinoJson. The pool is requested once from mem_lv_pool_alloc(),
+// which places it in PSRAM when the board has it and in internal RAM otherwise.
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
+
+#if defined(BOARD_HAS_PSRAM)
+  #define LV_MEM_SIZE (256 * 1024U)
+#else
+  #define LV_MEM_SIZE (64 * 1024U)
+#endif
+
+#define LV_MEM_ADR 0
+#define LV_MEM_POOL_INCLUDE "mem_pools.h"
+#define LV_MEM_POOL_ALLOC   mem_lv_pool_alloc
+
+/*====================
+   HAL SETTINGS
+ *====================*/
+
+#define LV_DEF_REFR_PERIOD 33
+
+/*=====================
+   LOGGING
+ *=====================*/
+
+#define LV_USE_LOG 1
+#define LV_LOG_LEVEL LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF 0
+
+/*==================
+   FONT USAGE
+ *===================*/
+
+#if USE_SUBSET_FONTS
+  // Subsets generated by scripts/subset_fonts.py replace the built-in fonts
+  #define LV_FONT_MONTSERRAT_14 0
+  #define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(daysync_font_14)
+  #define LV_FONT_DEFAULT &daysync_font_14
+#else
+  #define LV_FONT_MONTSERRAT_12 1
+  #define LV_FONT_MONTSERRAT_14 1
+  #define LV_FONT_MONTSERRAT_16 1
+  #define LV_FONT_MONTSERRAT_20 1
+  #define LV_FONT_MONTSERRAT_22 1
+  #define LV_FONT_MONTSERRAT_26 1
+
+  #define LV_FONT_DEFAULT &lv_font_montserrat_14
+#endif
+
+/*==================
+   DEVICES
+ *==================*/
+
+#define LV_USE_TFT_ESPI 1
+
+#endif /* LV_CONF_H */
+
+#endif /* End of "Content enable" */
@@ -0,0 +1,38 @@
+#ifndef MEM_POOLS_H
+#define MEM_POOLS_H
+
+#include <stddef.h>
+
+// Allocations at or above this size go to PSRAM when the board has it. This
+// covers HTTP response bodies and other large short-lived buffers.
+#define MEM_PSRAM_MALLOC_THRESHOLD 1024
+
+// How often the pool usage report is printed to serial
+#define MEM_REPORT_INTERVAL 300000 // 5 minutes in milliseconds
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Called once by lv_init() (through LV_MEM_POOL_ALLOC in lv_conf.h) to get the
+// backing store for LVGL's TLSF pool. Prefers PSRAM, falls back to internal RAM.
+void * mem_lv_pool_alloc(size_t size);
+
+#ifdef __cplusplus
+}
+
+// Set up the allocation policy. Call before lv_init().
+void mem_pools_init();
+
+// Allocate a large buffer, in PSRAM when present. Used for the draw buffer
+// and the JSON arena.
+void * mem_alloc_large(size_t size, const char * name);
+
+// Print where each pool lives and how full it is / has been.
+void mem_report(const char * tag);
+
+// Start a periodic LVGL timer that calls mem_report().
+void mem_report_start();
+#endif
+
+#endif // MEM_POOLS_H
@@ -0,0 +1,21 @@
+#ifndef NEWS_VIEW_H
+#define NEWS_VIEW_H
+
+#include <lvgl.h>
+
+// Paged view over the news headlines. It holds the labels for one page
+// (NEWS_VIEW_ROWS) whatever the number of headlines, and pages through them by
+// pointing the same labels at the next headlines while its screen is shown.
+// Headlines are cut by pixel width to fit NEWS_VIEW_LINES lines. The next
+// news screen carries on from the page after the last one shown.
+
+#define NEWS_VIEW_ROWS 5
+#define NEWS_VIEW_LINES 2 // lines per headline
+
+// Build the view in `parent`, below the title bar, and show the next page.
+// `title` is the title bar label, which gets the page number. Once the screen
+// has been loaded the view turns to the next page every `page_interval` ms,
+// until it has shown `pages` pages.
+lv_obj_t * news_view_create(lv_obj_t * parent, lv_obj_t * title, uint32_t page_interval, int pages);
+
+#endif // NEWS_VIEW_H
@@ -0,0 +1,44 @@
+#ifndef PRICE_HISTORY_H
+#define PRICE_HISTORY_H
+
+#include <Arduino.h>
+
+#include "daysync_config.h"
+
+// Recent prices of a symbol for the sparklines on the crypto and stocks
+// screens. The backend sends each price in fixed point, so no floats are
+// involved. A history keeps its newest point whole and the points before it
+// as 16-bit steps, each point minus the one before, in a fixed ring. A price
+// too far from the last one for a step, such as after a change of scale,
+// starts the history over.
+
+// A price as the backend sends it: value * 10^exponent
+struct price_point {
+  int32_t value;
+  int8_t exponent;
+};
+
+struct price_history {
+  uint32_t added;       // points added since the history started
+  int32_t last;         // newest point, scaled by `exponent`
+  int8_t exponent;
+  uint8_t count;        // points held, up to PRICE_HISTORY_POINTS
+  uint8_t head;         // slot of the oldest step
+  int16_t steps[PRICE_HISTORY_POINTS - 1];
+};
+
+// Add a point, dropping the oldest once the history is full. A zero point (no
+// price) is ignored.
+void price_history_add(price_history & history, price_point point);
+
+// Write the points held to `out`, oldest first, scaled by the history's
+// exponent. Returns how many there are.
+int price_history_points(const price_history & history, int32_t * out);
+
+// Keep a history on flash under `key` (a symbol), and read it back. Both do
+// nothing unless PRICE_HISTORY_PERSIST is set. Load returns false if nothing
+// usable is stored, leaving the history as it was.
+bool price_history_load(const char * key, price_history & history);
+void price_history_save(const char * key, const price_history & history);
+
+#endif // PRICE_HISTORY_H
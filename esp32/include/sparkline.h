@@ -0,0 +1,14 @@
+#ifndef SPARKLINE_H
+#define SPARKLINE_H
+
+#include <lvgl.h>
+
+#include "price_history.h"
+
+// A small line chart of a price history, with no axes or labels, to sit next
+// to the price. It follows the history while it exists: a point added since
+// it was built is appended to the chart, the rest of the points are not set
+// again. A history with fewer than two points shows an empty chart.
+lv_obj_t * sparkline_create(lv_obj_t * parent, const price_history & history, int32_t width, int32_t height, lv_color_t color);
+
+#endif // SPARKLINE_H
@@ -0,0 +1,28 @@
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+#include <lvgl.h>
+
+// XPT2046 touch panel as an LVGL pointer device. The controller's IRQ line
+// flags a touch, so the LVGL read timer, every TOUCH_READ_PERIOD ms, only
+// goes to the controller over SPI while the panel is pressed. Reads are also
+// checked for gestures: a horizontal swipe is recognised as soon as the
+// finger has moved far enough, without waiting for it to lift, and a tap when
+// a short press ends where it started.
+
+enum touch_gesture {
+  TOUCH_NONE,
+  TOUCH_TAP,
+  TOUCH_SWIPE_LEFT,  // towards the next screen
+  TOUCH_SWIPE_RIGHT, // towards the previous screen
+};
+
+// Start the controller and register it with LVGL. Call after the display has
+// been created and rotated.
+void touch_input_begin();
+
+// The gesture made since the last call, or TOUCH_NONE. `at` is set to the
+// micros() of the read that recognised it.
+touch_gesture touch_input_take(unsigned long * at);
+
+#endif // TOUCH_INPUT_H
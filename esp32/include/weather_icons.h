@@ -0,0 +1,26 @@
+#ifndef WEATHER_ICONS_H
+#define WEATHER_ICONS_H
+
+#include <lvgl.h>
+
+// Weather condition icons. They are stored in flash as one run-length encoded
+// atlas (src/weather_icon_atlas.h, generated by scripts/gen_weather_icons.py)
+// and decoded into a small cache of A8 images the first time they are shown,
+// so a screen that shows the same conditions again decodes nothing. Icons are
+// alpha only and take their colour from the image's recolor style.
+//
+// The cache holds WEATHER_ICON_CACHE_SLOTS icons and reuses the one used
+// longest ago, so with two slots the icon on the screen shown is never
+// replaced while the next screen is built.
+
+#define WEATHER_ICON_CACHE_SLOTS 2
+
+// The icon for WMO weather `code` by day or by night, or NULL if the code has
+// none. Stays valid until WEATHER_ICON_CACHE_SLOTS other icons have been asked
+// for.
+const lv_image_dsc_t * weather_icon(int code, bool day);
+
+// Name of WMO weather `code`, e.g. "Partly cloudy", or "" if not known
+const char * weather_name(int code);
+
+#endif // WEATHER_ICONS_H
@@ -0,0 +1,25 @@
+#ifndef WIFI_MANAGER_H
+#define WIFI_MANAGER_H
+
+// WiFi connection manager. The connection is tracked through WiFi events and
+// lost connections are retried with exponential backoff (WIFI_BACKOFF_* in
+// daysync_config.h), all without blocking the loop, so the screens keep
+// showing the data they have while the device is offline.
+
+// Start connecting. Returns immediately.
+void wifi_manager_begin(const char * ssid, const char * password);
+
+// Handle connection events and start reconnect attempts that are due. Call
+// from loop(). Returns true once each time the device (re)connects, when the
+// feeds should be refreshed.
+bool wifi_manager_loop();
+
+// Connection attempts since the device was last connected, 1 while the first
+// one is under way
+unsigned long wifi_manager_attempts();
+
+// Print how often and how long the device was offline and how long
+// reconnecting took.
+void wifi_report(const char * tag);
+
+#endif // WIFI_MANAGER_H
@@ -0,0 +1,180 @@
+"""
+Generate the weather icon atlas (src/weather_icon_atlas.h).
+
+    python3 scripts/gen_weather_icons.py > src/weather_icon_atlas.h
+
+Icons are drawn from simple shapes (discs, strokes, polygons) with 4x4
+supersampling and stored as 4-bit coverage, run-length encoded: each byte is
+a coverage level in the high nibble and a run of 1-16 pixels in the low one.
+The firmware decodes an icon into an A8 image the first time it is shown and
+draws it in one colour. Only the standard library is needed.
+"""
+
+import math
+
+SIZE = 48
+SUPERSAMPLE = 4
+
+
+def disc(cx, cy, r):
+    return lambda x, y: (x - cx) ** 2 + (y - cy) ** 2 <= r * r
+
+
+def stroke(x1, y1, x2, y2, width):
+    """A line segment with round ends."""
+    dx, dy = x2 - x1, y2 - y1
+    length2 = dx * dx + dy * dy
+
+    def inside(x, y):
+        t = max(0.0, min(1.0, ((x - x1) * dx + (y - y1) * dy) / length2))
+        px, py = x1 + t * dx, y1 + t * dy
+        return (x - px) ** 2 + (y - py) ** 2 <= (width / 2) ** 2
+    return inside
+
+
+def polygon(points):
+    def inside(x, y):
+        result = False
+        j = len(points) - 1
+        for i in range(len(points)):
+            xi, yi = points[i]
+            xj, yj = points[j]
+            if (yi > y) != (yj > y) and x < (xj - xi) * (y - yi) / (yj - yi) + xi:
+                result = not result
+            j = i
+        return result
+    return inside
+
+
+def union(*shapes):
+    return lambda x, y: any(shape(x, y) for shape in shapes)
+
+
+def minus(shape, cut):
+    return lambda x, y: shape(x, y) and not cut(x, y)
+
+
+def shifted(shape, dx, dy):
+    return lambda x, y: shape(x - dx, y - dy)
+
+
+def sun(cx, cy, r, rays):
+    parts = [disc(cx, cy, r)]
+    for i in range(8):
+        angle = i * math.pi / 4
+        c, s = math.cos(angle), math.sin(angle)
+        parts.append(stroke(cx + c * (r + 4), cy + s * (r + 4), cx + c * (r + 4 + rays), cy + s * (r + 4 + rays), 3))
+    return union(*parts)
+
+
+def moon(cx, cy, r):
+    return minus(disc(cx, cy, r), disc(cx + r * 0.45, cy - r * 0.35, r * 0.85))
+
+
+def cloud_shape(grow=0):
+    return union(
+        disc(16, 31, 7 + grow),
+        disc(26, 24, 10 + grow),
+        disc(35, 30, 8 + grow),
+        polygon([(16 - grow, 31), (35, 30 - grow), (35 + grow, 38 + grow), (16, 38 + grow)]),
+    )
+
+
+CLOUD = cloud_shape()
+# The cloud with a gap around it, for what it covers
+CLOUD_GAP = cloud_shape(2.5)
+# Raised to leave room below for rain, snow or lightning
+HIGH_CLOUD = shifted(CLOUD, 0, -8)
+
+
+def behind_cloud(shape):
+    return union(minus(shape, CLOUD_GAP), CLOUD)
+
+
+def drops(points, length, width):
+    return union(*[stroke(x, y, x - length / 2, y + length, width) for x, y in points])
+
+
+def flake(cx, cy, r):
+    return union(*[stroke(cx - r * math.cos(a), cy - r * math.sin(a), cx + r * math.cos(a), cy + r * math.sin(a), 2)
+                   for a in (math.pi / 2, math.pi / 6, -math.pi / 6)])
+
+
+# In the order of weather_icon_id in the generated header
+ICONS = [
+    ("SUN", sun(24, 24, 8, 5)),
+    ("MOON", moon(24, 24, 14)),
+    ("SUN_CLOUD", behind_cloud(sun(18, 18, 6, 3))),
+    ("MOON_CLOUD", behind_cloud(moon(18, 17, 9))),
+    ("CLOUD", shifted(CLOUD, 0, -4)),
+    ("FOG", union(stroke(10, 17, 38, 17, 4), stroke(6, 25, 34, 25, 4), stroke(14, 33, 42, 33, 4))),
+    ("DRIZZLE", union(HIGH_CLOUD, disc(18, 39, 2), disc(26, 43, 2), disc(34, 39, 2))),
+    ("RAIN", union(HIGH_CLOUD, drops([(19, 35), (27, 35), (35, 35)], 8, 3))),
+    ("SNOW", union(HIGH_CLOUD, flake(18, 40, 4), flake(30, 41, 4))),
+    ("THUNDER", union(HIGH_CLOUD, polygon([(27, 30), (19, 40), (24, 40), (21, 47), (30, 36), (25, 36), (29, 30)]))),
+]
+
+
+def rasterize(shape):
+    """4-bit coverage of each pixel, row by row."""
+    levels = []
+    samples = SUPERSAMPLE * SUPERSAMPLE
+    for py in range(SIZE):
+        for px in range(SIZE):
+            hits = 0
+            for sy in range(SUPERSAMPLE):
+                for sx in range(SUPERSAMPLE):
+                    if shape(px + (sx + 0.5) / SUPERSAMPLE, py + (sy + 0.5) / SUPERSAMPLE):
+                        hits += 1
+            levels.append((hits * 15 + samples // 2) // samples)
+    return levels
+
+
+def rle(levels):
+    out = []
+    i = 0
+    while i < len(levels):
+        run = 1
+        while i + run < len(levels) and run < 16 and levels[i + run] == levels[i]:
+            run += 1
+        out.append(levels[i] << 4 | (run - 1))
+        i += run
+    return out
+
+
+def main():
+    atlas = []
+    entries = []
+    for name, shape in ICONS:
+        data = rle(rasterize(shape))
+        entries.append((name, len(atlas), len(data)))
+        atlas.extend(data)
+
+    print("// Generated by scripts/gen_weather_icons.py, do not edit.")
+    print("")
+    print("#define WEATHER_ICON_SIZE %d" % SIZE)
+    print("")
+    print("enum weather_icon_id {")
+    for name, _, _ in entries:
+        print("  WEATHER_ICON_%s," % name)
+    print("  WEATHER_ICON_COUNT")
+    print("};")
+    print("")
+    print("// Where each icon's runs start in the atlas and how many bytes they take")
+    print("static const struct {")
+    print("  uint16_t offset;")
+    print("  uint16_t length;")
+    print("} WEATHER_ICON_INDEX[WEATHER_ICON_COUNT] = {")
+    for name, offset, length in entries:
+        print("  {%d, %d}, // %s" % (offset, length, name))
+    print("};")
+    print("")
+    print("// %d bytes for %d icons of %dx%d" % (len(atlas), len(entries), SIZE, SIZE))
+    print("static const uint8_t WEATHER_ICON_ATLAS[] = {")
+    for i in range(0, len(atlas), 16):
+        print("  " + " ".join("0x%02x," % b for b in atlas[i:i + 16]))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,198 @@
+"""
+Generate subset Montserrat fonts for LVGL.
+
+Runs as a PlatformIO pre-build script (see extra_scripts in platformio.ini) or
+standalone:
+
+    python scripts/subset_fonts.py [--compress] [--ttf path/to/Montserrat-Medium.ttf]
+
+The glyph set is everything the firmware can put on screen:
+  - printable ASCII, since feed data can contain any of it
+  - non-ASCII characters in the firmware's string literals
+  - non-ASCII characters in strings the backend formats (the degree sign)
+  - non-ASCII characters in the race calendars served by the backend
+  - for the news size, Latin-1 letters and the typographic punctuation
+    headlines use
+
+Fonts are written to src/fonts/ and only regenerated when the glyph set or
+options change. If lv_font_conv or the TTF cannot be found and no fonts were
+generated before, the build falls back to LVGL's built-in Montserrat fonts.
+"""
+
+import glob
+import hashlib
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+FONT_SIZES = [12, 14, 16, 20, 22, 26]
+
+# Sizes that show race names, circuits and locations from the calendars
+CALENDAR_SIZES = [12, 14, 16, 22]
+# Sizes that show news headlines. The remaining sizes only show numbers,
+# ASCII feed values and fixed labels.
+NEWS_SIZES = [12]
+
+ASCII_RANGE = (0x20, 0x7E)
+LATIN1_LETTERS = (0xC0, 0xFF)
+NEWS_PUNCTUATION = "–—‘’“”…•€£"
+# Non-ASCII characters in strings the backend formats for display, which do
+# not appear in the firmware sources (e.g. "21.5°C" in the weather model)
+BACKEND_GLYPHS = "°"
+
+FONT_NAME = "daysync_font_{size}"
+STAMP_FILE = ".stamp"
+
+
+def project_paths(project_dir):
+    return {
+        "src": os.path.join(project_dir, "src"),
+        "out": os.path.join(project_dir, "src", "fonts"),
+        "calendars": os.path.join(project_dir, "..", "backend", "data"),
+        "libdeps": os.path.join(project_dir, ".pio", "libdeps"),
+    }
+
+
+def literal_glyphs(src_dir):
+    """Non-ASCII characters appearing in the firmware sources."""
+    glyphs = set()
+    for path in glob.glob(os.path.join(src_dir, "*.cpp")):
+        with open(path, encoding="utf-8") as f:
+            text = f.read()
+        glyphs.update(c for c in text if ord(c) > 0x7E)
+        glyphs.update(chr(int(code, 16)) for code in re.findall(r"\\u([0-9A-Fa-f]{4})", text))
+    return glyphs
+
+
+def calendar_glyphs(calendar_dir):
+    """Non-ASCII characters in the race calendars the device displays."""
+    glyphs = set()
+    for path in glob.glob(os.path.join(calendar_dir, "*.json")):
+        with open(path, encoding="utf-8") as f:
+            glyphs.update(c for c in f.read() if ord(c) > 0x7E)
+    return glyphs
+
+
+def glyph_set(size, paths):
+    glyphs = {chr(c) for c in range(ASCII_RANGE[0], ASCII_RANGE[1] + 1)}
+    glyphs |= literal_glyphs(paths["src"])
+    glyphs |= set(BACKEND_GLYPHS)
+    if size in CALENDAR_SIZES:
+        glyphs |= calendar_glyphs(paths["calendars"])
+    if size in NEWS_SIZES:
+        glyphs |= {chr(c) for c in range(LATIN1_LETTERS[0], LATIN1_LETTERS[1] + 1)}
+        glyphs |= set(NEWS_PUNCTUATION)
+    return sorted(glyphs)
+
+
+def to_ranges(glyphs):
+    """Collapse sorted code points into lv_font_conv range syntax."""
+    codes = [ord(g) for g in glyphs]
+    ranges = []
+    start = prev = codes[0]
+    for code in codes[1:]:
+        if code == prev + 1:
+            prev = code
+            continue
+        ranges.append((start, prev))
+        start = prev = code
+    ranges.append((start, prev))
+    return ",".join("0x%X" % a if a == b else "0x%X-0x%X" % (a, b) for a, b in ranges)
+
+
+def find_ttf(paths, explicit):
+    candidates = [explicit] if explicit else []
+    candidates += glob.glob(os.path.join(paths["libdeps"], "*", "lvgl", "scripts", "built_in_font", "Montserrat-Medium.ttf"))
+    for candidate in candidates:
+        if candidate and os.path.isfile(candidate):
+            return candidate
+    return None
+
+
+def find_font_conv():
+    if shutil.which("lv_font_conv"):
+        return ["lv_font_conv"]
+    if shutil.which("npx"):
+        return ["npx", "--yes", "lv_font_conv"]
+    return None
+
+
+def read_stamp(out_dir):
+    try:
+        with open(os.path.join(out_dir, STAMP_FILE)) as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return None
+
+
+def fonts_present(out_dir):
+    return all(os.path.isfile(os.path.join(out_dir, FONT_NAME.format(size=s) + ".c")) for s in FONT_SIZES)
+
+
+def generate(project_dir, compress=False, ttf=None):
+    """Regenerate fonts if needed. Returns True if subset fonts are available."""
+    paths = project_paths(project_dir)
+    jobs = {size: to_ranges(glyph_set(size, paths)) for size in FONT_SIZES}
+    digest = hashlib.sha1(json.dumps([jobs, compress]).encode()).hexdigest()
+
+    stamp = read_stamp(paths["out"])
+    if stamp and stamp.get("digest") == digest and fonts_present(paths["out"]):
+        return True
+
+    font_conv = find_font_conv()
+    ttf_path = find_ttf(paths, ttf)
+    if not font_conv or not ttf_path:
+        missing = "lv_font_conv (npm i -g lv_font_conv)" if not font_conv else "Montserrat-Medium.ttf"
+        if fonts_present(paths["out"]):
+            print("subset_fonts: %s not found, keeping previously generated fonts" % missing)
+            return True
+        print("subset_fonts: %s not found, using LVGL built-in fonts" % missing)
+        return False
+
+    os.makedirs(paths["out"], exist_ok=True)
+    glyph_counts = {}
+    for size, ranges in jobs.items():
+        name = FONT_NAME.format(size=size)
+        cmd = font_conv + [
+            "--font", ttf_path, "-r", ranges,
+            "--size", str(size), "--bpp", "4", "--format", "lvgl",
+            "--lv-include", "lvgl.h", "--lv-font-name", name,
+            "-o", os.path.join(paths["out"], name + ".c"),
+        ]
+        if not compress:
+            cmd.append("--no-compress")
+        subprocess.check_call(cmd)
+        glyph_counts[size] = len(glyph_set(size, paths))
+        print("subset_fonts: %s (%d glyphs)" % (name, glyph_counts[size]))
+
+    with open(os.path.join(paths["out"], STAMP_FILE), "w") as f:
+        json.dump({"digest": digest, "compress": compress, "glyphs": glyph_counts}, f, indent=2)
+    return True
+
+
+def option_enabled(env, name, default):
+    return env.GetProjectOption(name, default).lower() in ("yes", "true", "1")
+
+
+def platformio_main(env):
+    if not option_enabled(env, "custom_subset_fonts", "yes"):
+        return
+
+    compress = option_enabled(env, "custom_subset_fonts_compress", "no")
+    ttf = env.GetProjectOption("custom_subset_fonts_ttf", "")
+    if generate(env.subst("$PROJECT_DIR"), compress, ttf or None):
+        env.Append(CPPDEFINES=[("USE_SUBSET_FONTS", 1), ("LV_USE_FONT_COMPRESSED", 1 if compress else 0)])
+
+
+if __name__ == "__main__":
+    args = sys.argv[1:]
+    ttf_arg = args[args.index("--ttf") + 1] if "--ttf" in args else None
+    project = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    if not generate(project, "--compress" in args, ttf_arg):
+        sys.exit(1)
+else:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    platformio_main(env)  # noqa: F821
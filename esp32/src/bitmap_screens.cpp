@@ -0,0 +1,333 @@
+#include "bitmap_screens.h"
+
+#include <ctype.h>
+
+#include <TFT_eSPI.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+
+#include "feeds.h"
+
+// Format version at the start of every encoded screen
+static const char BITMAP_MAGIC[] = "DSR1";
+
+// Matches LV_DISPLAY_ROTATION_270 on the LVGL screens
+static const uint8_t BITMAP_ROTATION = 3;
+
+static TFT_eSPI tft;
+
+static String url_encode(const char * value) {
+  static const char hex[] = "0123456789ABCDEF";
+  String out;
+  for (const char * c = value; *c; c++) {
+    if (isalnum((unsigned char)*c) || strchr("-_.~", *c)) {
+      out += *c;
+    } else {
+      out += '%';
+      out += hex[(uint8_t)*c >> 4];
+      out += hex[*c & 0x0F];
+    }
+  }
+  return out;
+}
+
+// A feed's screen takes the same query as its display model, plus the names
+// the screen shows for batched symbols
+template <typename F>
+static String feed_screen_url() {
+  String path = F::path();
+  path.replace("/api/display/", "/api/screen/");
+  String url = String(BASE_URL) + path;
+  if (!F::BATCHED) {
+    return url + F::symbols()[0].query;
+  }
+
+  String symbols, labels;
+  for (int i = 0; i < F::COUNT; i++) {
+    if (i > 0) {
+      symbols += ",";
+      labels += ",";
+    }
+    symbols += F::symbols()[i].query;
+    labels += url_encode(F::symbols()[i].label);
+  }
+  return url + symbols + "&labels=" + labels;
+}
+
+// Race feeds load their calendar rather than a display model, their screens
+// take the timezone the session times are shown in
+#if FEED_MOTOGP
+static String motogp_screen_url() {
+  return String(BASE_URL) + "/api/screen/motogp?timezone=" RACE_TIMEZONE;
+}
+#endif
+
+#if FEED_F1
+static String f1_screen_url() {
+  return String(BASE_URL) + "/api/screen/formula1?timezone=" RACE_TIMEZONE;
+}
+#endif
+
+#if FEED_NEWS
+template <int PAGE>
+static String news_screen_url() {
+  return feed_screen_url<NewsFeed>() + "&page=" + PAGE;
+}
+#endif
+
+#if SCREEN_ABOUT
+static String about_screen_url() {
+  return String(BASE_URL) + "/api/screen/about";
+}
+#endif
+
+struct bitmap_screen {
+  const char * name;
+  String (*url)();
+};
+
+// Same rotation as SCREENS in main.cpp
+static const bitmap_screen BITMAP_SCREENS[] = {
+#if FEED_MOTOGP
+  {"motogp", motogp_screen_url},
+#endif
+#if FEED_F1
+  {"f1", f1_screen_url},
+#endif
+#if FEED_FINANCE
+  {"finance", feed_screen_url<FinanceFeed>},
+#endif
+#if FEED_CRYPTO
+  {"crypto", feed_screen_url<CryptoFeed>},
+#endif
+#if FEED_NEWS
+  {"news 1", news_screen_url<1>},
+  {"news 2", news_screen_url<2>},
+#endif
+#if SCREEN_ABOUT
+  {"about", about_screen_url},
+#endif
+#if FEED_WEATHER
+  {"weather", feed_screen_url<WeatherFeed>},
+#endif
+};
+static const int BITMAP_SCREEN_COUNT = sizeof(BITMAP_SCREENS) / sizeof(BITMAP_SCREENS[0]);
+
+// The last encoded copy of each screen and when it was last checked
+struct bitmap_cache {
+  char etag[24];
+  uint8_t * data;
+  size_t size;
+  unsigned long checked;
+  unsigned long interval; // time until the next ETag check
+};
+static bitmap_cache bitmap_caches[BITMAP_SCREEN_COUNT];
+
+// Time to pixels, split by whether the screen came over the network
+struct bitmap_stats {
+  unsigned long count;
+  unsigned long total_us;
+};
+static bitmap_stats bitmap_stats_streamed = {0, 0};
+static bitmap_stats bitmap_stats_cached = {0, 0};
+
+// Encoded screen bytes held in memory
+struct memory_source {
+  const uint8_t * data;
+  size_t remaining;
+
+  bool read(uint8_t * out, size_t n) {
+    if (n > remaining) {
+      return false;
+    }
+    memcpy(out, data, n);
+    data += n;
+    remaining -= n;
+    return true;
+  }
+};
+
+// Encoded screen bytes read off a response body, copied to `copy` if set
+struct stream_source {
+  Stream * stream;
+  size_t remaining;
+  uint8_t * copy;
+
+  bool read(uint8_t * out, size_t n) {
+    if (n > remaining || stream->readBytes((char *)out, n) != n) {
+      return false;
+    }
+    if (copy) {
+      memcpy(copy, out, n);
+      copy += n;
+    }
+    remaining -= n;
+    return true;
+  }
+};
+
+// Decode an encoded screen onto the panel as it is read. Only the palette and
+// one chunk of runs are held at a time.
+template <typename Source>
+static bool draw_rle(Source & src) {
+  uint8_t buf[512];
+  if (!src.read(buf, 10) || memcmp(buf, BITMAP_MAGIC, 4) != 0) {
+    return false;
+  }
+  uint16_t width = buf[4] | buf[5] << 8;
+  uint16_t height = buf[6] | buf[7] << 8;
+  uint16_t colors = buf[8] | buf[9] << 8;
+  if (width != BITMAP_WIDTH || height != BITMAP_HEIGHT || colors == 0 || colors > 256) {
+    return false;
+  }
+
+  // Unused entries stay black, a bad index cannot read past the palette
+  uint16_t palette[256] = {0};
+  if (!src.read(buf, 2 * colors)) {
+    return false;
+  }
+  for (int i = 0; i < colors; i++) {
+    palette[i] = buf[2 * i] | buf[2 * i + 1] << 8;
+  }
+
+  tft.startWrite();
+  tft.setAddrWindow(0, 0, width, height);
+  uint32_t pixels = (uint32_t)width * height;
+  while (pixels > 0) {
+    // Runs are two bytes, read whole ones
+    size_t n = (src.remaining < sizeof(buf) ? src.remaining : sizeof(buf)) & ~(size_t)1;
+    if (n == 0 || !src.read(buf, n)) {
+      break;
+    }
+    for (size_t i = 0; i < n && pixels > 0; i += 2) {
+      uint32_t run = buf[i] + 1;
+      if (run > pixels) {
+        run = pixels;
+      }
+      tft.writeColor(palette[buf[i + 1]], run);
+      pixels -= run;
+    }
+  }
+  tft.endWrite();
+  return pixels == 0;
+}
+
+// Drop a screen's cached copy, e.g. because a new one replaces it
+static void clear_cache(bitmap_cache & entry) {
+  free(entry.data);
+  entry.data = NULL;
+  entry.size = 0;
+  entry.etag[0] = '\0';
+}
+
+// Fetch a screen, or with a cached copy, check its ETag. A new screen is drawn
+// while it downloads. Sets `drawn` if the panel was drawn.
+static bool fetch_screen(const bitmap_screen & screen, bitmap_cache & entry, bool & drawn) {
+  String url = screen.url();
+  Serial.printf("Fetching %s screen from: %s\n", screen.name, url.c_str());
+
+  HTTPClient http;
+  // No chunked responses, the body is decoded straight off the socket
+  http.useHTTP10(true);
+  http.begin(url);
+  const char * headers[] = {"ETag"};
+  http.collectHeaders(headers, 1);
+  if (entry.data) {
+    http.addHeader("If-None-Match", entry.etag);
+  }
+  int httpCode = http.GET();
+  bool ok = false;
+
+  if (httpCode == HTTP_CODE_NOT_MODIFIED && entry.data) {
+    ok = true;
+  } else if (httpCode == HTTP_CODE_OK) {
+    clear_cache(entry);
+    int size = http.getSize();
+    uint8_t * copy = size > 0 && size <= BITMAP_CACHE_MAX ? (uint8_t *)malloc(size) : NULL;
+
+    stream_source src = {http.getStreamPtr(), size > 0 ? (size_t)size : 0, copy};
+    drawn = ok = draw_rle(src);
+    if (!ok) {
+      Serial.printf("%s screen could not be decoded\n", screen.name);
+    }
+
+    // Error screens come without an ETag and are not kept
+    String etag = http.header("ETag");
+    if (ok && copy && etag.length() > 0 && etag.length() < sizeof(entry.etag)) {
+      entry.data = copy;
+      entry.size = size;
+      strlcpy(entry.etag, etag.c_str(), sizeof(entry.etag));
+    } else {
+      free(copy);
+      ok = false;
+    }
+  } else if (httpCode > 0) {
+    Serial.printf("%s screen request failed with HTTP code: %d\n", screen.name, httpCode);
+  } else {
+    Serial.printf("%s screen GET request failed, error: %s\n", screen.name, http.errorToString(httpCode).c_str());
+  }
+  http.end();
+
+  entry.checked = millis();
+  entry.interval = ok ? HTTP_CACHE_INTERVAL : FEED_RETRY_INTERVAL;
+  return ok;
+}
+
+int bitmap_screen_count() {
+  return BITMAP_SCREEN_COUNT;
+}
+
+void bitmap_screens_expire() {
+  for (int i = 0; i < BITMAP_SCREEN_COUNT; i++) {
+    bitmap_caches[i].interval = 0;
+  }
+}
+
+bool bitmap_screen_show(int index) {
+  static bool tft_ready = false;
+  if (!tft_ready) {
+    // Take over the panel from LVGL, which only drew the startup screen
+    tft.init();
+    tft.setRotation(BITMAP_ROTATION);
+    tft_ready = true;
+  }
+
+  const bitmap_screen & screen = BITMAP_SCREENS[index];
+  bitmap_cache & entry = bitmap_caches[index];
+  unsigned long start = micros();
+  bool drawn = false;
+  bool streamed = false;
+
+  // Check with the backend whether the screen changed once its interval is up,
+  // otherwise (or when that fails) the cached copy is drawn as it is
+  if (!entry.data || millis() - entry.checked >= entry.interval) {
+    if (WiFi.status() == WL_CONNECTED) {
+      fetch_screen(screen, entry, drawn);
+      streamed = drawn;
+    }
+  }
+  if (!drawn && entry.data) {
+    memory_source src = {entry.data, entry.size};
+    drawn = draw_rle(src);
+  }
+  if (!drawn) {
+    Serial.printf("[BITMAP] %s screen not available\n", screen.name);
+    return false;
+  }
+
+  unsigned long elapsed = micros() - start;
+  bitmap_stats & stats = streamed ? bitmap_stats_streamed : bitmap_stats_cached;
+  stats.count++;
+  stats.total_us += elapsed;
+
+  size_t cached_bytes = 0;
+  for (int i = 0; i < BITMAP_SCREEN_COUNT; i++) {
+    cached_bytes += bitmap_caches[i].size;
+  }
+  Serial.printf("[BITMAP] %s screen in %lu us (%s) | avg streamed %lu us, avg cached %lu us | %u bytes cached\n",
+                screen.name, elapsed, streamed ? "streamed" : "cached",
+                bitmap_stats_streamed.count ? bitmap_stats_streamed.total_us / bitmap_stats_streamed.count : 0,
+                bitmap_stats_cached.count ? bitmap_stats_cached.total_us / bitmap_stats_cached.count : 0,
+                (unsigned)cached_bytes);
+  return true;
+}
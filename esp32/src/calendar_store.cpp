@@ -0,0 +1,242 @@
+#include "calendar_store.h"
+
+#include <FS.h>
+#include <LittleFS.h>
+#include <HTTPClient.h>
+
+#include "json_arena.h"
+#include "device_clock.h"
+
+// Format version at the start of every calendar file
+static const char CALENDAR_MAGIC[] = "CAL1";
+
+enum { SESSION_Q1, SESSION_Q2, SESSION_SPRINT, SESSION_RACE, SESSION_COUNT };
+static const char * const SESSION_NAMES[SESSION_COUNT] = {"Q1", "Q2", "Sprint", "Race"};
+
+struct calendar_header {
+  char magic[4];
+  uint16_t count;
+  uint16_t record_size; // sizeof(calendar_race) when the file was written
+  char etag[24];
+};
+
+// One race as stored: what RaceData shows, with the sessions as start times
+// rather than text
+struct calendar_race {
+  uint32_t starts[SESSION_COUNT]; // Unix seconds, 0 if the weekend has no such session
+  char name[sizeof(RaceData::name)];
+  char place[sizeof(RaceData::place)];
+  char circuit[sizeof(RaceData::circuit)];
+  char date[sizeof(RaceData::date)];
+};
+
+static bool calendar_mount() {
+  static bool tried = false;
+  static bool mounted = false;
+  if (!tried) {
+    // Formats the partition if it has no filesystem yet
+    mounted = LittleFS.begin(true);
+    tried = true;
+    if (!mounted) {
+      Serial.println("[CALENDAR] LittleFS mount failed, calendars are not stored");
+    }
+  }
+  return mounted;
+}
+
+static String calendar_path(const char * name) {
+  return String("/") + name + ".cal";
+}
+
+static bool read_header(File & file, calendar_header & header) {
+  return file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+         memcmp(header.magic, CALENDAR_MAGIC, 4) == 0 &&
+         header.record_size == sizeof(calendar_race);
+}
+
+// Races without a race start time (not yet scheduled) are left out
+static bool parse_race(JsonVariant value, calendar_race & out) {
+  JsonObject starts = value["starts"];
+  if (starts["race"].isNull()) {
+    return false;
+  }
+  out.starts[SESSION_Q1] = starts["q1"] | 0UL;
+  out.starts[SESSION_Q2] = starts["q2"] | 0UL;
+  out.starts[SESSION_SPRINT] = starts["sprint"] | 0UL;
+  out.starts[SESSION_RACE] = starts["race"] | 0UL;
+  strlcpy(out.name, value["name"] | "", sizeof(out.name));
+  snprintf(out.place, sizeof(out.place), "%s, %s", value["location"] | "", value["country"] | "");
+  strlcpy(out.circuit, value["circuit"] | "", sizeof(out.circuit));
+  strlcpy(out.date, value["date"] | "", sizeof(out.date));
+  return true;
+}
+
+// Write the races in a season response to `path`. Races are parsed one at a
+// time as they come off the socket, so the season is never held in memory.
+// The file is written next to the old one and renamed over it once complete.
+static bool store_calendar(const char * name, const String & path, Stream & stream, const String & etag) {
+  unsigned long start = micros();
+  String tmp_path = path + ".tmp";
+  File file = LittleFS.open(tmp_path, "w");
+  if (!file) {
+    Serial.printf("%s calendar could not be written\n", name);
+    return false;
+  }
+
+  calendar_header header = {};
+  memcpy(header.magic, CALENDAR_MAGIC, 4);
+  header.record_size = sizeof(calendar_race);
+  if (etag.length() < sizeof(header.etag)) {
+    strlcpy(header.etag, etag.c_str(), sizeof(header.etag));
+  }
+  // The count is filled in once the races are written
+  bool ok = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+
+  ok = ok && stream.find("\"races\":[");
+  while (ok) {
+    JsonArenaScope arena_scope(name);
+    JsonDocument doc(json_arena_allocator());
+    DeserializationError error = deserializeJson(doc, stream);
+    if (error) {
+      Serial.printf("%s calendar deserializeJson() failed: %s\n", name, error.c_str());
+      ok = false;
+      break;
+    }
+
+    calendar_race race = {};
+    if (parse_race(doc.as<JsonVariant>(), race)) {
+      ok = file.write((const uint8_t *)&race, sizeof(race)) == sizeof(race);
+      header.count++;
+    }
+    // The backend writes compact JSON, races are followed by a comma or the
+    // end of the array. Anything else is a cut off response.
+    char separator = 0;
+    if (stream.readBytes(&separator, 1) != 1 || separator != ',') {
+      ok = ok && separator == ']';
+      break;
+    }
+  }
+
+  ok = ok && header.count > 0 && file.seek(0) &&
+       file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+  file.close();
+  // LittleFS renames over the old file in one step, a reset in between
+  // leaves either the old calendar or the new one
+  if (!ok || !LittleFS.rename(tmp_path, path)) {
+    LittleFS.remove(tmp_path);
+    Serial.printf("%s calendar could not be stored\n", name);
+    return false;
+  }
+
+  Serial.printf("[CALENDAR] %s: %u races stored in %lu us\n", name, header.count, micros() - start);
+  return true;
+}
+
+bool calendar_fetch(const char * name, const String & url, bool & changed) {
+  changed = false;
+  if (!calendar_mount()) {
+    return false;
+  }
+
+  String path = calendar_path(name);
+  calendar_header stored;
+  bool have_stored = false;
+  File file = LittleFS.open(path, "r");
+  if (file) {
+    have_stored = read_header(file, stored);
+    file.close();
+  }
+
+  Serial.printf("Fetching %s calendar from: %s\n", name, url.c_str());
+  HTTPClient http;
+  // No chunked responses, races are parsed straight off the socket
+  http.useHTTP10(true);
+  http.begin(url);
+  const char * headers[] = {"ETag"};
+  http.collectHeaders(headers, 1);
+  if (have_stored && stored.etag[0]) {
+    http.addHeader("If-None-Match", stored.etag);
+  }
+  int httpCode = http.GET();
+  bool ok = false;
+
+  if (httpCode == HTTP_CODE_NOT_MODIFIED && have_stored) {
+    Serial.printf("[CALENDAR] %s: unchanged, %u races stored\n", name, stored.count);
+    ok = true;
+  } else if (httpCode == HTTP_CODE_OK) {
+    ok = changed = store_calendar(name, path, http.getStream(), http.header("ETag"));
+  } else if (httpCode > 0) {
+    Serial.printf("%s calendar request failed with HTTP code: %d\n", name, httpCode);
+  } else {
+    Serial.printf("%s calendar GET request failed, error: %s\n", name, http.errorToString(httpCode).c_str());
+  }
+  http.end();
+  return ok;
+}
+
+static const char * ordinal(int day) {
+  if (day >= 11 && day <= 13) {
+    return "th";
+  }
+  switch (day % 10) {
+    case 1: return "st";
+    case 2: return "nd";
+    case 3: return "rd";
+    default: return "th";
+  }
+}
+
+// Same text as the backend's display model, e.g. "Race: 8th June 2025 at 21:30"
+static void format_session(char * out, size_t size, const char * name, uint32_t start) {
+  char day[4];
+  char rest[32];
+  clock_format(day, sizeof(day), "%d", start);
+  clock_format(rest, sizeof(rest), "%B %Y at %H:%M", start);
+  int mday = atoi(day);
+  snprintf(out, size, "%s: %d%s %s", name, mday, ordinal(mday), rest);
+}
+
+bool calendar_next_race(const char * name, uint32_t now, RaceData & out) {
+  if (!calendar_mount()) {
+    return false;
+  }
+  File file = LittleFS.open(calendar_path(name), "r");
+  if (!file) {
+    return false;
+  }
+
+  calendar_header header;
+  calendar_race race;
+  calendar_race next;
+  bool found = false;
+  if (read_header(file, header)) {
+    for (int i = 0; i < header.count; i++) {
+      if (file.read((uint8_t *)&race, sizeof(race)) != sizeof(race)) {
+        break;
+      }
+      uint32_t starts = race.starts[SESSION_RACE];
+      if (starts > now && (!found || starts < next.starts[SESSION_RACE])) {
+        next = race;
+        found = true;
+      }
+    }
+  }
+  file.close();
+  if (!found) {
+    return false;
+  }
+
+  strlcpy(out.name, next.name, sizeof(out.name));
+  strlcpy(out.place, next.place, sizeof(out.place));
+  strlcpy(out.circuit, next.circuit, sizeof(out.circuit));
+  strlcpy(out.date, next.date, sizeof(out.date));
+  // Sessions a weekend does not have, such as a sprint, are left out
+  out.session_count = 0;
+  for (int i = 0; i < SESSION_COUNT; i++) {
+    if (next.starts[i] != 0) {
+      format_session(out.sessions[out.session_count], sizeof(out.sessions[0]), SESSION_NAMES[i], next.starts[i]);
+      out.session_times[out.session_count++] = next.starts[i];
+    }
+  }
+  return true;
+}
@@ -0,0 +1,47 @@
+#include "device_clock.h"
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "daysync_config.h"
+
+// Times before this mean the clock has not been synced since boot
+static const time_t CLOCK_VALID_AFTER = 1704067200; // 2024-01-01
+
+void clock_begin() {
+  configTzTime(CLOCK_TIMEZONE, NTP_SERVER_1, NTP_SERVER_2);
+  Serial.printf("[CLOCK] Syncing with %s, timezone %s\n", NTP_SERVER_1, CLOCK_TIMEZONE);
+}
+
+uint32_t clock_now() {
+  time_t now = time(NULL);
+  return now < CLOCK_VALID_AFTER ? 0 : (uint32_t)now;
+}
+
+void clock_format(char * out, size_t size, const char * format, uint32_t epoch) {
+  if (epoch == 0) {
+    out[0] = '\0';
+    return;
+  }
+  time_t t = epoch;
+  struct tm local;
+  localtime_r(&t, &local);
+  strftime(out, size, format, &local);
+}
+
+void clock_format_countdown(char * out, size_t size, uint32_t epoch) {
+  uint32_t now = clock_now();
+  if (now == 0 || epoch <= now) {
+    out[0] = '\0';
+    return;
+  }
+
+  uint32_t left = epoch - now;
+  if (left >= 86400) {
+    snprintf(out, size, "%lud %02luh", (unsigned long)(left / 86400), (unsigned long)(left % 86400 / 3600));
+  } else if (left >= 3600) {
+    snprintf(out, size, "%luh %02lum", (unsigned long)(left / 3600), (unsigned long)(left % 3600 / 60));
+  } else {
+    snprintf(out, size, "%lum %02lus", (unsigned long)(left / 60), (unsigned long)(left % 60));
+  }
+}
@@ -0,0 +1,453 @@
+#include "feeds.h"
+
+#include <WiFi.h>
+#include <HTTPClient.h>
+
+#include "json_arena.h"
+#include "device_clock.h"
+#include "calendar_store.h"
+#include "loop_watch.h"
+
+static void copy_field(char * dest, size_t size, const char * value) {
+  strlcpy(dest, value ? value : "", size);
+}
+
+// Fetch `count` symbols of feed F starting at `first` with one request and
+// parse them into their slots. The previous data of a symbol is kept if the
+// request fails or its entry does not parse.
+template <typename F>
+static bool fetch_feed(const String & query, int first, int count) {
+  const char * label = count == 1 ? F::symbols()[first].label : F::name();
+  String url = String(BASE_URL) + F::path() + query;
+  F::append_query(url);
+  Serial.printf("Fetching %s data from: %s\n", label, url.c_str());
+
+  HTTPClient http;
+  // HTTP/1.0 rules out chunked responses, so the body can be parsed straight
+  // from the socket without buffering it in a String first
+  http.useHTTP10(true);
+  http.begin(url);
+  int httpCode = http.GET();
+  bool ok = false;
+  uint32_t loaded = 0; // a bit for each symbol parsed
+
+  if (httpCode == HTTP_CODE_OK) {
+    unsigned long start = micros();
+    JsonArenaScope arena_scope(F::name());
+    JsonDocument doc(json_arena_allocator());
+    JsonDocument filter(json_arena_allocator());
+    DeserializationError error = F::filter(filter)
+      ? deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter))
+      : deserializeJson(doc, http.getStream());
+
+    if (!error) {
+      ok = true;
+      for (int i = 0; i < count; i++) {
+        JsonVariant value = F::BATCHED ? doc["quotes"][i].as<JsonVariant>() : doc.as<JsonVariant>();
+        bool parsed_ok;
+        if (F::MERGE) {
+          parsed_ok = F::parse(value, feed_store<F>::data[first + i]);
+        } else {
+          typename F::Model parsed = {};
+          parsed_ok = F::parse(value, parsed);
+          if (parsed_ok) {
+            feed_store<F>::data[first + i] = parsed;
+          }
+        }
+        if (parsed_ok) {
+          feed_store<F>::valid[first + i] = true;
+          loaded |= 1UL << i;
+        } else {
+          Serial.printf("%s API response has no usable data\n", F::symbols()[first + i].label);
+          ok = false;
+        }
+      }
+      // Includes reading the body off the socket
+      Serial.printf("[PARSE] %s in %lu us\n", label, micros() - start);
+    } else {
+      Serial.printf("%s deserializeJson() failed: %s\n", label, error.c_str());
+    }
+  } else if (httpCode > 0) {
+    Serial.printf("%s API request failed with HTTP code: %d\n", label, httpCode);
+  } else {
+    Serial.printf("%s API GET request failed, error: %s\n", label, http.errorToString(httpCode).c_str());
+  }
+  http.end();
+
+  for (int i = 0; i < count; i++) {
+    if (loaded & (1UL << i)) {
+      F::loaded(first + i);
+    }
+  }
+  return ok;
+}
+
+#if FEED_FINANCE || FEED_CRYPTO
+// Add the price symbol `index` just loaded to its history, which is read back
+// from flash the first time. A price the same as the last one, e.g. a quote
+// the backend has not refreshed yet, is not written to flash; a reboot only
+// loses flat points.
+template <typename F>
+static void record_price(int index) {
+  static bool restored[F::COUNT];
+  const char * key = F::symbols()[index].query;
+  price_history & history = feed_store<F>::history[index];
+  if (!restored[index]) {
+    restored[index] = true;
+    price_history_load(key, history);
+  }
+  price_point point = feed_store<F>::data[index].point;
+  bool unchanged = history.count > 0 && point.exponent == history.exponent && point.value == history.last;
+  price_history_add(history, point);
+  if (!unchanged) {
+    price_history_save(key, history);
+  }
+}
+
+static void parse_point(JsonVariant value, price_point & out) {
+  out.value = value["point"] | 0;
+  out.exponent = value["exponent"] | 0;
+}
+#endif
+
+// Whether feed F has expired and should be fetched again
+template <typename F>
+static bool feed_due(bool force) {
+  const feed_status & status = feed_store<F>::status;
+  return force || status.last_attempt == 0 || millis() - status.last_attempt >= status.interval;
+}
+
+// Schedule the next fetch of feed F. A feed that failed is retried after
+// FEED_RETRY_INTERVAL rather than its TTL.
+template <typename F>
+static void feed_fetched(bool ok) {
+  feed_status & status = feed_store<F>::status;
+  status.last_attempt = millis();
+  status.interval = ok ? F::ttl() : FEED_RETRY_INTERVAL;
+}
+
+// Fetch every symbol of feed F if its data has expired
+template <typename F>
+static bool refresh_feed(bool force) {
+  if (!feed_due<F>(force)) {
+    return false;
+  }
+
+  bool ok = true;
+  if (F::BATCHED) {
+    String symbols;
+    for (int i = 0; i < F::COUNT; i++) {
+      if (i > 0) {
+        symbols += ",";
+      }
+      symbols += F::symbols()[i].query;
+    }
+    ok = fetch_feed<F>(symbols, 0, F::COUNT);
+  } else {
+    for (int i = 0; i < F::COUNT; i++) {
+      ok = fetch_feed<F>(F::symbols()[i].query, i, 1) && ok;
+    }
+  }
+
+  feed_fetched<F>(ok);
+  return true;
+}
+
+#if FEED_MOTOGP || FEED_F1
+// Show the first race in the stored calendar that has not started. The
+// calendar is only read again when the race shown has started, or with
+// `rescan` after a new calendar was stored; a calendar with no races left is
+// read at most once per FEED_RETRY_INTERVAL. Nothing is picked until the
+// clock is set. Returns true if the race changed.
+template <typename F>
+static bool select_next_race(bool rescan) {
+  static unsigned long last_scan = 0;
+  RaceData & race = feed_store<F>::data[0];
+  bool & valid = feed_store<F>::valid[0];
+  uint32_t now = clock_now();
+  if (now == 0) {
+    return false;
+  }
+  if (!rescan) {
+    // The last session is the race
+    if (valid && race.session_times[race.session_count - 1] > now) {
+      return false;
+    }
+    if (last_scan != 0 && millis() - last_scan < FEED_RETRY_INTERVAL) {
+      return false;
+    }
+  }
+  last_scan = millis();
+
+  // Zeroed so that an unchanged race compares equal. Without a next race the
+  // one shown stays up.
+  RaceData next = {};
+  if (!calendar_next_race(F::name(), now, next) || (valid && memcmp(&next, &race, sizeof(next)) == 0)) {
+    return false;
+  }
+  race = next;
+  valid = true;
+  Serial.printf("[CALENDAR] %s: next race is %s\n", F::name(), race.name);
+  return true;
+}
+
+template <typename F>
+static bool update_race() {
+  return select_next_race<F>(false);
+}
+
+// Check the stored calendar of race feed F with the backend if it has expired
+template <typename F>
+static bool refresh_calendar(bool force) {
+  if (!feed_due<F>(force)) {
+    return false;
+  }
+
+  bool changed = false;
+  bool ok = calendar_fetch(F::name(), String(BASE_URL) + F::path(), changed);
+  if (changed) {
+    select_next_race<F>(true);
+  }
+  feed_fetched<F>(ok);
+  return true;
+}
+#endif
+
+struct feed_entry {
+  const char * name;
+  bool (*refresh)(bool force);
+  // Work done on the device between fetches, online or not. NULL for most
+  // feeds.
+  bool (*update)();
+};
+
+// Feeds in fetch order
+static const feed_entry FEEDS[] = {
+#if FEED_WEATHER
+  {"weather", refresh_feed<WeatherFeed>, NULL},
+#endif
+#if FEED_MOTOGP
+  {"motogp", refresh_calendar<MotoGPFeed>, update_race<MotoGPFeed>},
+#endif
+#if FEED_F1
+  {"f1", refresh_calendar<F1Feed>, update_race<F1Feed>},
+#endif
+#if FEED_FINANCE
+  {"finance", refresh_feed<FinanceFeed>, NULL},
+#endif
+#if FEED_CRYPTO
+  {"crypto", refresh_feed<CryptoFeed>, NULL},
+#endif
+#if FEED_NEWS
+  {"news", refresh_feed<NewsFeed>, NULL},
+#endif
+  {NULL, NULL, NULL}
+};
+
+bool feeds_refresh(bool force) {
+  bool online = WiFi.status() == WL_CONNECTED;
+  bool refreshed = false;
+  for (const feed_entry * feed = FEEDS; feed->refresh; feed++) {
+    loop_watch_stage(LOOP_STAGE_REFRESH, feed->name);
+    if (online && feed->refresh(force)) {
+      refreshed = true;
+    }
+    if (feed->update && feed->update()) {
+      refreshed = true;
+    }
+  }
+  return refreshed;
+}
+
+#if FEED_WEATHER
+const feed_symbol * WeatherFeed::symbols() {
+  static const feed_symbol symbols[COUNT] = {{WEATHER_LOCATION, "Weather"}};
+  return symbols;
+}
+
+bool WeatherFeed::parse(JsonVariant value, WeatherData & out) {
+  if (value["temperature"].isNull()) {
+    return false;
+  }
+  copy_field(out.date, sizeof(out.date), value["date"]);
+  copy_field(out.temperature, sizeof(out.temperature), value["temperature"]);
+  copy_field(out.humidity, sizeof(out.humidity), value["humidity"]);
+  copy_field(out.details, sizeof(out.details), value["details"]);
+  copy_field(out.updated, sizeof(out.updated), value["updated"]);
+  out.code = value["code"] | -1;
+  out.day = value["day"] | true;
+  out.fetched_at = clock_now();
+  return true;
+}
+#endif
+
+#if FEED_MOTOGP
+// Calendars take no query, the symbol only names the screen
+const feed_symbol * MotoGPFeed::symbols() {
+  static const feed_symbol symbols[COUNT] = {{"", "MotoGP"}};
+  return symbols;
+}
+#endif
+
+#if FEED_F1
+const feed_symbol * F1Feed::symbols() {
+  static const feed_symbol symbols[COUNT] = {{"", "Formula 1"}};
+  return symbols;
+}
+#endif
+
+#if FEED_FINANCE
+// The first symbol is the headline index on the stocks screen
+const feed_symbol * FinanceFeed::symbols() {
+  static const feed_symbol symbols[COUNT] = {
+    {"^GSPC", "S&P 500"},
+    {"NDQ.AX", "NDQ"},
+    {"VAS.AX", "VAS"},
+    {"VGS.AX", "VGS"},
+  };
+  return symbols;
+}
+
+bool FinanceFeed::parse(JsonVariant value, StockData & out) {
+  const char * change = value["change"];
+  if (!change) {
+    return false;
+  }
+  copy_field(out.range, sizeof(out.range), value["range"]);
+  copy_field(out.change, sizeof(out.change), change);
+  out.change_color = strtoul(value["color"] | "000000", NULL, 16);
+  parse_point(value, out.point);
+  return true;
+}
+
+void FinanceFeed::loaded(int index) {
+  record_price<FinanceFeed>(index);
+}
+#endif
+
+#if FEED_CRYPTO
+// The first symbol is shown large on the crypto screen, the rest below it
+const feed_symbol * CryptoFeed::symbols() {
+  static const feed_symbol symbols[COUNT] = {
+    {"BTCUSD", "BTC"},
+    {"ETHUSD", "ETH"},
+    {"XRPUSD", "XRP"},
+    {"DOGEUSD", "DOGE"},
+    {"BNBUSD", "BNB"},
+  };
+  return symbols;
+}
+
+bool CryptoFeed::parse(JsonVariant value, QuoteData & out) {
+  const char * price = value["price"];
+  if (!price) {
+    return false;
+  }
+  copy_field(out.headline, sizeof(out.headline), value["headline"]);
+  copy_field(out.price, sizeof(out.price), price);
+  parse_point(value, out.point);
+  return true;
+}
+
+void CryptoFeed::loaded(int index) {
+  record_price<CryptoFeed>(index);
+}
+#endif
+
+#if FEED_NEWS
+const feed_symbol * NewsFeed::symbols() {
+  static const feed_symbol symbols[COUNT] = {{NEWS_COUNTRY, "News"}};
+  return symbols;
+}
+
+// Ring slot of headline `index` counting from the oldest
+static int news_slot(const NewsData & news, int index) {
+  return (news.head + index) % NEWS_MAX_ARTICLES;
+}
+
+static int news_find(const NewsData & news, const char * id) {
+  for (int i = 0; i < news.count; i++) {
+    if (strcmp(news.ids[news_slot(news, i)], id) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Drop a headline, moving the newer ones down a slot
+static void news_evict(NewsData & news, const char * id) {
+  int index = news_find(news, id);
+  if (index < 0) {
+    return;
+  }
+  for (int i = index; i < news.count - 1; i++) {
+    int slot = news_slot(news, i);
+    int next = news_slot(news, i + 1);
+    memcpy(news.ids[slot], news.ids[next], NEWS_ID_SIZE);
+    memcpy(news.titles[slot], news.titles[next], NEWS_TITLE_SIZE);
+  }
+  news.count--;
+}
+
+// Add a headline as the newest, over the oldest once the ring is full
+static void news_push(NewsData & news, const char * id, const char * title) {
+  if (news_find(news, id) >= 0) {
+    return;
+  }
+  int slot;
+  if (news.count == NEWS_MAX_ARTICLES) {
+    slot = news.head;
+    news.head = (news.head + 1) % NEWS_MAX_ARTICLES;
+  } else {
+    slot = news_slot(news, news.count++);
+  }
+  copy_field(news.ids[slot], NEWS_ID_SIZE, id);
+  copy_field(news.titles[slot], NEWS_TITLE_SIZE, title);
+  // A title cut by the copy must not end part way through a character
+  size_t length = strlen(news.titles[slot]);
+  if (length == NEWS_TITLE_SIZE - 1) {
+    while (length > 0 && (news.titles[slot][length - 1] & 0xC0) == 0x80) {
+      length--;
+    }
+    if (length > 0 && (news.titles[slot][length - 1] & 0xC0) == 0xC0) {
+      length--;
+    }
+    news.titles[slot][length] = '\0';
+  }
+}
+
+// The cursor is the IDs of the headlines held, empty to get them all
+void NewsFeed::append_query(String & url) {
+  url += "&since=";
+  const NewsData * news = feed_data<NewsFeed>();
+  for (int i = 0; news && i < news->count; i++) {
+    if (i > 0) {
+      url += ",";
+    }
+    url += news->ids[news_slot(*news, i)];
+  }
+}
+
+bool NewsFeed::parse(JsonVariant value, NewsData & out) {
+  // New headlines come top story first
+  JsonArray headlines = value["headlines"];
+  JsonArray evict = value["evict"];
+  if (headlines.isNull() || evict.isNull()) {
+    return false;
+  }
+  for (JsonVariant id : evict) {
+    news_evict(out, id | "");
+  }
+  // Pushed last to first, so the top story ends up the newest
+  int added = headlines.size();
+  for (int i = added - 1; i >= 0; i--) {
+    JsonVariant headline = headlines[i];
+    const char * id = headline["id"];
+    if (id) {
+      news_push(out, id, headline["title"]);
+    }
+  }
+  Serial.printf("[NEWS] %d new, %u evicted, %d held\n", added, (unsigned)evict.size(), out.count);
+  return true;
+}
+#endif
@@ -0,0 +1,163 @@
+#include "json_arena.h"
+#include "mem_pools.h"
+
+#include <Arduino.h>
+
+// Every block is preceded by its requested size so reallocate() can copy it
+static const size_t BLOCK_HEADER = 8;
+
+static size_t align_up(size_t n) {
+  return (n + 7) & ~(size_t)7;
+}
+
+// High-water mark and overflow count per feed
+struct feed_stats {
+  const char * name;
+  size_t high_water;
+  unsigned int parses;
+  unsigned int overflows;
+};
+
+static const int MAX_FEEDS = 12;
+static feed_stats feeds[MAX_FEEDS];
+static int feed_count = 0;
+static feed_stats * active_feed = nullptr;
+
+static JsonArena arena;
+
+static feed_stats * find_feed(const char * name) {
+  for (int i = 0; i < feed_count; i++) {
+    if (strcmp(feeds[i].name, name) == 0) {
+      return &feeds[i];
+    }
+  }
+  if (feed_count < MAX_FEEDS) {
+    feeds[feed_count] = {name, 0, 0, 0};
+    return &feeds[feed_count++];
+  }
+  return nullptr;
+}
+
+bool JsonArena::begin(size_t arena_size) {
+  base = (uint8_t *)mem_alloc_large(arena_size, "JSON arena");
+  size = base ? arena_size : 0;
+  top = 0;
+  high = 0;
+  last = SIZE_MAX;
+  return base != nullptr;
+}
+
+void * JsonArena::allocate(size_t n) {
+  size_t need = BLOCK_HEADER + align_up(n);
+  if (!base || top + need > size) {
+    if (active_feed) {
+      active_feed->overflows++;
+    }
+    Serial.printf("[JSON] Arena exhausted (%u + %u > %u) in %s\n", (unsigned)top, (unsigned)need,
+                  (unsigned)size, active_feed ? active_feed->name : "unknown feed");
+    return nullptr;
+  }
+
+  uint8_t * block = base + top;
+  *(size_t *)block = n;
+  last = top;
+  top += need;
+  if (top > high) {
+    high = top;
+  }
+  return block + BLOCK_HEADER;
+}
+
+void JsonArena::deallocate(void * pointer) {
+  if (!pointer) {
+    return;
+  }
+  // Only the most recent block can be given back, the rest is reclaimed
+  // when the scope ends.
+  size_t offset = (uint8_t *)pointer - BLOCK_HEADER - base;
+  if (offset == last) {
+    top = last;
+    last = SIZE_MAX;
+  }
+}
+
+void * JsonArena::reallocate(void * pointer, size_t new_size) {
+  if (!pointer) {
+    return allocate(new_size);
+  }
+
+  uint8_t * block = (uint8_t *)pointer - BLOCK_HEADER;
+  size_t offset = block - base;
+  size_t old_size = *(size_t *)block;
+
+  // Grow or shrink the most recent block in place
+  if (offset == last) {
+    size_t end = offset + BLOCK_HEADER + align_up(new_size);
+    if (end > size) {
+      if (active_feed) {
+        active_feed->overflows++;
+      }
+      Serial.printf("[JSON] Arena exhausted growing block to %u in %s\n", (unsigned)new_size,
+                    active_feed ? active_feed->name : "unknown feed");
+      return nullptr;
+    }
+    *(size_t *)block = new_size;
+    top = end;
+    if (top > high) {
+      high = top;
+    }
+    return pointer;
+  }
+
+  if (new_size <= old_size) {
+    return pointer;
+  }
+
+  void * moved = allocate(new_size);
+  if (moved) {
+    memcpy(moved, pointer, old_size);
+  }
+  return moved;
+}
+
+JsonArenaScope::JsonArenaScope(const char * feed_name)
+  : stats(find_feed(feed_name)), parent_stats(active_feed),
+    mark(arena.top), saved_high(arena.high), saved_last(arena.last) {
+  arena.high = arena.top;
+  active_feed = stats;
+}
+
+JsonArenaScope::~JsonArenaScope() {
+  if (stats) {
+    size_t used = arena.high - mark;
+    if (used > stats->high_water) {
+      stats->high_water = used;
+    }
+    stats->parses++;
+  }
+
+  if (saved_high > arena.high) {
+    arena.high = saved_high;
+  }
+  arena.top = mark;
+  arena.last = saved_last;
+  active_feed = parent_stats;
+}
+
+void json_arena_init() {
+  if (!arena.begin(JSON_ARENA_SIZE)) {
+    Serial.println("[JSON] Failed to reserve JSON arena");
+  }
+}
+
+ArduinoJson::Allocator * json_arena_allocator() {
+  return &arena;
+}
+
+void json_arena_report() {
+  Serial.printf("[JSON] Arena %u bytes, in use %u\n", (unsigned)arena.capacity(), (unsigned)arena.used());
+  for (int i = 0; i < feed_count; i++) {
+    Serial.printf("[JSON]   %-10s high-water %6u bytes over %u parses, %u overflows\n", feeds[i].name,
+                  (unsigned)feeds[i].high_water, feeds[i].parses, feeds[i].overflows);
+  }
+}
@@ -0,0 +1,149 @@
+#include "loop_watch.h"
+
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_idf_version.h>
+#include <esp_system.h>
+#include <esp_task_wdt.h>
+
+#include "daysync_config.h"
+
+static const char * const STAGE_NAMES[LOOP_STAGE_COUNT] = {
+  "setup", "lvgl", "wifi", "touch", "refresh", "prerender", "switch", "idle",
+};
+
+// What the loop was doing, kept across resets other than power-on
+#define BREADCRUMB_MAGIC 0x4C505731 // "LPW1"
+struct loop_breadcrumb {
+  uint32_t magic;
+  uint32_t stage;
+  char detail[16];
+  uint32_t entered;    // millis() when the stage was entered
+  uint32_t iterations; // loop iterations of the run
+};
+RTC_NOINIT_ATTR static loop_breadcrumb breadcrumb;
+
+// The iteration being run
+static unsigned long iteration_start;
+static unsigned long part_start;
+static loop_stage part_stage = LOOP_STAGE_SETUP;
+static const char * part_detail = NULL;
+static unsigned long slowest_ms;
+static loop_stage slowest_stage;
+static const char * slowest_detail;
+
+static unsigned long stalls = 0;
+static unsigned long last_wdt_reset = 0;
+
+static const char * reset_reason_name(esp_reset_reason_t reason) {
+  switch (reason) {
+    case ESP_RST_POWERON: return "power-on";
+    case ESP_RST_SW: return "restart";
+    case ESP_RST_PANIC: return "crash";
+    case ESP_RST_INT_WDT: return "interrupt watchdog";
+    case ESP_RST_TASK_WDT: return "task watchdog";
+    case ESP_RST_WDT: return "watchdog";
+    case ESP_RST_BROWNOUT: return "brownout";
+    case ESP_RST_DEEPSLEEP: return "deep sleep";
+    default: return "other";
+  }
+}
+
+// The watchdog is fed at most once a second, entering a stage is frequent
+static void feed_watchdog(unsigned long now) {
+  if (now - last_wdt_reset >= 1000) {
+    esp_task_wdt_reset();
+    last_wdt_reset = now;
+  }
+}
+
+// Close the part of the stage being run, keeping it if it is the slowest of
+// the iteration
+static void end_part(unsigned long now) {
+  unsigned long elapsed = now - part_start;
+  if (elapsed > slowest_ms) {
+    slowest_ms = elapsed;
+    slowest_stage = part_stage;
+    slowest_detail = part_detail;
+  }
+}
+
+static void start_part(loop_stage stage, const char * detail, unsigned long now) {
+  part_stage = stage;
+  part_detail = detail;
+  part_start = now;
+
+  breadcrumb.stage = stage;
+  strlcpy(breadcrumb.detail, detail ? detail : "", sizeof(breadcrumb.detail));
+  breadcrumb.entered = now;
+}
+
+void loop_watch_begin() {
+  esp_reset_reason_t reason = esp_reset_reason();
+  Serial.printf("[WATCHDOG] Reset by %s\n", reset_reason_name(reason));
+  if (reason != ESP_RST_POWERON && breadcrumb.magic == BREADCRUMB_MAGIC && breadcrumb.stage < LOOP_STAGE_COUNT) {
+    breadcrumb.detail[sizeof(breadcrumb.detail) - 1] = '\0';
+    Serial.printf("[WATCHDOG] Previous run was in %s%s%s%s, entered %lu ms after boot, after %lu loop iterations\n",
+                  STAGE_NAMES[breadcrumb.stage], breadcrumb.detail[0] ? " (" : "", breadcrumb.detail,
+                  breadcrumb.detail[0] ? ")" : "", (unsigned long)breadcrumb.entered,
+                  (unsigned long)breadcrumb.iterations);
+  }
+
+  breadcrumb.magic = BREADCRUMB_MAGIC;
+  breadcrumb.iterations = 0;
+  unsigned long now = millis();
+  start_part(LOOP_STAGE_SETUP, NULL, now);
+  iteration_start = now;
+  slowest_ms = 0;
+
+  // Arduino only watches the idle tasks; the timeout applies to them too
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_task_wdt_config_t config = {};
+  config.timeout_ms = LOOP_WATCHDOG_TIMEOUT * 1000;
+  config.trigger_panic = true;
+#if CONFIG_ESP_TASK_WDT_CHECK_IDLE_TASK_CPU0
+  config.idle_core_mask |= 1 << 0;
+#endif
+#if CONFIG_ESP_TASK_WDT_CHECK_IDLE_TASK_CPU1
+  config.idle_core_mask |= 1 << 1;
+#endif
+  if (esp_task_wdt_reconfigure(&config) != ESP_OK) {
+    esp_task_wdt_init(&config);
+  }
+#else
+  esp_task_wdt_init(LOOP_WATCHDOG_TIMEOUT, true);
+#endif
+  esp_task_wdt_add(NULL);
+  last_wdt_reset = now;
+}
+
+void loop_watch_stage(loop_stage stage, const char * detail) {
+  unsigned long now = millis();
+  if (part_stage == LOOP_STAGE_SETUP) {
+    // The first iteration starts here, setup() is not part of it
+    iteration_start = now;
+  } else {
+    end_part(now);
+  }
+  start_part(stage, detail, now);
+  feed_watchdog(now);
+}
+
+void loop_watch_end() {
+  unsigned long now = millis();
+  end_part(now);
+
+  unsigned long elapsed = now - iteration_start;
+  if (elapsed > LOOP_STALL_THRESHOLD) {
+    stalls++;
+    Serial.printf("[STALL] Loop took %lu ms, %lu ms of it in %s%s%s%s | %lu stalls\n", elapsed, slowest_ms,
+                  STAGE_NAMES[slowest_stage], slowest_detail ? " (" : "", slowest_detail ? slowest_detail : "",
+                  slowest_detail ? ")" : "", stalls);
+  }
+
+  breadcrumb.iterations++;
+  start_part(LOOP_STAGE_IDLE, NULL, now);
+  iteration_start = now;
+  slowest_ms = 0;
+  feed_watchdog(now);
+}
@@ -5,101 +5,67 @@
 #include <TFT_eSPI.h>
 
 #include <WiFi.h>
-#include <HTTPClient.h>
-#include <ArduinoJson.h>
-
-// Base URL for all API calls
-const char* BASE_URL = "https://daysync.karan.myds.me";
-
-// Base URL for local development - replace 192.168.50.180 with your computer's IP address
-// const char* BASE_URL = "http://192.168.50.180:5173";
-
-// Enter your location
-String location = "Adelaide";
-// Type the timezone you want to get the time for
-String timezone = "Adelaide/Australia";
-
-// HTTP data caching
-const unsigned long HTTP_CACHE_INTERVAL = 3600000; // 60 minutes in milliseconds
-// const unsigned long HTTP_CACHE_INTERVAL = 60000; // 1 minute in milliseconds for testing
-unsigned long last_weather_timestamp = 0;
-unsigned long last_motogp_timestamp = 0;
-unsigned long last_f1_timestamp = 0;
-unsigned long last_crypto_timestamp = 0;
-unsigned long last_news_timestamp = 0;
+
+#include "daysync_config.h"
+#include "mem_pools.h"
+#include "json_arena.h"
+#include "fonts.h"
+#include "feeds.h"
+#include "bitmap_screens.h"
+#include "wifi_manager.h"
+#include "device_clock.h"
+#include "news_view.h"
+#include "sparkline.h"
+#include "weather_icons.h"
+#include "loop_watch.h"
+#if TOUCH_ENABLED
+  #include "touch_input.h"
+#endif
+
 const unsigned long SCREEN_SWITCH_INTERVAL = 10000;   // 10 seconds in milliseconds
+const int NEWS_SCREEN_PAGES = 2; // pages of headlines per visit to the news screen
 unsigned long last_screen_switch = 0;
-int current_screen = 0; // 0 = weather, 1 = motogp, 2 = about
-
-// Store weather data
-String current_date;
-String last_weather_update;
-String temperature;
-String humidity;
-String wind_speed;
-String feels_like;
-String uv_index;
-String precipitation;
-String weather_description;
-
-// SET VARIABLE TO 0 FOR TEMPERATURE IN FAHRENHEIT DEGREES
-#define TEMP_CELSIUS 1
-
-#if TEMP_CELSIUS
-  String temperature_unit = "";
-  const char degree_symbol[] = "\u00B0C";
-#else
-  String temperature_unit = "&temperature_unit=fahrenheit";
-  const char degree_symbol[] = "\u00B0F";
-#endif
+unsigned long screen_interval = SCREEN_SWITCH_INTERVAL; // how long the screen shown stays up
+int current_screen = 0; // index into SCREENS, the next screen to show
+
+// Build the next screen in idle time so the switch itself is just a load.
+// Set to 0 to build screens at switch time (for comparing switch latency).
+#define PRERENDER_SCREENS 1
+const unsigned long PRERENDER_DELAY = 1000; // let the current screen finish drawing first
+lv_obj_t * prerendered_screen = NULL;
+
+// Transition used when a screen is loaded
+const lv_screen_load_anim_t SCREEN_TRANSITION = LV_SCR_LOAD_ANIM_NONE;
+const uint32_t SCREEN_TRANSITION_TIME = 0; // milliseconds
+
+// Switch latency, split by whether the screen was pre-rendered
+struct switch_stats {
+  unsigned long count;
+  unsigned long total_us;
+  unsigned long max_us;
+};
+switch_stats switch_stats_cold = {0, 0, 0};
+switch_stats switch_stats_warm = {0, 0, 0};
+
+// Status on the startup screen, NULL once the rotation has started
+lv_obj_t * startup_status_label = NULL;
 
 #define SCREEN_WIDTH 240
 #define SCREEN_HEIGHT 320
 
 #define DRAW_BUF_SIZE (SCREEN_WIDTH * SCREEN_HEIGHT / 10 * (LV_COLOR_DEPTH / 8))
-uint32_t draw_buf[DRAW_BUF_SIZE / 4];
-
-// MotoGP data variables
-String motogp_data;
-
-// MotoGP screen objects
-static lv_obj_t * motogp_label;
-
-// Crypto data variables
-String btc_data;
-String eth_data;
-String doge_data;
-String xrp_data;
-String bnb_data;
-
-// News data variables
-String news_data;
-
-// Store F1 data
-String f1_data;
-
-// Store finance data
-String sp500_data;
-String ndq_data;
-String vas_data;
-String vgs_data;
-unsigned long last_finance_timestamp = 0;
+// Allocated in setup() so it lands in PSRAM on boards that have it
+uint32_t * draw_buf;
 
 // Function declarations
-void get_weather_data();
-void get_weather_description(int code);
-void lv_create_main_gui(void);
-void get_motogp_data();
-void create_motogp_screen();
-void get_f1_data();
-void create_f1_screen();
-void get_finance_data();
-void create_finance_screen();
+lv_obj_t * lv_create_main_gui(void);
 void switch_screen();
-void get_all_crypto_data();
-void create_bitcoin_screen();
-void get_news_data();
-void create_news_screen(int page);
+
+// LVGL's clock. Its timers (touch reads, page turns, live labels) then run in
+// real time however long a loop pass takes.
+static uint32_t lv_tick_millis(void) {
+  return millis();
+}
 
 // If logging is enabled, it will inform the user about what is happening in the library
 void log_print(lv_log_level_t level, const char * buf) {
@@ -108,76 +74,59 @@ void log_print(lv_log_level_t level, const char * buf) {
   Serial.flush();
 }
 
-static lv_obj_t * weather_image;
 static lv_obj_t * text_label_date;
 static lv_obj_t * text_label_temperature;
 static lv_obj_t * text_label_humidity;
 static lv_obj_t * text_label_weather_description;
 static lv_obj_t * text_label_time_location;
 
-static void timer_cb(lv_timer_t * timer){
-  LV_UNUSED(timer);
-  get_weather_data();
-  lv_label_set_text(text_label_date, current_date.c_str());
-  lv_label_set_text(text_label_temperature, String(temperature + "°C").c_str());
-  lv_label_set_text(text_label_humidity, String(humidity + "%").c_str());
-  lv_label_set_text(text_label_weather_description, weather_description.c_str());
-  lv_label_set_text(text_label_time_location, String("Last Update: " + last_weather_update).c_str());
+// Writes the text of a live label. `arg` is the pointer the label was created
+// with.
+typedef void (*live_text_fn)(char * out, size_t size, const void * arg);
+
+struct live_label {
+  lv_obj_t * label;
+  lv_timer_t * timer;
+  live_text_fn text;
+  const void * arg;
+  char shown[64];
+};
+
+static void live_label_update(lv_timer_t * timer) {
+  live_label * live = (live_label *)lv_timer_get_user_data(timer);
+  char text[sizeof(live->shown)];
+  live->text(text, sizeof(text), live->arg);
+  // Only a changed label is redrawn
+  if (strcmp(text, live->shown) != 0) {
+    strlcpy(live->shown, text, sizeof(live->shown));
+    lv_label_set_text(live->label, text);
+  }
 }
 
-// Function to check if cache needs refresh
-bool should_refresh_cache(unsigned long last_timestamp) {
-  unsigned long current_time = millis();
-  // Handle millis() overflow and initial (0) case
-  return (last_timestamp == 0) || (current_time < last_timestamp) || (current_time - last_timestamp >= HTTP_CACHE_INTERVAL);
+static void live_label_deleted(lv_event_t * e) {
+  live_label * live = (live_label *)lv_event_get_user_data(e);
+  lv_timer_delete(live->timer);
+  lv_free(live);
 }
 
-void get_weather_data() {
-  if (WiFi.status() == WL_CONNECTED) {
-    HTTPClient http;
-    String url = String(BASE_URL) + "/api/weather?location=adelaide";
-    Serial.println("Fetching weather data from: " + url);
-    http.begin(url);
-    int httpCode = http.GET();
-
-    if (httpCode > 0) {
-      if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        Serial.println("Weather API Response:");
-        Serial.println(payload);
-        
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, payload);
-        
-        if (!error) {
-          temperature = String(doc["temperature"].as<float>(), 1);
-          humidity = String(doc["humidity"].as<int>());
-          wind_speed = String(doc["wind_speed"].as<float>(), 1);
-          feels_like = String(doc["feels_like"].as<float>(), 1);
-          uv_index = String(doc["uv_index"].as<int>());
-          precipitation = String(doc["precipitation"].as<float>(), 1);
-          
-          String local_time = doc["local_time"].as<String>();
-          current_date = local_time.substring(0, 10);
-          last_weather_update = local_time.substring(11, 16);
-          
-          weather_description = String("Wind: ") + wind_speed + "km/h | Feels: " + feels_like + "°C";
-          
-          last_weather_timestamp = millis();
-        } else {
-          Serial.print("deserializeJson() failed: ");
-          Serial.println(error.c_str());
-        }
-      } else {
-        Serial.println("Weather API request failed with HTTP code: " + String(httpCode));
-      }
-    } else {
-      Serial.printf("Weather API GET request failed, error: %s\n", http.errorToString(httpCode).c_str());
-    }
-    http.end();
-  } else {
-    Serial.println("Not connected to Wi-Fi for weather data");
-  }
+// A label worked out from the clock, such as a countdown. Its text is
+// refreshed every second for as long as the label exists; the timer counts
+// real seconds since LVGL's tick is millis().
+lv_obj_t * create_live_label(lv_obj_t * parent, live_text_fn text, const void * arg) {
+  live_label * live = (live_label *)lv_malloc(sizeof(live_label));
+  live->label = lv_label_create(parent);
+  live->text = text;
+  live->arg = arg;
+  live->shown[0] = '\0';
+  live->timer = lv_timer_create(live_label_update, 1000, live);
+  lv_obj_add_event_cb(live->label, live_label_deleted, LV_EVENT_DELETE, live);
+  live_label_update(live->timer);
+  return live->label;
+}
+
+static void clock_text(char * out, size_t size, const void * arg) {
+  LV_UNUSED(arg);
+  clock_format(out, size, "%H:%M", clock_now());
 }
 
 // Function to create a title bar
@@ -190,805 +139,616 @@ lv_obj_t* create_title_bar(lv_obj_t* parent, const char* title) {
   lv_obj_set_style_border_width(title_bar, 0, 0);
   lv_obj_set_style_pad_all(title_bar, 10, 0); // Add some padding
   lv_obj_set_style_radius(title_bar, 0, 0); // No rounded corners
-  
+
   lv_obj_t* title_label = lv_label_create(title_bar);
   lv_label_set_text(title_label, title);
-  lv_obj_set_style_text_font(title_label, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(title_label, FONT_16, 0);
   lv_obj_set_style_text_color(title_label, lv_color_white(), 0);
   lv_obj_align(title_label, LV_ALIGN_CENTER, 0, 0); // Center the text
-  
+
+  // Live clock, blank until it has synced
+  lv_obj_t* clock_label = create_live_label(title_bar, clock_text, NULL);
+  lv_obj_set_style_text_font(clock_label, FONT_14, 0);
+  lv_obj_set_style_text_color(clock_label, lv_color_white(), 0);
+  lv_obj_align(clock_label, LV_ALIGN_RIGHT_MID, 0, 0);
+
   return title_bar;
 }
 
-void create_about_screen() {
-  // Create a new screen for about information
-  lv_obj_t * about_screen = lv_obj_create(NULL);
-  lv_obj_set_style_bg_color(about_screen, lv_color_white(), 0);
-  
+// Create a new screen with a full size container and a title bar. Widgets go
+// in the returned container; lv_obj_get_screen() gives the screen back.
+lv_obj_t * create_screen_container(const char * title) {
+  lv_obj_t * screen = lv_obj_create(NULL);
+  lv_obj_set_style_bg_color(screen, lv_color_white(), 0);
+
   // Create a container for better layout
-  lv_obj_t * cont = lv_obj_create(about_screen);
+  lv_obj_t * cont = lv_obj_create(screen);
   lv_obj_set_size(cont, 320, 240); // Set to full screen size (rotated)
   lv_obj_set_pos(cont, 0, 0); // Position at absolute 0,0
   lv_obj_set_style_bg_color(cont, lv_color_white(), 0);
   lv_obj_set_style_border_width(cont, 0, 0);
   lv_obj_set_style_pad_all(cont, 0, 0);
-  
+
   // Add title bar
-  create_title_bar(cont, "About");
-  
+  create_title_bar(cont, title);
+
+  return cont;
+}
+
+// Shown in place of a feed's widgets until its data has loaded
+void create_error_label(lv_obj_t * parent, const char * feed_label) {
+  lv_obj_t * error_label = lv_label_create(parent);
+  lv_label_set_text_fmt(error_label, "Error loading %s data", feed_label);
+  lv_obj_set_style_text_font(error_label, FONT_20, 0);
+  lv_obj_align(error_label, LV_ALIGN_CENTER, 0, 0);
+}
+
+lv_obj_t * create_about_screen() {
+  lv_obj_t * cont = create_screen_container("About");
+
   // Version text
   lv_obj_t * version_label = lv_label_create(cont);
   lv_label_set_text(version_label, "Daysync v0.1");
-  lv_obj_set_style_text_font(version_label, &lv_font_montserrat_26, 0);
+  lv_obj_set_style_text_font(version_label, FONT_26, 0);
   lv_obj_set_style_text_color(version_label, lv_color_hex(0xE31837), 0);
   lv_obj_align(version_label, LV_ALIGN_TOP_MID, 0, 70);
 
   // Author label
   lv_obj_t * author_label = lv_label_create(cont);
   lv_label_set_text(author_label, "by bindok");
-  lv_obj_set_style_text_font(author_label, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(author_label, FONT_16, 0);
   lv_obj_set_style_text_color(author_label, lv_color_hex(0xE31837), 0);
   lv_obj_align(author_label, LV_ALIGN_TOP_MID, 0, 110);
-  
+
   // GitHub link
   lv_obj_t * github_label = lv_label_create(cont);
   lv_label_set_text(github_label, "github.com/intothevoid/daysync");
-  lv_obj_set_style_text_font(github_label, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(github_label, FONT_14, 0);
   lv_obj_set_style_text_color(github_label, lv_color_hex(0x808080), 0);
   lv_obj_align(github_label, LV_ALIGN_TOP_MID, 0, 140);
-  
-  // Load the screen
-  lv_screen_load(about_screen);
+
+  return lv_obj_get_screen(cont);
 }
 
-void lv_create_main_gui(void) {
-  // Create a new screen for weather data
-  lv_obj_t * weather_screen = lv_obj_create(NULL);
-  lv_obj_set_style_bg_color(weather_screen, lv_color_white(), 0);
-  
-  // Create a container for better layout
-  lv_obj_t * cont = lv_obj_create(weather_screen);
-  lv_obj_set_size(cont, 320, 240); // Set to full screen size (rotated)
-  lv_obj_set_pos(cont, 0, 0); // Position at absolute 0,0
-  lv_obj_set_style_bg_color(cont, lv_color_white(), 0);
-  lv_obj_set_style_border_width(cont, 0, 0);
-  lv_obj_set_style_pad_all(cont, 0, 0);
+#if FEED_WEATHER
+// Today's date from the clock, the date of the weather data until it is set
+static void weather_date_text(char * out, size_t size, const void * arg) {
+  const WeatherData * weather = (const WeatherData *)arg;
+  uint32_t now = clock_now();
+  if (now) {
+    clock_format(out, size, "%Y-%m-%d", now);
+  } else {
+    strlcpy(out, weather->date, size);
+  }
+}
 
-  // Add title bar
-  create_title_bar(cont, "Weather (Adelaide)");
+// When the weather was loaded and how long ago
+static void weather_updated_text(char * out, size_t size, const void * arg) {
+  const WeatherData * weather = (const WeatherData *)arg;
+  uint32_t now = clock_now();
+  if (!now || !weather->fetched_at) {
+    strlcpy(out, weather->updated, size);
+    return;
+  }
+  char at[8];
+  clock_format(at, sizeof(at), "%H:%M", weather->fetched_at);
+  snprintf(out, size, "Last Update: %s (%lu min ago)", at, (unsigned long)(now - weather->fetched_at) / 60);
+}
+
+// Show the icon and name of WMO weather `code` on the weather screen being
+// built. The icon is decoded the first time the conditions are shown and comes
+// from the icon cache after that.
+// Put the icon and name of the weather's condition on `image` and `label`.
+// An unknown condition has no icon, so the image is hidden.
+void show_weather_conditions(const WeatherData & weather, lv_obj_t * image, lv_obj_t * label) {
+  const lv_image_dsc_t * icon = weather_icon(weather.code, weather.day);
+  if (icon) {
+    lv_image_set_src(image, icon);
+  } else {
+    lv_obj_add_flag(image, LV_OBJ_FLAG_HIDDEN);
+  }
+  lv_label_set_text(label, weather_name(weather.code));
+}
+
+lv_obj_t * lv_create_main_gui(void) {
+  lv_obj_t * cont = create_screen_container("Weather (Adelaide)");
+
+  const WeatherData * weather = feed_data<WeatherFeed>();
+  if (!weather) {
+    create_error_label(cont, "weather");
+    return lv_obj_get_screen(cont);
+  }
 
   // Date label below title bar
-  text_label_date = lv_label_create(cont);
-  lv_label_set_text(text_label_date, current_date.c_str());
-  lv_obj_set_style_text_font(text_label_date, &lv_font_montserrat_20, 0);
+  text_label_date = create_live_label(cont, weather_date_text, weather);
+  lv_obj_set_style_text_font(text_label_date, FONT_20, 0);
   lv_obj_set_style_text_color(text_label_date, lv_color_hex(0xE31837), 0);
   lv_obj_align(text_label_date, LV_ALIGN_TOP_MID, 0, 50);
 
+  // Conditions icon and name on the left
+  lv_obj_t * weather_image = lv_image_create(cont);
+  lv_obj_set_style_image_recolor(weather_image, lv_color_hex(0x2196F3), 0);
+  lv_obj_set_style_image_recolor_opa(weather_image, LV_OPA_COVER, 0);
+  lv_obj_align(weather_image, LV_ALIGN_LEFT_MID, 24, -28);
+
+  lv_obj_t * text_label_condition = lv_label_create(cont);
+  lv_obj_set_width(text_label_condition, 96);
+  lv_label_set_long_mode(text_label_condition, LV_LABEL_LONG_WRAP);
+  lv_obj_set_style_text_align(text_label_condition, LV_TEXT_ALIGN_CENTER, 0);
+  lv_obj_set_style_text_font(text_label_condition, FONT_14, 0);
+  lv_obj_align(text_label_condition, LV_ALIGN_LEFT_MID, 0, 10);
+  show_weather_conditions(*weather, weather_image, text_label_condition);
+
   // Temperature section
   lv_obj_t * temp_label = lv_label_create(cont);
   lv_label_set_text(temp_label, "Temperature");
-  lv_obj_set_style_text_font(temp_label, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(temp_label, FONT_16, 0);
   lv_obj_align(temp_label, LV_ALIGN_CENTER, 0, -40);
 
   text_label_temperature = lv_label_create(cont);
-  lv_label_set_text(text_label_temperature, String(temperature + "°C").c_str());
-  lv_obj_set_style_text_font(text_label_temperature, &lv_font_montserrat_26, 0);
+  lv_label_set_text(text_label_temperature, weather->temperature);
+  lv_obj_set_style_text_font(text_label_temperature, FONT_26, 0);
   lv_obj_align(text_label_temperature, LV_ALIGN_CENTER, 0, -10);
 
   // Humidity section
   lv_obj_t * hum_label = lv_label_create(cont);
   lv_label_set_text(hum_label, "Humidity");
-  lv_obj_set_style_text_font(hum_label, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(hum_label, FONT_16, 0);
   lv_obj_align(hum_label, LV_ALIGN_CENTER, 0, 30);
 
   text_label_humidity = lv_label_create(cont);
-  lv_label_set_text(text_label_humidity, String(humidity + "%").c_str());
-  lv_obj_set_style_text_font(text_label_humidity, &lv_font_montserrat_20, 0);
+  lv_label_set_text(text_label_humidity, weather->humidity);
+  lv_obj_set_style_text_font(text_label_humidity, FONT_20, 0);
   lv_obj_align(text_label_humidity, LV_ALIGN_CENTER, 0, 60);
 
   // Weather description at the bottom
   text_label_weather_description = lv_label_create(cont);
-  lv_label_set_text(text_label_weather_description, weather_description.c_str());
-  lv_obj_set_style_text_font(text_label_weather_description, &lv_font_montserrat_16, 0);
+  lv_label_set_text(text_label_weather_description, weather->details);
+  lv_obj_set_style_text_font(text_label_weather_description, FONT_16, 0);
   lv_obj_align(text_label_weather_description, LV_ALIGN_BOTTOM_MID, 0, -30);
 
   // Last update time at the very bottom
-  text_label_time_location = lv_label_create(cont);
-  lv_label_set_text(text_label_time_location, String("Last Update: " + last_weather_update).c_str());
-  lv_obj_set_style_text_font(text_label_time_location, &lv_font_montserrat_14, 0);
+  text_label_time_location = create_live_label(cont, weather_updated_text, weather);
+  lv_obj_set_style_text_font(text_label_time_location, FONT_14, 0);
   lv_obj_set_style_text_color(text_label_time_location, lv_color_hex(0x808080), 0);
   lv_obj_align(text_label_time_location, LV_ALIGN_BOTTOM_MID, 0, -5);
 
-  // Load the screen
-  lv_screen_load(weather_screen);
+  return lv_obj_get_screen(cont);
 }
+#endif
 
-void get_motogp_data() {
-  if (WiFi.status() == WL_CONNECTED) {
-    HTTPClient http;
-    String url = String(BASE_URL) + "/api/motogpnextrace?timezone=ACDT";
-    Serial.println("Fetching MotoGP data from: " + url);
-    http.begin(url);
-    int httpCode = http.GET();
-
-    if (httpCode > 0) {
-      if (httpCode == HTTP_CODE_OK) {
-        motogp_data = http.getString();
-        Serial.println("MotoGP API Response:");
-        Serial.println(motogp_data);
-        last_motogp_timestamp = millis();
-      } else {
-        Serial.println("MotoGP API request failed with HTTP code: " + String(httpCode));
-      }
-    } else {
-      Serial.printf("MotoGP API GET request failed, error: %s\n", http.errorToString(httpCode).c_str());
+// The race date and a countdown to the next session that has not started,
+// e.g. "8th June 2025 | Race in 6d 21h"
+static void race_date_text(char * out, size_t size, const void * arg) {
+  const RaceData * race = (const RaceData *)arg;
+  for (int i = 0; i < race->session_count; i++) {
+    char countdown[16];
+    clock_format_countdown(countdown, sizeof(countdown), race->session_times[i]);
+    if (countdown[0]) {
+      // Sessions are "Name: time"
+      const char * colon = strchr(race->sessions[i], ':');
+      int name_length = colon ? colon - race->sessions[i] : 0;
+      snprintf(out, size, "%s | %.*s in %s", race->date, name_length, race->sessions[i], countdown);
+      return;
     }
-    http.end();
-  } else {
-    Serial.println("Not connected to Wi-Fi for MotoGP data");
   }
+  strlcpy(out, race->date, size);
 }
 
-void create_motogp_screen() {
-  // Create a new screen for MotoGP data
-  lv_obj_t * motogp_screen = lv_obj_create(NULL);
-  lv_obj_set_style_bg_color(motogp_screen, lv_color_white(), 0);
-  
-  // Create a container for better layout
-  lv_obj_t * cont = lv_obj_create(motogp_screen);
-  lv_obj_set_size(cont, 320, 240); // Set to full screen size (rotated)
-  lv_obj_set_pos(cont, 0, 0); // Position at absolute 0,0
-  lv_obj_set_style_bg_color(cont, lv_color_white(), 0);
-  lv_obj_set_style_border_width(cont, 0, 0);
-  lv_obj_set_style_pad_all(cont, 0, 0);
-  
-  // Add title bar
-  create_title_bar(cont, "MotoGP - Upcoming");
-  
-  // Parse JSON data
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, motogp_data);
-  
-  if (!error) {
-    // Race name - largest text
-    lv_obj_t * name_label = lv_label_create(cont);
-    lv_label_set_text(name_label, doc["name"].as<const char*>());
-    lv_obj_set_style_text_font(name_label, &lv_font_montserrat_22, 0); 
-    lv_obj_set_style_text_color(name_label, lv_color_hex(0xE31837), 0);
-    lv_obj_align(name_label, LV_ALIGN_TOP_MID, 0, 50);
-    
-    // Location and Circuit - medium text
-    lv_obj_t * location_label = lv_label_create(cont);
-    String location_text = String(doc["location"].as<const char*>()) + ", " + String(doc["country"].as<const char*>());
-    lv_label_set_text(location_label, location_text.c_str());
-    lv_obj_set_style_text_font(location_label, &lv_font_montserrat_16, 0); 
-    lv_obj_align(location_label, LV_ALIGN_TOP_MID, 0, 80);
-    
-    lv_obj_t * circuit_label = lv_label_create(cont);
-    lv_label_set_text(circuit_label, doc["circuit"].as<const char*>());
-    lv_obj_set_style_text_font(circuit_label, &lv_font_montserrat_14, 0); 
-    lv_obj_align(circuit_label, LV_ALIGN_TOP_MID, 0, 100);
-    
-    // Date - medium text
-    lv_obj_t * date_label = lv_label_create(cont);
-    lv_label_set_text(date_label, doc["date"].as<const char*>());
-    lv_obj_set_style_text_font(date_label, &lv_font_montserrat_14, 0); 
-    lv_obj_set_style_text_color(date_label, lv_color_hex(0xE31837), 0);
-    lv_obj_align(date_label, LV_ALIGN_TOP_MID, 0, 120);
-    
-    // Sessions - smaller text in a single column
-    JsonObject sessions = doc["sessions"];
-    int y_offset = 150; // Starting y position
-    int row_spacing = 20; // Spacing between rows
-    
-    // Create session labels in a single column
-    lv_obj_t * q1_label = lv_label_create(cont);
-    lv_label_set_text(q1_label, ("Q1: " + String(sessions["q1"].as<const char*>())).c_str());
-    lv_obj_set_style_text_font(q1_label, &lv_font_montserrat_14, 0);
-    lv_obj_align(q1_label, LV_ALIGN_TOP_MID, 0, y_offset);
-    
-    lv_obj_t * q2_label = lv_label_create(cont);
-    lv_label_set_text(q2_label, ("Q2: " + String(sessions["q2"].as<const char*>())).c_str());
-    lv_obj_set_style_text_font(q2_label, &lv_font_montserrat_14, 0);
-    lv_obj_align(q2_label, LV_ALIGN_TOP_MID, 0, y_offset + row_spacing);
-    
-    lv_obj_t * sprint_label = lv_label_create(cont);
-    lv_label_set_text(sprint_label, ("Sprint: " + String(sessions["sprint"].as<const char*>())).c_str());
-    lv_obj_set_style_text_font(sprint_label, &lv_font_montserrat_14, 0);
-    lv_obj_align(sprint_label, LV_ALIGN_TOP_MID, 0, y_offset + (row_spacing * 2));
-    
-    lv_obj_t * race_label = lv_label_create(cont);
-    lv_label_set_text(race_label, ("Race: " + String(sessions["race"].as<const char*>())).c_str());
-    lv_obj_set_style_text_font(race_label, &lv_font_montserrat_14, 0);
-    lv_obj_align(race_label, LV_ALIGN_TOP_MID, 0, y_offset + (row_spacing * 3));
-  } else {
-    // Error message if JSON parsing fails
-    lv_obj_t * error_label = lv_label_create(cont);
-    lv_label_set_text(error_label, "Error loading MotoGP data");
-    lv_obj_set_style_text_font(error_label, &lv_font_montserrat_20, 0);
-    lv_obj_align(error_label, LV_ALIGN_CENTER, 0, 0);
+// Next race screen, shared by the MotoGP and Formula 1 feeds
+template <typename F>
+lv_obj_t * create_race_screen() {
+  lv_obj_t * cont = create_screen_container((String(feed_label<F>()) + " - Upcoming").c_str());
+
+  const RaceData * race = feed_data<F>();
+  if (!race) {
+    create_error_label(cont, feed_label<F>());
+    return lv_obj_get_screen(cont);
   }
-  
-  // Load the screen
-  lv_screen_load(motogp_screen);
+
+  // Race name - largest text
+  lv_obj_t * name_label = lv_label_create(cont);
+  lv_label_set_text(name_label, race->name);
+  lv_obj_set_style_text_font(name_label, FONT_22, 0);
+  lv_obj_set_style_text_color(name_label, lv_color_hex(0xE31837), 0);
+  lv_obj_align(name_label, LV_ALIGN_TOP_MID, 0, 50);
+
+  // Location and Circuit - medium text
+  lv_obj_t * location_label = lv_label_create(cont);
+  lv_label_set_text(location_label, race->place);
+  lv_obj_set_style_text_font(location_label, FONT_16, 0);
+  lv_obj_align(location_label, LV_ALIGN_TOP_MID, 0, 80);
+
+  lv_obj_t * circuit_label = lv_label_create(cont);
+  lv_label_set_text(circuit_label, race->circuit);
+  lv_obj_set_style_text_font(circuit_label, FONT_14, 0);
+  lv_obj_align(circuit_label, LV_ALIGN_TOP_MID, 0, 100);
+
+  // Date - medium text
+  lv_obj_t * date_label = create_live_label(cont, race_date_text, race);
+  lv_obj_set_style_text_font(date_label, FONT_14, 0);
+  lv_obj_set_style_text_color(date_label, lv_color_hex(0xE31837), 0);
+  lv_obj_align(date_label, LV_ALIGN_TOP_MID, 0, 120);
+
+  // Sessions - smaller text in a single column
+  int y_offset = 150; // Starting y position
+  int row_spacing = 20; // Spacing between rows
+
+  for (int i = 0; i < race->session_count; i++) {
+    lv_obj_t * session_label = lv_label_create(cont);
+    lv_label_set_text(session_label, race->sessions[i]);
+    lv_obj_set_style_text_font(session_label, FONT_14, 0);
+    lv_obj_align(session_label, LV_ALIGN_TOP_MID, 0, y_offset + (row_spacing * i));
+  }
+
+  return lv_obj_get_screen(cont);
 }
 
-void get_crypto_data(String symbol, String &data) {
-  if (WiFi.status() == WL_CONNECTED) {
-    HTTPClient http;
-    String url = String(BASE_URL) + "/api/crypto?symbol=" + symbol;
-    Serial.println("Fetching " + symbol + " data from: " + url);
-    http.begin(url);
-    int httpCode = http.GET();
-
-    if (httpCode > 0) {
-      if (httpCode == HTTP_CODE_OK) {
-        data = http.getString();
-        Serial.println(symbol + " API Response:");
-        Serial.println(data);
-      } else {
-        Serial.println(symbol + " API request failed with HTTP code: " + String(httpCode));
-      }
-    } else {
-      Serial.printf("%s API GET request failed, error: %s\n", symbol.c_str(), http.errorToString(httpCode).c_str());
-    }
-    http.end();
+#if FEED_CRYPTO
+void create_small_crypto_display(lv_obj_t * parent, int index, int y_offset) {
+  const QuoteData * quote = feed_data<CryptoFeed>(index);
+  if (!quote) {
+    return;
   }
+
+  // Symbol
+  lv_obj_t * symbol_label = lv_label_create(parent);
+  lv_label_set_text_fmt(symbol_label, "%s %s", feed_label<CryptoFeed>(index), quote->price);
+  lv_obj_set_style_text_font(symbol_label, FONT_16, 0);
+  lv_obj_set_style_text_color(symbol_label, lv_color_black(), 0); // Change to black
+  lv_obj_align(symbol_label, LV_ALIGN_TOP_MID, 0, y_offset); // Offset to left for alignment with price
+
+  // Recent prices, right of the row
+  lv_obj_t * sparkline = sparkline_create(parent, feed_history<CryptoFeed>(index), 48, 14, lv_color_hex(0x2196F3));
+  lv_obj_align(sparkline, LV_ALIGN_TOP_RIGHT, -10, y_offset + 3);
 }
 
-void get_all_crypto_data() {
-  get_crypto_data("BTCUSD", btc_data);
-  get_crypto_data("ETHUSD", eth_data);
-  get_crypto_data("DOGEUSD", doge_data);
-  get_crypto_data("XRPUSD", xrp_data);
-  get_crypto_data("BNBUSD", bnb_data);
-  last_crypto_timestamp = millis();
+lv_obj_t * create_bitcoin_screen() {
+  lv_obj_t * cont = create_screen_container("Crypto Prices");
+
+  const QuoteData * btc = feed_data<CryptoFeed>(0);
+  if (!btc) {
+    create_error_label(cont, "crypto");
+    return lv_obj_get_screen(cont);
+  }
+
+  // BTC Symbol in large text
+  lv_obj_t * symbol_label = lv_label_create(cont);
+  lv_label_set_text(symbol_label, feed_label<CryptoFeed>(0));
+  lv_obj_set_style_text_font(symbol_label, FONT_26, 0);
+  lv_obj_set_style_text_color(symbol_label, lv_color_hex(0xE31837), 0);
+  lv_obj_align(symbol_label, LV_ALIGN_TOP_MID, 0, 60);
+
+  // BTC Price in large text
+  lv_obj_t * price_label = lv_label_create(cont);
+  lv_label_set_text(price_label, btc->headline);
+  lv_obj_set_style_text_font(price_label, FONT_26, 0);
+  lv_obj_align(price_label, LV_ALIGN_TOP_MID, 0, 100);
+
+  // BTC recent prices, right of the price
+  lv_obj_t * sparkline = sparkline_create(cont, feed_history<CryptoFeed>(0), 80, 56, lv_color_hex(0x2196F3));
+  lv_obj_align(sparkline, LV_ALIGN_TOP_RIGHT, -10, 64);
+
+  // Add other cryptos vertically
+  int start_y = 140; // Start position for additional coins
+  int spacing = 20; // Space between each coin row
+
+  for (int i = 1; i < CryptoFeed::COUNT; i++) {
+    create_small_crypto_display(cont, i, start_y + (spacing * (i - 1)));
+  }
+
+  return lv_obj_get_screen(cont);
 }
+#endif
 
-void create_small_crypto_display(lv_obj_t * parent, String data, String expected_symbol, int y_offset) {
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, data);
-  
-  if (!error) {
-    // Use the expected symbol instead of parsing from response
-    String symbol = expected_symbol;
-    String price_str = "$" + String(doc["price"].as<const char*>());
-    String symbol_with_price = symbol + " " + price_str;
-    
-    // Symbol
-    lv_obj_t * symbol_label = lv_label_create(parent);
-    lv_label_set_text(symbol_label, symbol_with_price.c_str());
-    lv_obj_set_style_text_font(symbol_label, &lv_font_montserrat_16, 0);
-    lv_obj_set_style_text_color(symbol_label, lv_color_black(), 0); // Change to black
-    lv_obj_align(symbol_label, LV_ALIGN_TOP_MID, 0, y_offset); // Offset to left for alignment with price
-  } else {
-    Serial.println("Failed to parse JSON for " + expected_symbol + ": " + error.c_str());
+#if FEED_NEWS
+// One page of headlines at a time, turning every SCREEN_SWITCH_INTERVAL. Each
+// visit carries on through the list from where the last one stopped.
+lv_obj_t * create_news_screen() {
+  lv_obj_t * cont = create_screen_container("News");
+
+  if (!feed_data<NewsFeed>()) {
+    create_error_label(cont, "News");
+    return lv_obj_get_screen(cont);
   }
+
+  // The title bar is the container's first child and its label the bar's
+  lv_obj_t * title = lv_obj_get_child(lv_obj_get_child(cont, 0), 0);
+  news_view_create(cont, title, SCREEN_SWITCH_INTERVAL, NEWS_SCREEN_PAGES);
+  return lv_obj_get_screen(cont);
 }
+#endif
 
-void create_bitcoin_screen() {
-  // Create a new screen for crypto data
-  lv_obj_t * crypto_screen = lv_obj_create(NULL);
-  lv_obj_set_style_bg_color(crypto_screen, lv_color_white(), 0);
-  
-  // Create a container for better layout
-  lv_obj_t * cont = lv_obj_create(crypto_screen);
-  lv_obj_set_size(cont, 320, 240);
-  lv_obj_set_pos(cont, 0, 0);
-  lv_obj_set_style_bg_color(cont, lv_color_white(), 0);
-  lv_obj_set_style_border_width(cont, 0, 0);
-  lv_obj_set_style_pad_all(cont, 0, 0);
-  
-  // Add title bar
-  create_title_bar(cont, "Crypto Prices");
-  
-  // Parse BTC data
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, btc_data);
-  
-  if (!error) {
-    // BTC Symbol in large text
-    lv_obj_t * symbol_label = lv_label_create(cont);
-    lv_label_set_text(symbol_label, "BTC");
-    lv_obj_set_style_text_font(symbol_label, &lv_font_montserrat_26, 0);
-    lv_obj_set_style_text_color(symbol_label, lv_color_hex(0xE31837), 0);
-    lv_obj_align(symbol_label, LV_ALIGN_TOP_MID, 0, 60);
-    
-    // BTC Price in large text
-    lv_obj_t * price_label = lv_label_create(cont);
-    String price_str = "$" + String(doc["price"].as<const char*>());
-    price_str = price_str.substring(0, price_str.length() - 9);
-    lv_label_set_text(price_label, price_str.c_str());
-    lv_obj_set_style_text_font(price_label, &lv_font_montserrat_26, 0);
-    lv_obj_align(price_label, LV_ALIGN_TOP_MID, 0, 100);
-    
-    // Add other cryptos vertically
-    int start_y = 140; // Start position for additional coins
-    int spacing = 20; // Space between each coin row
-    
-    create_small_crypto_display(cont, eth_data, "ETH", start_y);
-    create_small_crypto_display(cont, xrp_data, "XRP", start_y + spacing);
-    create_small_crypto_display(cont, doge_data, "DOGE", start_y + (spacing * 2));
-    create_small_crypto_display(cont, bnb_data, "BNB", start_y + (spacing * 3));
-  } else {
-    Serial.println("Failed to parse BTC data: " + String(error.c_str()));
-    // Error message if JSON parsing fails
-    lv_obj_t * error_label = lv_label_create(cont);
-    lv_label_set_text(error_label, "Error loading crypto data");
-    lv_obj_set_style_text_font(error_label, &lv_font_montserrat_20, 0);
-    lv_obj_align(error_label, LV_ALIGN_CENTER, 0, 0);
+#if FEED_FINANCE
+void create_small_finance_display(lv_obj_t * parent, int index, int y_offset) {
+  const StockData * stock = feed_data<FinanceFeed>(index);
+  if (!stock) {
+    return;
   }
-  
-  // Load the screen
-  lv_screen_load(crypto_screen);
+
+  // Create a container for this row
+  lv_obj_t * row_cont = lv_obj_create(parent);
+  lv_obj_set_size(row_cont, 280, 20);
+  lv_obj_set_style_bg_color(row_cont, lv_color_white(), 0);
+  lv_obj_set_style_border_width(row_cont, 0, 0);
+  lv_obj_set_style_pad_all(row_cont, 0, 0);
+  lv_obj_align(row_cont, LV_ALIGN_TOP_MID, 0, y_offset);
+
+  // Symbol
+  lv_obj_t * symbol_label = lv_label_create(row_cont);
+  lv_label_set_text(symbol_label, feed_label<FinanceFeed>(index));
+  lv_obj_set_style_text_font(symbol_label, FONT_14, 0);
+  lv_obj_set_style_text_color(symbol_label, lv_color_hex(0xE31837), 0);
+  lv_obj_align(symbol_label, LV_ALIGN_LEFT_MID, 0, 0);
+
+  // Price range
+  lv_obj_t * price_label = lv_label_create(row_cont);
+  lv_label_set_text(price_label, stock->range);
+  lv_obj_set_style_text_font(price_label, FONT_14, 0);
+  lv_obj_set_style_text_color(price_label, lv_color_black(), 0);
+  lv_obj_align(price_label, LV_ALIGN_LEFT_MID, 50, 0);
+
+  // Change percentage
+  lv_obj_t * change_label = lv_label_create(row_cont);
+  lv_label_set_text(change_label, stock->change);
+  lv_obj_set_style_text_font(change_label, FONT_14, 0);
+  lv_obj_set_style_text_color(change_label, lv_color_hex(stock->change_color), 0);
+  lv_obj_align(change_label, LV_ALIGN_RIGHT_MID, 0, 0);
 }
 
-void get_news_data() {
-  if (WiFi.status() == WL_CONNECTED) {
-    HTTPClient http;
-    String url = String(BASE_URL) + "/api/news?location=au&max=10";
-    Serial.println("Fetching News data from: " + url);
-    http.begin(url);
-    int httpCode = http.GET();
-
-    if (httpCode > 0) {
-      if (httpCode == HTTP_CODE_OK) {
-        news_data = http.getString();
-        Serial.println("News API Response:");
-        Serial.println(news_data);
-        last_news_timestamp = millis();
-      } else {
-        Serial.println("News API request failed with HTTP code: " + String(httpCode));
-      }
-    } else {
-      Serial.printf("News API GET request failed, error: %s\n", http.errorToString(httpCode).c_str());
-    }
-    http.end();
-  } else {
-    Serial.println("Not connected to Wi-Fi for News data");
+lv_obj_t * create_finance_screen() {
+  lv_obj_t * cont = create_screen_container("Stocks");
+
+  const StockData * index_data = feed_data<FinanceFeed>(0);
+  if (!index_data) {
+    create_error_label(cont, "finance");
+    return lv_obj_get_screen(cont);
   }
+
+  // Create main container for the headline index
+  lv_obj_t * index_cont = lv_obj_create(cont);
+  lv_obj_set_size(index_cont, 280, 80);
+  lv_obj_set_style_bg_color(index_cont, lv_color_white(), 0);
+  lv_obj_set_style_border_width(index_cont, 0, 0);
+  lv_obj_set_style_pad_all(index_cont, 0, 0);
+  lv_obj_align(index_cont, LV_ALIGN_TOP_MID, 0, 50);
+
+  // Index symbol
+  lv_obj_t * symbol_label = lv_label_create(index_cont);
+  lv_label_set_text(symbol_label, feed_label<FinanceFeed>(0));
+  lv_obj_set_style_text_font(symbol_label, FONT_22, 0);
+  lv_obj_set_style_text_color(symbol_label, lv_color_hex(0xE31837), 0);
+  lv_obj_align(symbol_label, LV_ALIGN_TOP_MID, 0, 0);
+
+  // Price range
+  lv_obj_t * price_label = lv_label_create(index_cont);
+  lv_label_set_text(price_label, index_data->range);
+  lv_obj_set_style_text_font(price_label, FONT_22, 0);
+  lv_obj_align(price_label, LV_ALIGN_TOP_MID, 0, 30);
+
+  // Change percentage
+  lv_obj_t * change_label = lv_label_create(index_cont);
+  lv_label_set_text(change_label, index_data->change);
+  lv_obj_set_style_text_font(change_label, FONT_22, 0);
+  lv_obj_set_style_text_color(change_label, lv_color_hex(index_data->change_color), 0);
+  lv_obj_align(change_label, LV_ALIGN_TOP_MID, 0, 60);
+
+  // Index recent prices, right of the change
+  lv_obj_t * sparkline = sparkline_create(index_cont, feed_history<FinanceFeed>(0), 70, 20, lv_color_hex(index_data->change_color));
+  lv_obj_align(sparkline, LV_ALIGN_TOP_RIGHT, 0, 60);
+
+  // Add other stocks vertically
+  int start_y = 140;
+  int spacing = 25;
+
+  for (int i = 1; i < FinanceFeed::COUNT; i++) {
+    create_small_finance_display(cont, i, start_y + (spacing * (i - 1)));
+  }
+
+  return lv_obj_get_screen(cont);
 }
+#endif
 
-void create_news_screen(int page) {
-  // Create a new screen for News data
-  lv_obj_t * news_screen = lv_obj_create(NULL);
-  lv_obj_set_style_bg_color(news_screen, lv_color_white(), 0);
-  
-  // Create a container for better layout
-  lv_obj_t * cont = lv_obj_create(news_screen);
-  lv_obj_set_size(cont, 320, 240); // Set to full screen size (rotated)
-  lv_obj_set_pos(cont, 0, 0); // Position at absolute 0,0
-  lv_obj_set_style_bg_color(cont, lv_color_white(), 0);
-  lv_obj_set_style_border_width(cont, 0, 0);
-  lv_obj_set_style_pad_all(cont, 0, 0);
-  
-  // Add title bar
-  create_title_bar(cont, page == 1 ? "News (1/2)" : "News (2/2)");
-  
-  // Parse JSON data
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, news_data);
-  
-  if (!error) {
-    // Create a container for the news titles
-    lv_obj_t * list_cont = lv_obj_create(cont);
-    lv_obj_set_size(list_cont, 300, 180); // Leave space for title bar
-    lv_obj_align(list_cont, LV_ALIGN_TOP_MID, 0, 50); // Position below title bar
-    lv_obj_set_style_bg_color(list_cont, lv_color_white(), 0);
-    lv_obj_set_style_border_width(list_cont, 0, 0);
-    lv_obj_set_style_pad_all(list_cont, 0, 0);
-    
-    // Get the articles array
-    JsonArray articles = doc["articles"];
-    int y_offset = 0;
-    int row_spacing = 35; // Space between articles
-    const int MAX_CHARS = 80; // Maximum characters for 2 lines
-    
-    // Calculate start and end indices for this page
-    int start_index = (page == 1) ? 0 : 5;
-    int end_index = (page == 1) ? 5 : 10;
-    
-    // Display 5 titles for this page
-    for (int i = start_index; i < end_index && i < articles.size(); i++) {
-      String article_title = articles[i]["title"].as<const char*>();
-      String prefix = String(i + 1) + ". ";
-      String title = prefix + article_title;
-      
-      // Truncate title if longer than MAX_CHARS
-      if (title.length() > MAX_CHARS) {
-        title = title.substring(0, MAX_CHARS - 3) + "...";
-      }
-      
-      lv_obj_t * title_label = lv_label_create(list_cont);
-      lv_obj_set_style_text_font(title_label, &lv_font_montserrat_12, 0); // Reduced font size
-      lv_obj_set_width(title_label, 280); // Width for wrapping
-      lv_label_set_long_mode(title_label, LV_LABEL_LONG_WRAP);
-      lv_label_set_text(title_label, title.c_str());
-      lv_obj_align(title_label, LV_ALIGN_TOP_LEFT, 10, y_offset);
-      
-      y_offset += row_spacing;
-    }
-  } else {
-    // Error message if JSON parsing fails
-    lv_obj_t * error_label = lv_label_create(cont);
-    lv_label_set_text(error_label, "Error loading News data");
-    lv_obj_set_style_text_font(error_label, &lv_font_montserrat_20, 0);
-    lv_obj_align(error_label, LV_ALIGN_CENTER, 0, 0);
+// Screen registry, in rotation order. A screen whose feed is compiled out is
+// left out of the rotation along with its renderer.
+struct screen_entry {
+  const char * name;
+  lv_obj_t * (*build)();
+  unsigned long interval; // how long it stays up
+};
+
+const screen_entry SCREENS[] = {
+#if FEED_MOTOGP
+  {"motogp", create_race_screen<MotoGPFeed>, SCREEN_SWITCH_INTERVAL},
+#endif
+#if FEED_F1
+  {"f1", create_race_screen<F1Feed>, SCREEN_SWITCH_INTERVAL},
+#endif
+#if FEED_FINANCE
+  {"finance", create_finance_screen, SCREEN_SWITCH_INTERVAL},
+#endif
+#if FEED_CRYPTO
+  {"crypto", create_bitcoin_screen, SCREEN_SWITCH_INTERVAL},
+#endif
+#if FEED_NEWS
+  {"news", create_news_screen, NEWS_SCREEN_PAGES * SCREEN_SWITCH_INTERVAL},
+#endif
+#if SCREEN_ABOUT
+  {"about", create_about_screen, SCREEN_SWITCH_INTERVAL},
+#endif
+#if FEED_WEATHER
+  {"weather", lv_create_main_gui, SCREEN_SWITCH_INTERVAL},
+#endif
+};
+const int SCREEN_COUNT = sizeof(SCREENS) / sizeof(SCREENS[0]);
+
+// Drop the prepared screen, e.g. because its data was refreshed after it was built
+void discard_prerendered_screen() {
+  if (prerendered_screen) {
+    lv_obj_delete(prerendered_screen);
+    prerendered_screen = NULL;
   }
-  
-  // Load the screen
-  lv_screen_load(news_screen);
 }
 
-void get_f1_data() {
-  if (WiFi.status() == WL_CONNECTED) {
-    HTTPClient http;
-    String url = String(BASE_URL) + "/api/formula1nextrace?timezone=ACDT";
-    Serial.println("Fetching Formula 1 data from: " + url);
-    http.begin(url);
-    int httpCode = http.GET();
-
-    if (httpCode > 0) {
-      if (httpCode == HTTP_CODE_OK) {
-        f1_data = http.getString();
-        Serial.println("Formula 1 API Response:");
-        Serial.println(f1_data);
-        last_f1_timestamp = millis();
-      } else {
-        Serial.println("Formula 1 API request failed with HTTP code: " + String(httpCode));
-      }
-    } else {
-      Serial.printf("Formula 1 API GET request failed, error: %s\n", http.errorToString(httpCode).c_str());
-    }
-    http.end();
-  } else {
-    Serial.println("Not connected to Wi-Fi for Formula 1 data");
+// Build and lay out the upcoming screen while the loop is otherwise idle,
+// so switch_screen() only has to load it.
+void prerender_next_screen() {
+#if PRERENDER_SCREENS
+  if (prerendered_screen || millis() - last_screen_switch < PRERENDER_DELAY) {
+    return;
   }
+
+  loop_watch_stage(LOOP_STAGE_PRERENDER, SCREENS[current_screen].name);
+  unsigned long start = micros();
+  prerendered_screen = SCREENS[current_screen].build();
+  lv_obj_update_layout(prerendered_screen);
+  Serial.printf("[SWITCH] Pre-rendered %s screen in %lu us\n", SCREENS[current_screen].name, micros() - start);
+#endif
 }
 
-void create_f1_screen() {
-  // Create a new screen for Formula 1 data
-  lv_obj_t * f1_screen = lv_obj_create(NULL);
-  lv_obj_set_style_bg_color(f1_screen, lv_color_white(), 0);
-  
-  // Create a container for better layout
-  lv_obj_t * cont = lv_obj_create(f1_screen);
-  lv_obj_set_size(cont, 320, 240); // Set to full screen size (rotated)
-  lv_obj_set_pos(cont, 0, 0); // Position at absolute 0,0
-  lv_obj_set_style_bg_color(cont, lv_color_white(), 0);
-  lv_obj_set_style_border_width(cont, 0, 0);
-  lv_obj_set_style_pad_all(cont, 0, 0);
-  
-  // Add title bar
-  create_title_bar(cont, "Formula 1 - Upcoming");
-  
-  // Parse JSON data
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, f1_data);
-  
-  if (!error) {
-    // Race name - largest text
-    lv_obj_t * name_label = lv_label_create(cont);
-    lv_label_set_text(name_label, doc["name"].as<const char*>());
-    lv_obj_set_style_text_font(name_label, &lv_font_montserrat_22, 0); 
-    lv_obj_set_style_text_color(name_label, lv_color_hex(0xE31837), 0);
-    lv_obj_align(name_label, LV_ALIGN_TOP_MID, 0, 50);
-    
-    // Location and Circuit - medium text
-    lv_obj_t * location_label = lv_label_create(cont);
-    String location_text = String(doc["location"].as<const char*>()) + ", " + String(doc["country"].as<const char*>());
-    lv_label_set_text(location_label, location_text.c_str());
-    lv_obj_set_style_text_font(location_label, &lv_font_montserrat_16, 0); 
-    lv_obj_align(location_label, LV_ALIGN_TOP_MID, 0, 80);
-    
-    lv_obj_t * circuit_label = lv_label_create(cont);
-    lv_label_set_text(circuit_label, doc["circuit"].as<const char*>());
-    lv_obj_set_style_text_font(circuit_label, &lv_font_montserrat_14, 0); 
-    lv_obj_align(circuit_label, LV_ALIGN_TOP_MID, 0, 100);
-    
-    // Date - medium text
-    lv_obj_t * date_label = lv_label_create(cont);
-    lv_label_set_text(date_label, doc["date"].as<const char*>());
-    lv_obj_set_style_text_font(date_label, &lv_font_montserrat_14, 0); 
-    lv_obj_set_style_text_color(date_label, lv_color_hex(0xE31837), 0);
-    lv_obj_align(date_label, LV_ALIGN_TOP_MID, 0, 120);
-    
-    // Sessions - smaller text in a single column
-    JsonObject sessions = doc["sessions"];
-    int y_offset = 150; // Starting y position
-    int row_spacing = 20; // Spacing between rows
-    
-    // Create session labels in a single column
-    lv_obj_t * q1_label = lv_label_create(cont);
-    lv_label_set_text(q1_label, ("Q1: " + String(sessions["q1"].as<const char*>())).c_str());
-    lv_obj_set_style_text_font(q1_label, &lv_font_montserrat_14, 0);
-    lv_obj_align(q1_label, LV_ALIGN_TOP_MID, 0, y_offset);
-    
-    lv_obj_t * q2_label = lv_label_create(cont);
-    lv_label_set_text(q2_label, ("Q2: " + String(sessions["q2"].as<const char*>())).c_str());
-    lv_obj_set_style_text_font(q2_label, &lv_font_montserrat_14, 0);
-    lv_obj_align(q2_label, LV_ALIGN_TOP_MID, 0, y_offset + row_spacing);
-    
-    lv_obj_t * sprint_label = lv_label_create(cont);
-    lv_label_set_text(sprint_label, ("Sprint: " + String(sessions["sprint"].as<const char*>())).c_str());
-    lv_obj_set_style_text_font(sprint_label, &lv_font_montserrat_14, 0);
-    lv_obj_align(sprint_label, LV_ALIGN_TOP_MID, 0, y_offset + (row_spacing * 2));
-    
-    lv_obj_t * race_label = lv_label_create(cont);
-    lv_label_set_text(race_label, ("Race: " + String(sessions["race"].as<const char*>())).c_str());
-    lv_obj_set_style_text_font(race_label, &lv_font_montserrat_14, 0);
-    lv_obj_align(race_label, LV_ALIGN_TOP_MID, 0, y_offset + (row_spacing * 3));
-  } else {
-    // Error message if JSON parsing fails
-    lv_obj_t * error_label = lv_label_create(cont);
-    lv_label_set_text(error_label, "Error loading Formula 1 data");
-    lv_obj_set_style_text_font(error_label, &lv_font_montserrat_20, 0);
-    lv_obj_align(error_label, LV_ALIGN_CENTER, 0, 0);
+// Load SCREENS[index], pre-rendered if it was the one prepared, and move the
+// rotation on to the screen after it
+void show_screen(int index) {
+  loop_watch_stage(LOOP_STAGE_SWITCH, SCREENS[index].name);
+  unsigned long start = micros();
+  bool prerendered = prerendered_screen != NULL && index == current_screen;
+  if (!prerendered) {
+    discard_prerendered_screen();
   }
-  
-  // Load the screen
-  lv_screen_load(f1_screen);
+
+  lv_obj_t * next = prerendered ? prerendered_screen : SCREENS[index].build();
+  prerendered_screen = NULL;
+
+  // The previous screen is deleted by LVGL once the transition is done
+  lv_screen_load_anim(next, SCREEN_TRANSITION, SCREEN_TRANSITION_TIME, 0, true);
+  lv_refr_now(NULL);
+
+  unsigned long elapsed = micros() - start;
+  switch_stats & stats = prerendered ? switch_stats_warm : switch_stats_cold;
+  stats.count++;
+  stats.total_us += elapsed;
+  if (elapsed > stats.max_us) {
+    stats.max_us = elapsed;
+  }
+  Serial.printf("[SWITCH] %s screen in %lu us (%s) | avg cold %lu us, avg pre-rendered %lu us\n",
+                SCREENS[index].name, elapsed, prerendered ? "pre-rendered" : "cold",
+                switch_stats_cold.count ? switch_stats_cold.total_us / switch_stats_cold.count : 0,
+                switch_stats_warm.count ? switch_stats_warm.total_us / switch_stats_warm.count : 0);
+
+  screen_interval = SCREENS[index].interval;
+  current_screen = (index + 1) % SCREEN_COUNT;
+  last_screen_switch = millis();
 }
 
-void get_finance_data(String symbol, String &data) {
-  if (WiFi.status() == WL_CONNECTED) {
-    HTTPClient http;
-    String url = String(BASE_URL) + "/api/finance?symbol=" + symbol;
-    Serial.println("Fetching finance data from: " + url);
-    http.begin(url);
-    int httpCode = http.GET();
-
-    if (httpCode > 0) {
-      if (httpCode == HTTP_CODE_OK) {
-        data = http.getString();
-        Serial.println(symbol + " Finance API Response:");
-        Serial.println(data);
-      }
-    }
-    http.end();
+void switch_screen() {
+  if (millis() - last_screen_switch > screen_interval) {
+    show_screen(current_screen);
   }
 }
 
-void get_all_finance_data() {
-  get_finance_data("^GSPC", sp500_data);
-  get_finance_data("NDQ.AX", ndq_data);
-  get_finance_data("VAS.AX", vas_data);
-  get_finance_data("VGS.AX", vgs_data);
-  last_finance_timestamp = millis();
+#if RENDER_BITMAP_SCREENS
+// Screens come drawn from the backend, the rotation only has to show them
+void show_bitmap_screen(int index) {
+  loop_watch_stage(LOOP_STAGE_SWITCH, "bitmap");
+  bitmap_screen_show(index);
+  screen_interval = SCREEN_SWITCH_INTERVAL;
+  current_screen = (index + 1) % bitmap_screen_count();
+  last_screen_switch = millis();
 }
 
-void create_small_finance_display(lv_obj_t * parent, String data, String display_symbol, int y_offset) {
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, data);
-  
-  if (!error) {
-    float prev_close = doc["previousClose"].as<float>();
-    float current_price = doc["regularMarketPrice"].as<float>();
-    float current_low = doc["regularMarketDayLow"].as<float>();
-    float current_high = doc["regularMarketDayHigh"].as<float>();
-    
-    // Calculate percentage change using current price instead of high
-    float percent_change = 0.0;
-    if (prev_close > 0) {  // Prevent division by zero
-      percent_change = ((current_price - prev_close) / prev_close) * 100.0;
-    }
-    
-    // Format the strings
-    String price_range = "$" + String(current_low, 2) + " - $" + String(current_high, 2);
-    String change_str;
-    lv_color_t change_color;
-    
-    if (abs(percent_change) < 0.1) { // Consider changes less than 0.1% as 0%
-      change_str = "0.0%";
-      change_color = lv_color_black();
-    } else {
-      change_str = (percent_change > 0 ? "/\\ +" : "\\/ ") + String(abs(percent_change), 1) + "%";
-      change_color = percent_change > 0 ? lv_color_hex(0x00AA00) : lv_color_hex(0xE31837);
-    }
-    
-    // Create a container for this row
-    lv_obj_t * row_cont = lv_obj_create(parent);
-    lv_obj_set_size(row_cont, 280, 20);
-    lv_obj_set_style_bg_color(row_cont, lv_color_white(), 0);
-    lv_obj_set_style_border_width(row_cont, 0, 0);
-    lv_obj_set_style_pad_all(row_cont, 0, 0);
-    lv_obj_align(row_cont, LV_ALIGN_TOP_MID, 0, y_offset);
-    
-    // Symbol
-    lv_obj_t * symbol_label = lv_label_create(row_cont);
-    lv_label_set_text(symbol_label, display_symbol.c_str());
-    lv_obj_set_style_text_font(symbol_label, &lv_font_montserrat_14, 0);
-    lv_obj_set_style_text_color(symbol_label, lv_color_hex(0xE31837), 0);
-    lv_obj_align(symbol_label, LV_ALIGN_LEFT_MID, 0, 0);
-    
-    // Price range
-    lv_obj_t * price_label = lv_label_create(row_cont);
-    lv_label_set_text(price_label, price_range.c_str());
-    lv_obj_set_style_text_font(price_label, &lv_font_montserrat_14, 0);
-    lv_obj_set_style_text_color(price_label, lv_color_black(), 0);
-    lv_obj_align(price_label, LV_ALIGN_LEFT_MID, 50, 0);
-    
-    // Change percentage
-    lv_obj_t * change_label = lv_label_create(row_cont);
-    lv_label_set_text(change_label, change_str.c_str());
-    lv_obj_set_style_text_font(change_label, &lv_font_montserrat_14, 0);
-    lv_obj_set_style_text_color(change_label, change_color, 0);
-    lv_obj_align(change_label, LV_ALIGN_RIGHT_MID, 0, 0);
+void switch_bitmap_screen() {
+  if (millis() - last_screen_switch > screen_interval) {
+    show_bitmap_screen(current_screen);
   }
 }
+#endif
 
-void create_finance_screen() {
-  lv_obj_t * finance_screen = lv_obj_create(NULL);
-  lv_obj_set_style_bg_color(finance_screen, lv_color_white(), 0);
-  
-  // Create a container for better layout
-  lv_obj_t * cont = lv_obj_create(finance_screen);
-  lv_obj_set_size(cont, 320, 240);
-  lv_obj_set_pos(cont, 0, 0);
-  lv_obj_set_style_bg_color(cont, lv_color_white(), 0);
-  lv_obj_set_style_border_width(cont, 0, 0);
-  lv_obj_set_style_pad_all(cont, 0, 0);
-  
-  // Add title bar
-  create_title_bar(cont, "Stocks");
-  
-  // Parse S&P 500 data
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, sp500_data);
-  
-  if (!error) {
-    float prev_close = doc["previousClose"].as<float>();
-    float current_price = doc["regularMarketPrice"].as<float>();
-    float current_low = doc["regularMarketDayLow"].as<float>();
-    float current_high = doc["regularMarketDayHigh"].as<float>();
-    
-    // Calculate percentage change using current price
-    float percent_change = 0.0;
-    if (prev_close > 0) {  // Prevent division by zero
-      percent_change = ((current_price - prev_close) / prev_close) * 100.0;
-    }
-    
-    // Create main container for S&P 500
-    lv_obj_t * sp500_cont = lv_obj_create(cont);
-    lv_obj_set_size(sp500_cont, 280, 80);
-    lv_obj_set_style_bg_color(sp500_cont, lv_color_white(), 0);
-    lv_obj_set_style_border_width(sp500_cont, 0, 0);
-    lv_obj_set_style_pad_all(sp500_cont, 0, 0);
-    lv_obj_align(sp500_cont, LV_ALIGN_TOP_MID, 0, 50);
-    
-    // S&P 500 Symbol
-    lv_obj_t * symbol_label = lv_label_create(sp500_cont);
-    lv_label_set_text(symbol_label, "S&P 500");
-    lv_obj_set_style_text_font(symbol_label, &lv_font_montserrat_22, 0);
-    lv_obj_set_style_text_color(symbol_label, lv_color_hex(0xE31837), 0);
-    lv_obj_align(symbol_label, LV_ALIGN_TOP_MID, 0, 0);
-    
-    // Price range
-    String price_range = "$" + String(current_low, 2) + " - $" + String(current_high, 2);
-    lv_obj_t * price_label = lv_label_create(sp500_cont);
-    lv_label_set_text(price_label, price_range.c_str());
-    lv_obj_set_style_text_font(price_label, &lv_font_montserrat_22, 0);
-    lv_obj_align(price_label, LV_ALIGN_TOP_MID, 0, 30);
-    
-    // Change percentage
-    String change_str;
-    lv_color_t change_color;
-    
-    if (abs(percent_change) < 0.1) { // Consider changes less than 0.1% as 0%
-      change_str = "0.0%";
-      change_color = lv_color_black();
-    } else {
-      change_str = (percent_change > 0 ? "/\\ +" : "\\/ ") + String(abs(percent_change), 1) + "%";
-      change_color = percent_change > 0 ? lv_color_hex(0x00AA00) : lv_color_hex(0xE31837);
-    }
-    
-    lv_obj_t * change_label = lv_label_create(sp500_cont);
-    lv_label_set_text(change_label, change_str.c_str());
-    lv_obj_set_style_text_font(change_label, &lv_font_montserrat_22, 0);
-    lv_obj_set_style_text_color(change_label, change_color, 0);
-    lv_obj_align(change_label, LV_ALIGN_TOP_MID, 0, 60);
-    
-    // Add other stocks vertically
-    int start_y = 140;
-    int spacing = 25;
-    
-    create_small_finance_display(cont, ndq_data, "NDQ", start_y);
-    create_small_finance_display(cont, vas_data, "VAS", start_y + spacing);
-    create_small_finance_display(cont, vgs_data, "VGS", start_y + (spacing * 2));
-  } else {
-    lv_obj_t * error_label = lv_label_create(cont);
-    lv_label_set_text(error_label, "Error loading finance data");
-    lv_obj_set_style_text_font(error_label, &lv_font_montserrat_20, 0);
-    lv_obj_align(error_label, LV_ALIGN_CENTER, 0, 0);
+#if TOUCH_ENABLED
+// Touch latency, from the read that recognised a swipe to the new screen
+// being on the panel
+switch_stats switch_stats_touch = {0, 0, 0};
+const unsigned long TOUCH_LATENCY_TARGET = 50000; // microseconds
+
+// Act on a swipe or tap. A swipe shows the next or previous screen, and
+// either way the screen now up stays for TOUCH_PAUSE_INTERVAL before the
+// rotation carries on from it.
+void handle_touch() {
+  unsigned long at;
+  touch_gesture gesture = touch_input_take(&at);
+  if (gesture == TOUCH_NONE) {
+    return;
   }
-  
-  lv_screen_load(finance_screen);
-}
 
-void switch_screen() {
-  if (millis() - last_screen_switch > SCREEN_SWITCH_INTERVAL) {
-    lv_obj_t * current = lv_screen_active();
-    
-    switch (current_screen) {
-      case 0:
-        create_motogp_screen();
-        break;
-      case 1:
-        create_f1_screen();
-        break;
-      case 2:
-        create_finance_screen();
-        break;
-      case 3:
-        create_bitcoin_screen();
-        break;
-      case 4:
-        create_news_screen(1);
-        break;
-      case 5:
-        create_news_screen(2);
-        break;
-      case 6:
-        create_about_screen();
-        break;
-      case 7:
-        lv_create_main_gui();
-        break;
-    }
-    
-    if (current) {
-      lv_obj_del(current);
+  if (gesture != TOUCH_TAP) {
+#if RENDER_BITMAP_SCREENS
+    int count = bitmap_screen_count();
+#else
+    int count = SCREEN_COUNT;
+#endif
+    // current_screen is the one after the screen shown, so the previous
+    // screen is two back
+    int index = gesture == TOUCH_SWIPE_LEFT ? current_screen : (current_screen + 2 * count - 2) % count;
+#if RENDER_BITMAP_SCREENS
+    show_bitmap_screen(index);
+#else
+    show_screen(index);
+#endif
+
+    unsigned long elapsed = micros() - at;
+    switch_stats_touch.count++;
+    switch_stats_touch.total_us += elapsed;
+    if (elapsed > switch_stats_touch.max_us) {
+      switch_stats_touch.max_us = elapsed;
     }
-    
-    current_screen = (current_screen + 1) % 8; // Now we have 8 screens
-    last_screen_switch = millis();
+    Serial.printf("[TOUCH] Swipe %s to screen in %lu us%s | avg %lu us, max %lu us over %lu\n",
+                  gesture == TOUCH_SWIPE_LEFT ? "left" : "right", elapsed,
+                  elapsed > TOUCH_LATENCY_TARGET ? " (over 50 ms target)" : "",
+                  switch_stats_touch.total_us / switch_stats_touch.count, switch_stats_touch.max_us,
+                  switch_stats_touch.count);
+  } else {
+    Serial.println("[TOUCH] Tap, holding the screen");
   }
+
+  screen_interval = TOUCH_PAUSE_INTERVAL;
+  last_screen_switch = millis();
 }
+#endif
 
-// Function to refresh all data if needed
-void check_and_refresh_data() {
-  if (WiFi.status() == WL_CONNECTED) {
-    if (should_refresh_cache(last_weather_timestamp)) {
-      get_weather_data();
-    }
-    if (should_refresh_cache(last_motogp_timestamp)) {
-      get_motogp_data();
-    }
-    if (should_refresh_cache(last_f1_timestamp)) {
-      get_f1_data();
-    }
-    if (should_refresh_cache(last_finance_timestamp)) {
-      get_all_finance_data();
-    }
-    if (should_refresh_cache(last_crypto_timestamp)) {
-      get_all_crypto_data();
-    }
-    if (should_refresh_cache(last_news_timestamp)) {
-      get_news_data();
-    }
-  }
+// Function to refresh all data if needed. Returns true if anything was fetched.
+bool check_and_refresh_data() {
+  return feeds_refresh(false);
 }
 
 void setup() {
   String LVGL_Arduino = String("LVGL Library Version: ") + lv_version_major() + "." + lv_version_minor() + "." + lv_version_patch();
   Serial.begin(115200);
   Serial.println(LVGL_Arduino);
+  loop_watch_begin();
+
+  // Decide where large buffers live before LVGL grabs its pool
+  mem_pools_init();
+  json_arena_init();
 
   // Start LVGL
   lv_init();
+  lv_tick_set_cb(lv_tick_millis);
   // Register print function for debugging
   lv_log_register_print_cb(log_print);
 
   // Create a display object
   lv_display_t * disp;
   // Initialize the TFT display using the TFT_eSPI library
-  disp = lv_tft_espi_create(SCREEN_WIDTH, SCREEN_HEIGHT, draw_buf, sizeof(draw_buf));
+  draw_buf = (uint32_t *)mem_alloc_large(DRAW_BUF_SIZE, "Draw buffer");
+  disp = lv_tft_espi_create(SCREEN_WIDTH, SCREEN_HEIGHT, draw_buf, DRAW_BUF_SIZE);
   lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_270);
+#if TOUCH_ENABLED
+  touch_input_begin();
+#endif
 
   // Create startup screen
   lv_obj_t * startup_screen = lv_obj_create(NULL);
   lv_obj_set_style_bg_color(startup_screen, lv_color_white(), 0);
-  
+
   // Create a container for better layout
   lv_obj_t * cont = lv_obj_create(startup_screen);
   lv_obj_set_size(cont, SCREEN_WIDTH, SCREEN_HEIGHT);
@@ -1001,79 +761,107 @@ void setup() {
   create_title_bar(cont, "Daysync");
 
   // Create status label
-  lv_obj_t * status_label = lv_label_create(cont);
-  lv_label_set_text(status_label, "Connecting to WiFi...");
-  lv_obj_set_style_text_font(status_label, &lv_font_montserrat_20, 0);
-  lv_obj_align(status_label, LV_ALIGN_CENTER, 0, 0);
+  startup_status_label = lv_label_create(cont);
+  lv_label_set_text(startup_status_label, "Connecting to WiFi...");
+  lv_obj_set_style_text_font(startup_status_label, FONT_20, 0);
+  lv_obj_align(startup_status_label, LV_ALIGN_CENTER, 0, 0);
 
   // Load the startup screen immediately
   lv_screen_load(startup_screen);
   lv_task_handler();
-  delay(100); // Give LVGL time to render
-  
-  // Connect to Wi-Fi
-  WiFi.begin(ssid, password);
-  Serial.print("Connecting");
-  
-  // Wait for connection with timeout
-  unsigned long startAttemptTime = millis();
-  bool connected = false;
-  
-  while (millis() - startAttemptTime < 20000) { // 20 second timeout
-    if (WiFi.status() == WL_CONNECTED) {
-      connected = true;
-      break;
+
+  // Connect in the background, loop() starts the screens once it is up
+  wifi_manager_begin(ssid, password);
+}
+
+// Leave the startup screen for the rotation, on the first connection
+void start_screens() {
+  clock_begin();
+
+  lv_label_set_text(startup_status_label, "Connected!");
+  lv_obj_set_style_text_color(startup_status_label, lv_color_hex(0x00AA00), 0);
+  lv_refr_now(NULL);
+
+  // Start with the last screen of the rotation (weather), the first switch
+  // moves on to the start of the rotation
+#if RENDER_BITMAP_SCREENS
+  bitmap_screen_show(bitmap_screen_count() - 1);
+#else
+  // Get initial data
+  feeds_refresh(true);
+
+  lv_screen_load_anim(SCREENS[SCREEN_COUNT - 1].build(), LV_SCR_LOAD_ANIM_NONE, 0, 0, true);
+#endif
+  startup_status_label = NULL;
+  last_screen_switch = millis();
+#if TOUCH_ENABLED
+  // Nothing touched on the startup screen carries over into the rotation
+  unsigned long touched_at;
+  touch_input_take(&touched_at);
+#endif
+
+  mem_report("startup");
+  mem_report_start();
+}
+
+// Fetch everything again as soon as the connection is back. Screens keep
+// showing the data they have while it is down.
+void refresh_after_reconnect() {
+#if RENDER_BITMAP_SCREENS
+  bitmap_screens_expire();
+  bitmap_screen_show((current_screen + bitmap_screen_count() - 1) % bitmap_screen_count());
+#else
+  feeds_refresh(true);
+  discard_prerendered_screen();
+#endif
+}
+
+void loop() {
+  loop_watch_stage(LOOP_STAGE_LVGL, NULL);
+  lv_task_handler();  // let the GUI do its work
+
+  loop_watch_stage(LOOP_STAGE_WIFI, NULL);
+  if (wifi_manager_loop()) {
+    if (startup_status_label) {
+      start_screens();
+    } else {
+      refresh_after_reconnect();
     }
-    delay(500);
-    Serial.print(".");
-    lv_task_handler(); // Keep LVGL responsive
   }
-  
-  if (connected) {
-    Serial.print("\nConnected to Wi-Fi network with IP Address: ");
-    Serial.println(WiFi.localIP());
-    
-    // Update status to show success
-    lv_label_set_text(status_label, "Connected!");
-    lv_obj_set_style_text_color(status_label, lv_color_hex(0x00AA00), 0);
-    lv_task_handler();
-    delay(1000); // Show success message briefly
-    
-    // Get initial data
-    get_weather_data();
-    get_motogp_data();
-    get_f1_data();
-    get_all_finance_data();
-    get_all_crypto_data();
-    get_news_data();
-    
-    // Start with weather screen
-    lv_create_main_gui();
-  } else {
-    Serial.println("\nFailed to connect to WiFi");
-    
-    // Update status to show error
-    lv_label_set_text(status_label, "Unable to connect to WiFi.");
-    lv_obj_set_style_text_color(status_label, lv_color_hex(0xAA0000), 0);
-    lv_task_handler();
-    
-    // Stay on error screen indefinitely
-    while (1) {
-      lv_task_handler();
-      delay(100);
+
+  // Until the first connection there is nothing to show but the startup screen
+  if (startup_status_label) {
+    static unsigned long shown_attempt = 1;
+    if (wifi_manager_attempts() != shown_attempt) {
+      shown_attempt = wifi_manager_attempts();
+      lv_label_set_text_fmt(startup_status_label, "Connecting to WiFi (attempt %lu)...", shown_attempt);
     }
+    loop_watch_end();
+    delay(5);
+    return;
+  }
+
+#if TOUCH_ENABLED
+  // Before any fetch, so a swipe is not kept waiting on the network
+  loop_watch_stage(LOOP_STAGE_TOUCH, NULL);
+  handle_touch();
+#endif
+
+#if RENDER_BITMAP_SCREENS
+  switch_bitmap_screen();
+#else
+  // Check if data needs to be refreshed. A screen built from the old data is thrown away.
+  loop_watch_stage(LOOP_STAGE_REFRESH, NULL);
+  if (check_and_refresh_data()) {
+    discard_prerendered_screen();
+  } else {
+    prerender_next_screen();
   }
-}
 
-void loop() {
-  lv_task_handler();  // let the GUI do its work
-  lv_tick_inc(5);     // tell LVGL how much time has passed
-  
-  // Check if data needs to be refreshed
-  check_and_refresh_data();
-  
   // Check if it's time to switch screens
   switch_screen();
-  
+#endif
+
+  loop_watch_end();
   delay(5);           // let this time pass
 }
@@ -0,0 +1,114 @@
+#include "mem_pools.h"
+#include "json_arena.h"
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <esp_heap_caps.h>
+#if __has_include(<esp_memory_utils.h>)
+#include <esp_memory_utils.h>
+#else
+#include <soc/soc_memory_layout.h>
+#endif
+
+// Where each pool ended up, for the report
+struct mem_region {
+  const char * name;
+  void * addr;
+  size_t size;
+};
+
+static const int MAX_REGIONS = 4;
+static mem_region regions[MAX_REGIONS];
+static int region_count = 0;
+
+static bool has_psram() {
+  return psramFound();
+}
+
+static void * alloc_preferring_psram(size_t size) {
+  void * ptr = NULL;
+  if (has_psram()) {
+    ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  }
+  if (!ptr) {
+    ptr = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  return ptr;
+}
+
+static void track_region(const char * name, void * addr, size_t size) {
+  if (region_count < MAX_REGIONS) {
+    regions[region_count++] = {name, addr, size};
+  }
+}
+
+static const char * region_location(void * addr) {
+  if (!addr) {
+    return "unallocated";
+  }
+  return esp_ptr_external_ram(addr) ? "PSRAM" : "internal";
+}
+
+extern "C" void * mem_lv_pool_alloc(size_t size) {
+  void * pool = alloc_preferring_psram(size);
+  track_region("LVGL pool", pool, size);
+  return pool;
+}
+
+void mem_pools_init() {
+#if CONFIG_SPIRAM_USE_MALLOC
+  if (has_psram()) {
+    // Route large malloc() calls (String bodies from HTTPClient, TLS records)
+    // to PSRAM so they stop fragmenting internal RAM.
+    heap_caps_malloc_extmem_enable(MEM_PSRAM_MALLOC_THRESHOLD);
+  }
+#endif
+  Serial.printf("[MEM] PSRAM %s (%u bytes)\n", has_psram() ? "found" : "not found", (unsigned)ESP.getPsramSize());
+}
+
+void * mem_alloc_large(size_t size, const char * name) {
+  void * ptr = alloc_preferring_psram(size);
+  track_region(name, ptr, size);
+  if (!ptr) {
+    Serial.printf("[MEM] Failed to allocate %u bytes for %s\n", (unsigned)size, name);
+  }
+  return ptr;
+}
+
+void mem_report(const char * tag) {
+  Serial.printf("[MEM] ---- %s ----\n", tag);
+
+  for (int i = 0; i < region_count; i++) {
+    Serial.printf("[MEM] %-12s %7u bytes in %s (%p)\n", regions[i].name, (unsigned)regions[i].size,
+                  region_location(regions[i].addr), regions[i].addr);
+  }
+
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  Serial.printf("[MEM] LVGL pool: used %u%%, peak %u / %u bytes, biggest free %u, frag %u%%\n",
+                mon.used_pct, (unsigned)mon.max_used, (unsigned)mon.total_size,
+                (unsigned)mon.free_biggest_size, mon.frag_pct);
+
+  Serial.printf("[MEM] Internal heap: free %u, min free %u, largest block %u\n",
+                (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+                (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+
+  if (has_psram()) {
+    Serial.printf("[MEM] PSRAM: free %u, min free %u, largest block %u\n",
+                  (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+                  (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM),
+                  (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
+  }
+
+  json_arena_report();
+}
+
+static void mem_report_timer_cb(lv_timer_t * timer) {
+  LV_UNUSED(timer);
+  mem_report("periodic");
+}
+
+void mem_report_start() {
+  lv_timer_create(mem_report_timer_cb, MEM_REPORT_INTERVAL, NULL);
+}
@@ -0,0 +1,193 @@
+#include "news_view.h"
+
+#include <Arduino.h>
+
+#include "feeds.h"
+#include "fonts.h"
+
+#define NEWS_VIEW_FONT FONT_12
+#define NEWS_VIEW_WIDTH 280     // width a headline wraps at
+#define NEWS_VIEW_ROW_HEIGHT 35 // space between headlines
+
+// Room for a numbered headline and the "..." it may end with
+#define NEWS_VIEW_TEXT_SIZE (NEWS_TITLE_SIZE + 8)
+
+struct news_view {
+  lv_obj_t * title;
+  lv_obj_t * rows[NEWS_VIEW_ROWS];
+  char text[NEWS_VIEW_ROWS][NEWS_VIEW_TEXT_SIZE]; // what each row label shows
+  uint32_t page_interval;
+  int turns_left;       // pages still to turn to on this visit
+  lv_timer_t * timer;   // NULL until the screen is loaded
+  int first;            // first headline on the page shown
+  bool shown;
+};
+
+// First headline of the page the next news screen starts on
+static int next_first = 0;
+
+// Decode the UTF-8 character at text[*i] and move *i past it
+static uint32_t next_letter(const char * text, size_t * i) {
+  uint8_t c = text[*i];
+  int extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+  uint32_t letter = extra ? c & (0x3F >> extra) : c;
+  (*i)++;
+  for (; extra > 0 && (text[*i] & 0xC0) == 0x80; extra--) {
+    letter = letter << 6 | (text[(*i)++] & 0x3F);
+  }
+  return letter;
+}
+
+// Copy `text` to `out`, cut to what fits in `lines` lines of `width` pixels
+// when wrapped at spaces, ending with "..." if anything was cut. Glyphs are
+// measured one at a time in a single pass. The label may wrap at more places
+// than spaces (after a comma or hyphen), which only leaves it more room.
+static void fit_text(const lv_font_t * font, const char * text, int32_t width, int lines, char * out, size_t size) {
+  const int32_t dots_width = 3 * lv_font_get_glyph_width(font, '.', '.');
+  int line = 1;
+  int32_t x = 0;           // width of the current line
+  size_t word = 0;         // where the word being measured starts, 0 if at the start of a line
+  int32_t word_width = 0;  // its width so far
+  size_t cut = 0;          // end of the text that fits with "..." on the last line
+  size_t i = 0;
+
+  while (text[i]) {
+    size_t next = i;
+    uint32_t letter = next_letter(text, &next);
+    size_t after = next;
+    uint32_t letter_next = text[next] ? next_letter(text, &after) : 0;
+    int32_t w = lv_font_get_glyph_width(font, letter, letter_next);
+
+    if (x + w > width && x > 0) {
+      if (line == lines) {
+        while (cut > 0 && text[cut - 1] == ' ') {
+          cut--;
+        }
+        size_t n = cut < size - 4 ? cut : size - 4;
+        memcpy(out, text, n);
+        strcpy(out + n, "...");
+        return;
+      }
+      line++;
+      if (letter == ' ') {
+        // A space at the end of a line is dropped
+        x = 0;
+        word = 0;
+        cut = next;
+        i = next;
+        continue;
+      }
+      // The word moves down to the new line, unless it fills a line itself
+      x = word ? word_width : 0;
+      cut = word && x + dots_width > width ? word : i;
+      word = 0;
+      continue;
+    }
+
+    if (letter == ' ') {
+      word = next;
+      word_width = 0;
+    } else {
+      word_width += w;
+    }
+    x += w;
+    if (line == lines && x + dots_width <= width) {
+      cut = next;
+    }
+    i = next;
+  }
+  strlcpy(out, text, size);
+}
+
+// Point the row labels at the page starting with headline `first`, or the
+// first page if the list is shorter than that
+static void show_page(news_view * view, int first) {
+  const NewsData * news = feed_data<NewsFeed>();
+  int count = news ? news->count : 0;
+  if (first >= count) {
+    first = 0;
+  }
+  view->first = first;
+
+  for (int row = 0; row < NEWS_VIEW_ROWS; row++) {
+    int index = first + row;
+    if (index >= count) {
+      lv_obj_add_flag(view->rows[row], LV_OBJ_FLAG_HIDDEN);
+      continue;
+    }
+    char numbered[NEWS_VIEW_TEXT_SIZE];
+    snprintf(numbered, sizeof(numbered), "%d. %s", index + 1, news_title(*news, index));
+    fit_text(NEWS_VIEW_FONT, numbered, NEWS_VIEW_WIDTH, NEWS_VIEW_LINES, view->text[row], NEWS_VIEW_TEXT_SIZE);
+    // The label shows the view's buffer rather than copying it
+    lv_label_set_text_static(view->rows[row], view->text[row]);
+    lv_obj_remove_flag(view->rows[row], LV_OBJ_FLAG_HIDDEN);
+  }
+
+  int pages = (count + NEWS_VIEW_ROWS - 1) / NEWS_VIEW_ROWS;
+  lv_label_set_text_fmt(view->title, "News (%d/%d)", first / NEWS_VIEW_ROWS + 1, pages > 0 ? pages : 1);
+}
+
+static void news_view_next_page(lv_timer_t * timer) {
+  news_view * view = (news_view *)lv_timer_get_user_data(timer);
+  if (view->turns_left > 0) {
+    view->turns_left--;
+    show_page(view, view->first + NEWS_VIEW_ROWS);
+  }
+}
+
+// Pages only turn once the screen is up, not while it is pre-rendered. The
+// timer runs on LVGL's clock, which is millis() (see setup()), the clock the
+// rotation gives the screen pages * page_interval by, so the last page gets
+// its full interval too.
+static void news_view_loaded(lv_event_t * e) {
+  news_view * view = (news_view *)lv_event_get_user_data(e);
+  view->shown = true;
+  if (!view->timer) {
+    view->timer = lv_timer_create(news_view_next_page, view->page_interval, view);
+  }
+}
+
+static void news_view_deleted(lv_event_t * e) {
+  news_view * view = (news_view *)lv_event_get_user_data(e);
+  if (view->timer) {
+    lv_timer_delete(view->timer);
+  }
+  // A screen that was built but never shown leaves the page where it was
+  if (view->shown) {
+    next_first = view->first + NEWS_VIEW_ROWS;
+  }
+  lv_free(view);
+}
+
+lv_obj_t * news_view_create(lv_obj_t * parent, lv_obj_t * title, uint32_t page_interval, int pages) {
+  lv_obj_t * list_cont = lv_obj_create(parent);
+  lv_obj_set_size(list_cont, 300, 180); // Leave space for title bar
+  lv_obj_align(list_cont, LV_ALIGN_TOP_MID, 0, 50); // Position below title bar
+  lv_obj_set_style_bg_color(list_cont, lv_color_white(), 0);
+  lv_obj_set_style_border_width(list_cont, 0, 0);
+  lv_obj_set_style_pad_all(list_cont, 0, 0);
+
+  news_view * view = (news_view *)lv_malloc(sizeof(news_view));
+  view->title = title;
+  view->page_interval = page_interval;
+  view->turns_left = pages - 1;
+  view->timer = NULL;
+  view->shown = false;
+
+  int32_t height = NEWS_VIEW_LINES * lv_font_get_line_height(NEWS_VIEW_FONT);
+  for (int row = 0; row < NEWS_VIEW_ROWS; row++) {
+    lv_obj_t * label = lv_label_create(list_cont);
+    lv_obj_set_style_text_font(label, NEWS_VIEW_FONT, 0);
+    // Text is already cut to fit, clipping only guards against a wrap that
+    // came out differently
+    lv_obj_set_size(label, NEWS_VIEW_WIDTH, height);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+    lv_obj_align(label, LV_ALIGN_TOP_LEFT, 10, row * NEWS_VIEW_ROW_HEIGHT);
+    view->rows[row] = label;
+  }
+  show_page(view, next_first);
+
+  lv_obj_add_event_cb(lv_obj_get_screen(parent), news_view_loaded, LV_EVENT_SCREEN_LOADED, view);
+  lv_obj_add_event_cb(list_cont, news_view_deleted, LV_EVENT_DELETE, view);
+  return list_cont;
+}
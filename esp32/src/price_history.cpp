@@ -0,0 +1,156 @@
+#include "price_history.h"
+
+#include <FS.h>
+#include <LittleFS.h>
+
+// Format version at the start of every history file
+static const char HISTORY_MAGIC[] = "PRH1";
+
+#define HISTORY_STEPS (PRICE_HISTORY_POINTS - 1)
+
+// `value` scaled from 10^from to 10^to. Returns false if it does not fit.
+static bool rescale(int32_t value, int from, int to, int32_t & out) {
+  int64_t scaled = value;
+  for (; from > to; from--) {
+    scaled *= 10;
+    if (scaled > INT32_MAX) {
+      return false;
+    }
+  }
+  for (; from < to; from++) {
+    scaled = (scaled + 5) / 10;
+  }
+  out = (int32_t)scaled;
+  return true;
+}
+
+static void restart(price_history & history, price_point point) {
+  history.last = point.value;
+  history.exponent = point.exponent;
+  history.count = 1;
+  history.head = 0;
+}
+
+void price_history_add(price_history & history, price_point point) {
+  if (point.value <= 0) {
+    return;
+  }
+  history.added++;
+
+  int32_t value;
+  if (history.count == 0 || !rescale(point.value, point.exponent, history.exponent, value) || value <= 0) {
+    restart(history, point);
+    return;
+  }
+  int32_t step = value - history.last;
+  if (step < INT16_MIN || step > INT16_MAX) {
+    restart(history, point);
+    return;
+  }
+
+  int held = history.count - 1;
+  if (held == HISTORY_STEPS) {
+    // Overwrite the oldest step
+    history.steps[history.head] = step;
+    history.head = (history.head + 1) % HISTORY_STEPS;
+  } else {
+    history.steps[(history.head + held) % HISTORY_STEPS] = step;
+    history.count++;
+  }
+  history.last = value;
+}
+
+int price_history_points(const price_history & history, int32_t * out) {
+  int count = history.count;
+  if (count == 0) {
+    return 0;
+  }
+  // Walk back from the newest point
+  out[count - 1] = history.last;
+  for (int i = count - 2; i >= 0; i--) {
+    out[i] = out[i + 1] - history.steps[(history.head + i) % HISTORY_STEPS];
+  }
+  return count;
+}
+
+#if PRICE_HISTORY_PERSIST
+struct history_header {
+  char magic[4];
+  uint16_t size; // sizeof(price_history) when the file was written
+};
+
+static bool history_mount() {
+  static bool tried = false;
+  static bool mounted = false;
+  if (!tried) {
+    // Formats the partition if it has no filesystem yet
+    mounted = LittleFS.begin(true);
+    tried = true;
+    if (!mounted) {
+      Serial.println("[PRICES] LittleFS mount failed, price history is not stored");
+    }
+  }
+  return mounted;
+}
+
+static String history_path(const char * key) {
+  return String("/") + key + ".prh";
+}
+
+bool price_history_load(const char * key, price_history & history) {
+  if (!history_mount()) {
+    return false;
+  }
+  File file = LittleFS.open(history_path(key), "r");
+  if (!file) {
+    return false;
+  }
+  history_header header;
+  price_history stored;
+  bool ok = file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            memcmp(header.magic, HISTORY_MAGIC, 4) == 0 &&
+            header.size == sizeof(stored) &&
+            file.read((uint8_t *)&stored, sizeof(stored)) == sizeof(stored) &&
+            stored.count <= PRICE_HISTORY_POINTS && stored.head < HISTORY_STEPS;
+  file.close();
+  if (ok) {
+    history = stored;
+    Serial.printf("[PRICES] Restored %d points of %s\n", history.count, key);
+  }
+  return ok;
+}
+
+void price_history_save(const char * key, const price_history & history) {
+  if (!history_mount()) {
+    return;
+  }
+  // Written next to the old copy and renamed over it once complete
+  String path = history_path(key);
+  String tmp_path = path + ".tmp";
+  File file = LittleFS.open(tmp_path, "w");
+  if (!file) {
+    return;
+  }
+  history_header header;
+  memcpy(header.magic, HISTORY_MAGIC, 4);
+  header.size = sizeof(history);
+  bool ok = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            file.write((const uint8_t *)&history, sizeof(history)) == sizeof(history);
+  file.close();
+  if (!ok || !LittleFS.rename(tmp_path, path)) {
+    Serial.printf("[PRICES] Could not store the history of %s\n", key);
+    LittleFS.remove(tmp_path);
+  }
+}
+#else
+bool price_history_load(const char * key, price_history & history) {
+  (void)key;
+  (void)history;
+  return false;
+}
+
+void price_history_save(const char * key, const price_history & history) {
+  (void)key;
+  (void)history;
+}
+#endif
@@ -0,0 +1,92 @@
+#include "sparkline.h"
+
+// How often a sparkline checks its history for a new point
+#define SPARKLINE_CHECK_INTERVAL 1000 // milliseconds
+
+struct sparkline {
+  lv_obj_t * chart;
+  lv_chart_series_t * series;
+  const price_history * history;
+  uint32_t shown;       // history->added when the chart was last updated
+  int32_t min, max;     // range of the y axis
+  lv_timer_t * timer;
+};
+
+// Fill the chart with every point held, scaled to fit
+static void sparkline_fill(sparkline * line) {
+  int32_t points[PRICE_HISTORY_POINTS];
+  int count = price_history_points(*line->history, points);
+  line->shown = line->history->added;
+
+  lv_chart_set_all_value(line->chart, line->series, LV_CHART_POINT_NONE);
+  if (count < 2) {
+    return;
+  }
+  line->min = line->max = points[0];
+  for (int i = 1; i < count; i++) {
+    line->min = points[i] < line->min ? points[i] : line->min;
+    line->max = points[i] > line->max ? points[i] : line->max;
+  }
+  // A flat line sits in the middle
+  if (line->min == line->max) {
+    line->min--;
+    line->max++;
+  }
+  lv_chart_set_range(line->chart, LV_CHART_AXIS_PRIMARY_Y, line->min, line->max);
+  // Shifted in from the right, so a short history ends at the right edge
+  for (int i = 0; i < count; i++) {
+    lv_chart_set_next_value(line->chart, line->series, points[i]);
+  }
+}
+
+static void sparkline_update(lv_timer_t * timer) {
+  sparkline * line = (sparkline *)lv_timer_get_user_data(timer);
+  const price_history & history = *line->history;
+  if (history.added == line->shown) {
+    return;
+  }
+  // One more point in range is appended. After a restart, several new points
+  // or a point off the scale, the chart is filled again.
+  if (history.added == line->shown + 1 && history.count > 2 &&
+      history.last >= line->min && history.last <= line->max) {
+    lv_chart_set_next_value(line->chart, line->series, history.last);
+    line->shown = history.added;
+  } else {
+    sparkline_fill(line);
+  }
+}
+
+static void sparkline_deleted(lv_event_t * e) {
+  sparkline * line = (sparkline *)lv_event_get_user_data(e);
+  lv_timer_delete(line->timer);
+  lv_free(line);
+}
+
+lv_obj_t * sparkline_create(lv_obj_t * parent, const price_history & history, int32_t width, int32_t height, lv_color_t color) {
+  lv_obj_t * chart = lv_chart_create(parent);
+  lv_obj_set_size(chart, width, height);
+  lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+  lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+  lv_chart_set_point_count(chart, PRICE_HISTORY_POINTS);
+  lv_chart_set_div_line_count(chart, 0, 0);
+  lv_obj_set_style_bg_opa(chart, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(chart, 0, 0);
+  lv_obj_set_style_pad_all(chart, 0, 0);
+  lv_obj_set_style_radius(chart, 0, 0);
+  lv_obj_set_style_line_width(chart, 2, LV_PART_ITEMS);
+  // No dots on the points
+  lv_obj_set_style_width(chart, 0, LV_PART_INDICATOR);
+  lv_obj_set_style_height(chart, 0, LV_PART_INDICATOR);
+
+  sparkline * line = (sparkline *)lv_malloc(sizeof(sparkline));
+  line->chart = chart;
+  line->series = lv_chart_add_series(chart, color, LV_CHART_AXIS_PRIMARY_Y);
+  line->history = &history;
+  line->min = 0;
+  line->max = 0;
+  sparkline_fill(line);
+
+  line->timer = lv_timer_create(sparkline_update, SPARKLINE_CHECK_INTERVAL, line);
+  lv_obj_add_event_cb(chart, sparkline_deleted, LV_EVENT_DELETE, line);
+  return chart;
+}
@@ -0,0 +1,100 @@
+#include "touch_input.h"
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <XPT2046_Touchscreen.h>
+
+#include "User_Setup.h"
+#include "daysync_config.h"
+
+// Native panel size, before the display rotation
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 320
+
+// The touch controller has its own SPI bus on the ESP32-2432S028
+static SPIClass touch_spi(VSPI);
+static XPT2046_Touchscreen touchscreen(TOUCH_CS, TOUCH_IRQ);
+
+// Press being tracked, in screen coordinates (after the rotation)
+static bool pressed = false;
+static bool press_used = false;   // a swipe was already recognised
+static int32_t press_x, press_y;
+static unsigned long press_start;
+
+static volatile touch_gesture pending = TOUCH_NONE;
+static unsigned long pending_at;
+
+static void recognise(touch_gesture gesture) {
+  pending = gesture;
+  pending_at = micros();
+}
+
+// Follow a press in screen coordinates through to a gesture
+static void track(bool down, int32_t x, int32_t y) {
+  if (down && !pressed) {
+    pressed = true;
+    press_used = false;
+    press_x = x;
+    press_y = y;
+    press_start = millis();
+    return;
+  }
+
+  int32_t dx = x - press_x;
+  int32_t dy = y - press_y;
+  if (down) {
+    if (!press_used && abs(dx) >= TOUCH_SWIPE_DISTANCE && abs(dx) > 2 * abs(dy)) {
+      press_used = true;
+      recognise(dx < 0 ? TOUCH_SWIPE_LEFT : TOUCH_SWIPE_RIGHT);
+    }
+  } else if (pressed) {
+    pressed = false;
+    if (!press_used && abs(dx) < TOUCH_TAP_DISTANCE && abs(dy) < TOUCH_TAP_DISTANCE &&
+        millis() - press_start < TOUCH_TAP_TIME) {
+      recognise(TOUCH_TAP);
+    }
+  }
+}
+
+static void touch_read(lv_indev_t * indev, lv_indev_data_t * data) {
+  LV_UNUSED(indev);
+  static int32_t last_x = 0, last_y = 0;
+
+  if (touchscreen.tirqTouched() && touchscreen.touched()) {
+    TS_Point p = touchscreen.getPoint();
+    // Raw readings to the native panel, clamped as the calibration is rough
+    int32_t x = constrain(map(p.x, TOUCH_RAW_X_MIN, TOUCH_RAW_X_MAX, 0, PANEL_WIDTH - 1), 0, PANEL_WIDTH - 1);
+    int32_t y = constrain(map(p.y, TOUCH_RAW_Y_MIN, TOUCH_RAW_Y_MAX, 0, PANEL_HEIGHT - 1), 0, PANEL_HEIGHT - 1);
+    data->point.x = x;
+    data->point.y = y;
+    data->state = LV_INDEV_STATE_PRESSED;
+    // LVGL turns the point with the display, at 270 degrees the screen's x
+    // is the panel's y
+    last_x = y;
+    last_y = PANEL_WIDTH - 1 - x;
+    track(true, last_x, last_y);
+  } else {
+    data->point.x = PANEL_WIDTH - 1 - last_y;
+    data->point.y = last_x;
+    data->state = LV_INDEV_STATE_RELEASED;
+    track(false, last_x, last_y);
+  }
+}
+
+void touch_input_begin() {
+  touch_spi.begin(TOUCH_CLK, TOUCH_MISO, TOUCH_MOSI, TOUCH_CS);
+  touchscreen.begin(touch_spi);
+  touchscreen.setRotation(2);
+
+  lv_indev_t * indev = lv_indev_create();
+  lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+  lv_indev_set_read_cb(indev, touch_read);
+  lv_timer_set_period(lv_indev_get_read_timer(indev), TOUCH_READ_PERIOD);
+}
+
+touch_gesture touch_input_take(unsigned long * at) {
+  touch_gesture gesture = pending;
+  pending = TOUCH_NONE;
+  *at = pending_at;
+  return gesture;
+}
@@ -0,0 +1,215 @@
+// Generated by scripts/gen_weather_icons.py, do not edit.
+
+#define WEATHER_ICON_SIZE 48
+
+enum weather_icon_id {
+  WEATHER_ICON_SUN,
+  WEATHER_ICON_MOON,
+  WEATHER_ICON_SUN_CLOUD,
+  WEATHER_ICON_MOON_CLOUD,
+  WEATHER_ICON_CLOUD,
+  WEATHER_ICON_FOG,
+  WEATHER_ICON_DRIZZLE,
+  WEATHER_ICON_RAIN,
+  WEATHER_ICON_SNOW,
+  WEATHER_ICON_THUNDER,
+  WEATHER_ICON_COUNT
+};
+
+// Where each icon's runs start in the atlas and how many bytes they take
+static const struct {
+  uint16_t offset;
+  uint16_t length;
+} WEATHER_ICON_INDEX[WEATHER_ICON_COUNT] = {
+  {0, 359}, // SUN
+  {359, 259}, // MOON
+  {618, 332}, // SUN_CLOUD
+  {950, 274}, // MOON_CLOUD
+  {1224, 224}, // CLOUD
+  {1448, 182}, // FOG
+  {1630, 261}, // DRIZZLE
+  {1891, 332}, // RAIN
+  {2223, 317}, // SNOW
+  {2540, 278}, // THUNDER
+};
+
+// 2818 bytes for 10 icons of 48x48
+static const uint8_t WEATHER_ICON_ATLAS[] = {
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x06, 0x61, 0x0f, 0x0f, 0x0c, 0x60, 0xf1, 0x60, 0x0f, 0x0f, 0x0b, 0x80, 0xf1, 0x80, 0x0f, 0x0f,
+  0x0b, 0x80, 0xf1, 0x80, 0x0f, 0x0f, 0x0b, 0x80, 0xf1, 0x80, 0x0f, 0x0f, 0x00, 0x70, 0x60, 0x08,
+  0x80, 0xf1, 0x80, 0x08, 0x60, 0x70, 0x0f, 0x04, 0x70, 0xf1, 0x90, 0x07, 0x80, 0xf1, 0x80, 0x07,
+  0x90, 0xf1, 0x70, 0x0f, 0x03, 0x60, 0xf2, 0x90, 0x06, 0x60, 0xf1, 0x60, 0x06, 0x90, 0xf2, 0x60,
+  0x0f, 0x04, 0x90, 0xf2, 0x90, 0x06, 0x61, 0x06, 0x90, 0xf2, 0x90, 0x0f, 0x06, 0x90, 0xf2, 0x80,
+  0x0d, 0x80, 0xf2, 0x90, 0x0f, 0x08, 0x90, 0xf2, 0x0d, 0xf2, 0x90, 0x0f, 0x0a, 0x80, 0xf0, 0x90,
+  0x02, 0x30, 0x90, 0xd0, 0xf1, 0xd0, 0x90, 0x30, 0x02, 0x90, 0xf0, 0x80, 0x0f, 0x0f, 0x10, 0x80,
+  0xf7, 0x80, 0x10, 0x0f, 0x0f, 0x02, 0x10, 0xc0, 0xf9, 0xc0, 0x10, 0x0f, 0x0f, 0x01, 0x80, 0xfb,
+  0x80, 0x0f, 0x0f, 0x00, 0x30, 0xfd, 0x30, 0x0f, 0x0f, 0x90, 0xfd, 0x90, 0x0f, 0x05, 0x60, 0x84,
+  0x60, 0x02, 0xd0, 0xfd, 0xd0, 0x02, 0x60, 0x84, 0x60, 0x0a, 0x60, 0xf6, 0x60, 0x01, 0xff, 0x01,
+  0x60, 0xf6, 0x60, 0x09, 0x60, 0xf6, 0x60, 0x01, 0xff, 0x01, 0x60, 0xf6, 0x60, 0x0a, 0x60, 0x84,
+  0x60, 0x02, 0xd0, 0xfd, 0xd0, 0x02, 0x60, 0x84, 0x60, 0x0f, 0x05, 0x90, 0xfd, 0x90, 0x0f, 0x0f,
+  0x30, 0xfd, 0x30, 0x0f, 0x0f, 0x00, 0x80, 0xfb, 0x80, 0x0f, 0x0f, 0x01, 0x10, 0xc0, 0xf9, 0xc0,
+  0x10, 0x0f, 0x0f, 0x02, 0x10, 0x80, 0xf7, 0x80, 0x10, 0x0f, 0x0f, 0x80, 0xf0, 0x90, 0x02, 0x30,
+  0x90, 0xd0, 0xf1, 0xd0, 0x90, 0x30, 0x02, 0x90, 0xf0, 0x80, 0x0f, 0x0a, 0x90, 0xf2, 0x0d, 0xf2,
+  0x90, 0x0f, 0x08, 0x90, 0xf2, 0x80, 0x0d, 0x80, 0xf2, 0x90, 0x0f, 0x06, 0x90, 0xf2, 0x90, 0x06,
+  0x61, 0x06, 0x90, 0xf2, 0x90, 0x0f, 0x04, 0x60, 0xf2, 0x90, 0x06, 0x60, 0xf1, 0x60, 0x06, 0x90,
+  0xf2, 0x60, 0x0f, 0x03, 0x70, 0xf1, 0x90, 0x07, 0x80, 0xf1, 0x80, 0x07, 0x90, 0xf1, 0x70, 0x0f,
+  0x04, 0x70, 0x60, 0x08, 0x80, 0xf1, 0x80, 0x08, 0x60, 0x70, 0x0f, 0x0f, 0x00, 0x80, 0xf1, 0x80,
+  0x0f, 0x0f, 0x0b, 0x80, 0xf1, 0x80, 0x0f, 0x0f, 0x0b, 0x80, 0xf1, 0x80, 0x0f, 0x0f, 0x0b, 0x60,
+  0xf1, 0x60, 0x0f, 0x0f, 0x0c, 0x61, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x06, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x02, 0x40, 0x80, 0xa0, 0x20, 0x0f, 0x0f, 0x09, 0x60, 0xd0,
+  0xf0, 0xe0, 0x30, 0x0f, 0x0f, 0x08, 0x30, 0xc0, 0xf2, 0x70, 0x0f, 0x0f, 0x08, 0x50, 0xe0, 0xf2,
+  0xb0, 0x0f, 0x0f, 0x08, 0x50, 0xf4, 0x60, 0x0f, 0x0f, 0x07, 0x30, 0xe0, 0xf3, 0xe0, 0x0f, 0x0f,
+  0x08, 0xc0, 0xf4, 0xa0, 0x0f, 0x0f, 0x07, 0x60, 0xf5, 0x80, 0x0f, 0x0f, 0x07, 0xd0, 0xf5, 0x80,
+  0x0f, 0x0f, 0x06, 0x40, 0xf6, 0x80, 0x0f, 0x0f, 0x06, 0x80, 0xf6, 0x80, 0x0f, 0x0f, 0x06, 0xb0,
+  0xf6, 0x90, 0x0f, 0x0f, 0x06, 0xe0, 0xf6, 0xd0, 0x0f, 0x0f, 0x06, 0xf8, 0x40, 0x0f, 0x0f, 0x05,
+  0xf8, 0xb0, 0x0f, 0x0f, 0x05, 0xe0, 0xf8, 0x40, 0x0f, 0x0f, 0x04, 0xb0, 0xf8, 0xe0, 0x10, 0x0f,
+  0x0f, 0x03, 0x80, 0xf9, 0xc0, 0x10, 0x0f, 0x0f, 0x02, 0x40, 0xfa, 0xc0, 0x30, 0x0f, 0x0f, 0x02,
+  0xd0, 0xfb, 0x80, 0x10, 0x08, 0x40, 0x90, 0x0f, 0x05, 0x60, 0xfc, 0xe0, 0x90, 0x50, 0x20, 0x02,
+  0x40, 0x70, 0xc0, 0xf0, 0x60, 0x0f, 0x06, 0xc0, 0xff, 0xf5, 0xc0, 0x0f, 0x07, 0x30, 0xe0, 0xff,
+  0xf3, 0xe0, 0x30, 0x0f, 0x08, 0x50, 0xff, 0xf3, 0x50, 0x0f, 0x0a, 0x50, 0xe0, 0xff, 0xe0, 0x50,
+  0x0f, 0x0c, 0x30, 0xc0, 0xfd, 0xc0, 0x30, 0x0f, 0x0f, 0x60, 0xd0, 0xf9, 0xd0, 0x60, 0x0f, 0x0f,
+  0x03, 0x40, 0x80, 0xb0, 0xe0, 0xf1, 0xe0, 0xb0, 0x80, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x02, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x61, 0x0f, 0x0f, 0x0c, 0x60, 0xf1, 0x60, 0x0f, 0x0f, 0x0b, 0x80,
+  0xf1, 0x80, 0x0f, 0x0f, 0x0b, 0x80, 0xf1, 0x80, 0x0f, 0x0f, 0x02, 0x10, 0xa0, 0x80, 0x05, 0x80,
+  0xf1, 0x80, 0x05, 0x80, 0xa0, 0x10, 0x0f, 0x09, 0xa0, 0xf1, 0x90, 0x04, 0x60, 0xf1, 0x60, 0x04,
+  0x90, 0xf1, 0xa0, 0x0f, 0x09, 0x80, 0xf2, 0x90, 0x04, 0x61, 0x04, 0x90, 0xf2, 0x80, 0x0f, 0x0a,
+  0x90, 0xf2, 0x60, 0x09, 0x60, 0xf2, 0x90, 0x0f, 0x0c, 0x90, 0xf1, 0x40, 0x09, 0x40, 0x81, 0x70,
+  0x0f, 0x0e, 0x60, 0x40, 0x02, 0x70, 0xc0, 0xf1, 0xc0, 0x40, 0x0f, 0x0f, 0x07, 0x10, 0xc0, 0xf2,
+  0xe0, 0x50, 0x0f, 0x0f, 0x08, 0xc0, 0xf2, 0xc0, 0x10, 0x02, 0x60, 0xa0, 0xd0, 0xf1, 0xd0, 0xa0,
+  0x60, 0x0f, 0x0d, 0x70, 0xf2, 0xc0, 0x10, 0x01, 0x50, 0xd0, 0xf7, 0xd0, 0x50, 0x0f, 0x03, 0x60,
+  0x82, 0x60, 0x02, 0xc0, 0xf1, 0xe0, 0x10, 0x01, 0x90, 0xfb, 0x90, 0x0f, 0x01, 0x60, 0xf4, 0x60,
+  0x01, 0xf2, 0x50, 0x01, 0x90, 0xfd, 0x90, 0x0f, 0x00, 0x60, 0xf4, 0x60, 0x01, 0xf1, 0xb0, 0x01,
+  0x50, 0xff, 0x50, 0x0f, 0x00, 0x60, 0x82, 0x60, 0x02, 0xc0, 0xf0, 0x60, 0x01, 0xd0, 0xff, 0xd0,
+  0x0f, 0x08, 0x70, 0xf0, 0x01, 0x60, 0xff, 0xf1, 0x60, 0x0f, 0x08, 0x80, 0x01, 0xa0, 0xff, 0xf1,
+  0xa0, 0x0f, 0x0b, 0xd0, 0xff, 0xf2, 0xd0, 0x90, 0x30, 0x0f, 0x08, 0xff, 0xf6, 0x80, 0x10, 0x0f,
+  0x02, 0x20, 0x80, 0xc0, 0xff, 0xf8, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff, 0xfb, 0x80, 0x0c,
+  0x20, 0x01, 0x60, 0xff, 0xfe, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfe, 0x90, 0x0d, 0x80, 0xff, 0xff,
+  0xd0, 0x0d, 0xc0, 0xff, 0xff, 0xf0, 0x0d, 0xff, 0xff, 0xf1, 0x0d, 0xff, 0xff, 0xf0, 0xd0, 0x0d,
+  0xc0, 0xff, 0xff, 0x90, 0x0d, 0x80, 0xff, 0xff, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfd, 0x80, 0x0f,
+  0x60, 0xff, 0xfc, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff, 0xf9, 0x80, 0x10, 0x0f, 0x02, 0x20,
+  0x80, 0xc0, 0xff, 0xf4, 0xd0, 0x90, 0x30, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x08, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x40,
+  0x90, 0x80, 0x0f, 0x0f, 0x0a, 0x30, 0xb0, 0xf0, 0xb0, 0x0f, 0x0f, 0x0a, 0x30, 0xe0, 0xf1, 0x20,
+  0x0f, 0x0f, 0x09, 0x30, 0xe0, 0xf1, 0xc0, 0x0f, 0x0f, 0x0a, 0xb0, 0xf2, 0x80, 0x0f, 0x0f, 0x09,
+  0x40, 0xf3, 0x80, 0x0f, 0x0f, 0x09, 0x90, 0xf3, 0x80, 0x06, 0x60, 0xa0, 0xd0, 0xf1, 0xd0, 0xa0,
+  0x60, 0x0f, 0x0a, 0xd0, 0xf3, 0x80, 0x04, 0x50, 0xd0, 0xf7, 0xd0, 0x50, 0x0f, 0x08, 0xf4, 0xd0,
+  0x03, 0x90, 0xfb, 0x90, 0x0f, 0x07, 0xf5, 0x30, 0x01, 0x90, 0xfd, 0x90, 0x0f, 0x06, 0xd0, 0xf3,
+  0xb0, 0x01, 0x50, 0xff, 0x50, 0x0f, 0x05, 0x90, 0xf3, 0x60, 0x01, 0xd0, 0xff, 0xd0, 0x0f, 0x05,
+  0x40, 0xf3, 0x01, 0x60, 0xff, 0xf1, 0x60, 0x0f, 0x05, 0xb0, 0xf1, 0x90, 0x01, 0xa0, 0xff, 0xf1,
+  0xa0, 0x0f, 0x05, 0x30, 0x90, 0x20, 0x02, 0xd0, 0xff, 0xf2, 0xd0, 0x90, 0x30, 0x0f, 0x08, 0xff,
+  0xf6, 0x80, 0x10, 0x0f, 0x02, 0x20, 0x80, 0xc0, 0xff, 0xf8, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0,
+  0xff, 0xfb, 0x80, 0x0f, 0x60, 0xff, 0xfe, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfe, 0x90, 0x0d, 0x80,
+  0xff, 0xff, 0xd0, 0x0d, 0xc0, 0xff, 0xff, 0xf0, 0x0d, 0xff, 0xff, 0xf1, 0x0d, 0xff, 0xff, 0xf0,
+  0xd0, 0x0d, 0xc0, 0xff, 0xff, 0x90, 0x0d, 0x80, 0xff, 0xff, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfd,
+  0x80, 0x0f, 0x60, 0xff, 0xfc, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff, 0xf9, 0x80, 0x10, 0x0f,
+  0x02, 0x20, 0x80, 0xc0, 0xff, 0xf4, 0xd0, 0x90, 0x30, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x08, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x05, 0x60, 0xa0, 0xd0, 0xf1, 0xd0, 0xa0, 0x60, 0x0f,
+  0x0f, 0x05, 0x50, 0xd0, 0xf7, 0xd0, 0x50, 0x0f, 0x0f, 0x02, 0x90, 0xfb, 0x90, 0x0f, 0x0f, 0x00,
+  0x90, 0xfd, 0x90, 0x0f, 0x0e, 0x50, 0xff, 0x50, 0x0f, 0x0d, 0xd0, 0xff, 0xd0, 0x0f, 0x0c, 0x60,
+  0xff, 0xf1, 0x60, 0x0f, 0x0b, 0xa0, 0xff, 0xf1, 0xa0, 0x0f, 0x0b, 0xd0, 0xff, 0xf2, 0xd0, 0x90,
+  0x30, 0x0f, 0x08, 0xff, 0xf6, 0x80, 0x10, 0x0f, 0x02, 0x20, 0x80, 0xc0, 0xff, 0xf8, 0xc0, 0x10,
+  0x0f, 0x00, 0x60, 0xe0, 0xff, 0xfb, 0x80, 0x0f, 0x60, 0xff, 0xfe, 0x30, 0x0d, 0x20, 0xe0, 0xff,
+  0xfe, 0x90, 0x0d, 0x80, 0xff, 0xff, 0xd0, 0x0d, 0xc0, 0xff, 0xff, 0xf0, 0x0d, 0xff, 0xff, 0xf1,
+  0x0d, 0xff, 0xff, 0xf0, 0xd0, 0x0d, 0xc0, 0xff, 0xff, 0x90, 0x0d, 0x80, 0xff, 0xff, 0x30, 0x0d,
+  0x20, 0xe0, 0xff, 0xfd, 0x80, 0x0f, 0x60, 0xff, 0xfc, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff,
+  0xf9, 0x80, 0x10, 0x0f, 0x02, 0x20, 0x80, 0xc0, 0xff, 0xf4, 0xd0, 0x90, 0x30, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x08, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x60, 0xe0, 0xff, 0xfb, 0xe0, 0x60, 0x0f, 0xe0, 0xff, 0xfd,
+  0xe0, 0x0f, 0xe0, 0xff, 0xfd, 0xe0, 0x0f, 0x60, 0xe0, 0xff, 0xfb, 0xe0, 0x60, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x60, 0xe0, 0xff, 0xfb, 0xe0, 0x60,
+  0x0f, 0xe0, 0xff, 0xfd, 0xe0, 0x0f, 0xe0, 0xff, 0xfd, 0xe0, 0x0f, 0x60, 0xe0, 0xff, 0xfb, 0xe0,
+  0x60, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x60,
+  0xe0, 0xff, 0xfb, 0xe0, 0x60, 0x0f, 0xe0, 0xff, 0xfd, 0xe0, 0x0f, 0xe0, 0xff, 0xfd, 0xe0, 0x0f,
+  0x60, 0xe0, 0xff, 0xfb, 0xe0, 0x60, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x05, 0x60, 0xa0, 0xd0, 0xf1, 0xd0, 0xa0, 0x60, 0x0f, 0x0f, 0x05, 0x50, 0xd0, 0xf7, 0xd0,
+  0x50, 0x0f, 0x0f, 0x02, 0x90, 0xfb, 0x90, 0x0f, 0x0f, 0x00, 0x90, 0xfd, 0x90, 0x0f, 0x0e, 0x50,
+  0xff, 0x50, 0x0f, 0x0d, 0xd0, 0xff, 0xd0, 0x0f, 0x0c, 0x60, 0xff, 0xf1, 0x60, 0x0f, 0x0b, 0xa0,
+  0xff, 0xf1, 0xa0, 0x0f, 0x0b, 0xd0, 0xff, 0xf2, 0xd0, 0x90, 0x30, 0x0f, 0x08, 0xff, 0xf6, 0x80,
+  0x10, 0x0f, 0x02, 0x20, 0x80, 0xc0, 0xff, 0xf8, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff, 0xfb,
+  0x80, 0x0f, 0x60, 0xff, 0xfe, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfe, 0x90, 0x0d, 0x80, 0xff, 0xff,
+  0xd0, 0x0d, 0xc0, 0xff, 0xff, 0xf0, 0x0d, 0xff, 0xff, 0xf1, 0x0d, 0xff, 0xff, 0xf0, 0xd0, 0x0d,
+  0xc0, 0xff, 0xff, 0x90, 0x0d, 0x80, 0xff, 0xff, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfd, 0x80, 0x0f,
+  0x60, 0xff, 0xfc, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff, 0xf9, 0x80, 0x10, 0x0f, 0x02, 0x20,
+  0x80, 0xc0, 0xff, 0xf4, 0xd0, 0x90, 0x30, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x08, 0x60, 0xe1,
+  0x60, 0x0b, 0x60, 0xe1, 0x60, 0x0f, 0x0b, 0xe0, 0xf1, 0xe0, 0x0b, 0xe0, 0xf1, 0xe0, 0x0f, 0x0b,
+  0xe0, 0xf1, 0xe0, 0x0b, 0xe0, 0xf1, 0xe0, 0x0f, 0x0b, 0x60, 0xe1, 0x60, 0x0b, 0x60, 0xe1, 0x60,
+  0x0f, 0x0f, 0x03, 0x60, 0xe1, 0x60, 0x0f, 0x0f, 0x0b, 0xe0, 0xf1, 0xe0, 0x0f, 0x0f, 0x0b, 0xe0,
+  0xf1, 0xe0, 0x0f, 0x0f, 0x0b, 0x60, 0xe1, 0x60, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x05, 0x60, 0xa0, 0xd0, 0xf1, 0xd0, 0xa0, 0x60, 0x0f, 0x0f,
+  0x05, 0x50, 0xd0, 0xf7, 0xd0, 0x50, 0x0f, 0x0f, 0x02, 0x90, 0xfb, 0x90, 0x0f, 0x0f, 0x00, 0x90,
+  0xfd, 0x90, 0x0f, 0x0e, 0x50, 0xff, 0x50, 0x0f, 0x0d, 0xd0, 0xff, 0xd0, 0x0f, 0x0c, 0x60, 0xff,
+  0xf1, 0x60, 0x0f, 0x0b, 0xa0, 0xff, 0xf1, 0xa0, 0x0f, 0x0b, 0xd0, 0xff, 0xf2, 0xd0, 0x90, 0x30,
+  0x0f, 0x08, 0xff, 0xf6, 0x80, 0x10, 0x0f, 0x02, 0x20, 0x80, 0xc0, 0xff, 0xf8, 0xc0, 0x10, 0x0f,
+  0x00, 0x60, 0xe0, 0xff, 0xfb, 0x80, 0x0f, 0x60, 0xff, 0xfe, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfe,
+  0x90, 0x0d, 0x80, 0xff, 0xff, 0xd0, 0x0d, 0xc0, 0xff, 0xff, 0xf0, 0x0d, 0xff, 0xff, 0xf1, 0x0d,
+  0xff, 0xff, 0xf0, 0xd0, 0x0d, 0xc0, 0xff, 0xff, 0x90, 0x0d, 0x80, 0xff, 0xff, 0x30, 0x0d, 0x20,
+  0xe0, 0xff, 0xfd, 0x80, 0x0f, 0x60, 0xff, 0xfc, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff, 0xf9,
+  0x80, 0x10, 0x0f, 0x02, 0x20, 0x80, 0xc0, 0xff, 0xf4, 0xd0, 0x90, 0x30, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0a, 0x61, 0x05, 0x61, 0x05, 0x61, 0x0f, 0x0c, 0x60, 0xf1,
+  0x60, 0x03, 0x60, 0xf1, 0x60, 0x03, 0x60, 0xf1, 0x60, 0x0f, 0x0b, 0xd0, 0xf1, 0x60, 0x03, 0xd0,
+  0xf1, 0x60, 0x03, 0xd0, 0xf1, 0x60, 0x0f, 0x0a, 0x60, 0xf1, 0xd0, 0x03, 0x60, 0xf1, 0xd0, 0x03,
+  0x60, 0xf1, 0xd0, 0x0f, 0x0b, 0xd0, 0xf1, 0x60, 0x03, 0xd0, 0xf1, 0x60, 0x03, 0xd0, 0xf1, 0x60,
+  0x0f, 0x0a, 0x60, 0xf1, 0xd0, 0x03, 0x60, 0xf1, 0xd0, 0x03, 0x60, 0xf1, 0xd0, 0x0f, 0x0b, 0xd0,
+  0xf1, 0x60, 0x03, 0xd0, 0xf1, 0x60, 0x03, 0xd0, 0xf1, 0x60, 0x0f, 0x0a, 0x60, 0xf1, 0xd0, 0x03,
+  0x60, 0xf1, 0xd0, 0x03, 0x60, 0xf1, 0xd0, 0x0f, 0x0b, 0xd0, 0xf1, 0x60, 0x03, 0xd0, 0xf1, 0x60,
+  0x03, 0xd0, 0xf1, 0x60, 0x0f, 0x0a, 0x60, 0xf1, 0xd0, 0x03, 0x60, 0xf1, 0xd0, 0x03, 0x60, 0xf1,
+  0xd0, 0x0f, 0x0b, 0x60, 0xf1, 0x60, 0x03, 0x60, 0xf1, 0x60, 0x03, 0x60, 0xf1, 0x60, 0x0f, 0x0c,
+  0x61, 0x05, 0x61, 0x05, 0x61, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x05, 0x60, 0xa0, 0xd0, 0xf1, 0xd0, 0xa0, 0x60, 0x0f, 0x0f, 0x05, 0x50, 0xd0, 0xf7,
+  0xd0, 0x50, 0x0f, 0x0f, 0x02, 0x90, 0xfb, 0x90, 0x0f, 0x0f, 0x00, 0x90, 0xfd, 0x90, 0x0f, 0x0e,
+  0x50, 0xff, 0x50, 0x0f, 0x0d, 0xd0, 0xff, 0xd0, 0x0f, 0x0c, 0x60, 0xff, 0xf1, 0x60, 0x0f, 0x0b,
+  0xa0, 0xff, 0xf1, 0xa0, 0x0f, 0x0b, 0xd0, 0xff, 0xf2, 0xd0, 0x90, 0x30, 0x0f, 0x08, 0xff, 0xf6,
+  0x80, 0x10, 0x0f, 0x02, 0x20, 0x80, 0xc0, 0xff, 0xf8, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff,
+  0xfb, 0x80, 0x0f, 0x60, 0xff, 0xfe, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfe, 0x90, 0x0d, 0x80, 0xff,
+  0xff, 0xd0, 0x0d, 0xc0, 0xff, 0xff, 0xf0, 0x0d, 0xff, 0xff, 0xf1, 0x0d, 0xff, 0xff, 0xf0, 0xd0,
+  0x0d, 0xc0, 0xff, 0xff, 0x90, 0x0d, 0x80, 0xff, 0xff, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfd, 0x80,
+  0x0f, 0x60, 0xff, 0xfc, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff, 0xf9, 0x80, 0x10, 0x0f, 0x02,
+  0x20, 0x80, 0xc0, 0xff, 0xf4, 0xd0, 0x90, 0x30, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x09, 0xc1, 0x0f, 0x0f, 0x0d, 0xf1, 0x09, 0xc1,
+  0x0f, 0x0d, 0x50, 0xf0, 0x90, 0x10, 0xf1, 0x10, 0x90, 0xf0, 0x50, 0x05, 0xf1, 0x0f, 0x0d, 0x50,
+  0xf1, 0xe0, 0xf1, 0xe0, 0xf1, 0x50, 0x01, 0x50, 0xf0, 0x90, 0x10, 0xf1, 0x10, 0x90, 0xf0, 0x50,
+  0x0f, 0x0a, 0x20, 0xb0, 0xf3, 0xb0, 0x20, 0x02, 0x50, 0xf1, 0xe0, 0xf1, 0xe0, 0xf1, 0x50, 0x0f,
+  0x0a, 0x20, 0xb0, 0xf3, 0xb0, 0x20, 0x03, 0x20, 0xb0, 0xf3, 0xb0, 0x20, 0x0f, 0x0a, 0x50, 0xf1,
+  0xe0, 0xf1, 0xe0, 0xf1, 0x50, 0x02, 0x20, 0xb0, 0xf3, 0xb0, 0x20, 0x0f, 0x0a, 0x50, 0xf0, 0x90,
+  0x10, 0xf1, 0x10, 0x90, 0xf0, 0x50, 0x01, 0x50, 0xf1, 0xe0, 0xf1, 0xe0, 0xf1, 0x50, 0x0f, 0x0d,
+  0xf1, 0x05, 0x50, 0xf0, 0x90, 0x10, 0xf1, 0x10, 0x90, 0xf0, 0x50, 0x0f, 0x0d, 0xc1, 0x09, 0xf1,
+  0x0f, 0x0f, 0x0d, 0xc1, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x05,
+  0x60, 0xa0, 0xd0, 0xf1, 0xd0, 0xa0, 0x60, 0x0f, 0x0f, 0x05, 0x50, 0xd0, 0xf7, 0xd0, 0x50, 0x0f,
+  0x0f, 0x02, 0x90, 0xfb, 0x90, 0x0f, 0x0f, 0x00, 0x90, 0xfd, 0x90, 0x0f, 0x0e, 0x50, 0xff, 0x50,
+  0x0f, 0x0d, 0xd0, 0xff, 0xd0, 0x0f, 0x0c, 0x60, 0xff, 0xf1, 0x60, 0x0f, 0x0b, 0xa0, 0xff, 0xf1,
+  0xa0, 0x0f, 0x0b, 0xd0, 0xff, 0xf2, 0xd0, 0x90, 0x30, 0x0f, 0x08, 0xff, 0xf6, 0x80, 0x10, 0x0f,
+  0x02, 0x20, 0x80, 0xc0, 0xff, 0xf8, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff, 0xfb, 0x80, 0x0f,
+  0x60, 0xff, 0xfe, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfe, 0x90, 0x0d, 0x80, 0xff, 0xff, 0xd0, 0x0d,
+  0xc0, 0xff, 0xff, 0xf0, 0x0d, 0xff, 0xff, 0xf1, 0x0d, 0xff, 0xff, 0xf0, 0xd0, 0x0d, 0xc0, 0xff,
+  0xff, 0x90, 0x0d, 0x80, 0xff, 0xff, 0x30, 0x0d, 0x20, 0xe0, 0xff, 0xfd, 0x80, 0x0f, 0x60, 0xff,
+  0xfc, 0xc0, 0x10, 0x0f, 0x00, 0x60, 0xe0, 0xff, 0xf9, 0x80, 0x10, 0x0f, 0x02, 0x20, 0x80, 0xc0,
+  0xff, 0xf4, 0xd0, 0x90, 0x30, 0x0f, 0x0f, 0x02, 0x60, 0xf0, 0xa0, 0x0f, 0x0f, 0x0b, 0x30, 0xf0,
+  0xe0, 0x10, 0x0f, 0x0f, 0x0a, 0x10, 0xe0, 0xf0, 0x50, 0x0f, 0x0f, 0x0b, 0xc0, 0xf0, 0xa0, 0x0f,
+  0x0f, 0x0b, 0x90, 0xf0, 0xe0, 0x10, 0x0f, 0x0f, 0x0a, 0x60, 0xf1, 0x50, 0x0f, 0x0f, 0x0a, 0x30,
+  0xf6, 0x90, 0x0f, 0x0f, 0x05, 0x10, 0xe0, 0xf5, 0xb0, 0x0f, 0x0f, 0x06, 0xc0, 0xf5, 0xd0, 0x10,
+  0x0f, 0x0f, 0x05, 0x90, 0xf5, 0xe0, 0x30, 0x0f, 0x0f, 0x0a, 0x40, 0xf1, 0x50, 0x0f, 0x0f, 0x0b,
+  0x90, 0xf0, 0x80, 0x0f, 0x0f, 0x0b, 0x20, 0xf0, 0x90, 0x0f, 0x0f, 0x0c, 0x80, 0xc0, 0x10, 0x0f,
+  0x0f, 0x0c, 0xd0, 0x20, 0x0f, 0x0f, 0x0c, 0x60, 0x30, 0x0f, 0x0f, 0x0d, 0x30, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x09,
+};
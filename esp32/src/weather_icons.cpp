@@ -0,0 +1,139 @@
+#include "weather_icons.h"
+
+#include <Arduino.h>
+
+#include "weather_icon_atlas.h"
+
+struct icon_slot {
+  bool loaded;
+  int icon;             // WEATHER_ICON_* held
+  uint32_t last_used;
+  lv_image_dsc_t image;
+  uint8_t pixels[WEATHER_ICON_SIZE * WEATHER_ICON_SIZE];
+};
+
+static icon_slot slots[WEATHER_ICON_CACHE_SLOTS];
+static uint32_t uses = 0;
+
+// The icon drawn for a WMO weather code, or -1
+static int icon_for_code(int code, bool day) {
+  if (code == 0 || code == 1) {
+    return day ? WEATHER_ICON_SUN : WEATHER_ICON_MOON;
+  }
+  if (code == 2) {
+    return day ? WEATHER_ICON_SUN_CLOUD : WEATHER_ICON_MOON_CLOUD;
+  }
+  if (code == 3) {
+    return WEATHER_ICON_CLOUD;
+  }
+  if (code == 45 || code == 48) {
+    return WEATHER_ICON_FOG;
+  }
+  if (code >= 51 && code <= 57) {
+    return WEATHER_ICON_DRIZZLE;
+  }
+  if ((code >= 61 && code <= 67) || (code >= 80 && code <= 82)) {
+    return WEATHER_ICON_RAIN;
+  }
+  if ((code >= 71 && code <= 77) || code == 85 || code == 86) {
+    return WEATHER_ICON_SNOW;
+  }
+  if (code >= 95 && code <= 99) {
+    return WEATHER_ICON_THUNDER;
+  }
+  return -1;
+}
+
+// Expand an icon's runs into A8 pixels. Each byte is a 4-bit coverage level
+// and a run length of 1-16.
+static void decode_icon(int icon, uint8_t * pixels) {
+  const uint8_t * run = WEATHER_ICON_ATLAS + WEATHER_ICON_INDEX[icon].offset;
+  const uint8_t * end = run + WEATHER_ICON_INDEX[icon].length;
+  uint8_t * out = pixels;
+  uint8_t * out_end = pixels + WEATHER_ICON_SIZE * WEATHER_ICON_SIZE;
+  for (; run < end; run++) {
+    uint8_t alpha = (*run >> 4) * 17;
+    int count = (*run & 0x0F) + 1;
+    for (; count > 0 && out < out_end; count--) {
+      *out++ = alpha;
+    }
+  }
+  // A short stream leaves the rest clear
+  memset(out, 0, out_end - out);
+}
+
+const lv_image_dsc_t * weather_icon(int code, bool day) {
+  int icon = icon_for_code(code, day);
+  if (icon < 0) {
+    return NULL;
+  }
+
+  uses++;
+  for (int i = 0; i < WEATHER_ICON_CACHE_SLOTS; i++) {
+    if (slots[i].loaded && slots[i].icon == icon) {
+      slots[i].last_used = uses;
+      return &slots[i].image;
+    }
+  }
+
+  // Take an empty slot, or else the one used longest ago
+  icon_slot * slot = &slots[0];
+  for (int i = 1; i < WEATHER_ICON_CACHE_SLOTS && slot->loaded; i++) {
+    if (!slots[i].loaded || slots[i].last_used < slot->last_used) {
+      slot = &slots[i];
+    }
+  }
+
+  unsigned long start = micros();
+  if (slot->loaded) {
+    // LVGL may have cached what was drawn from this slot
+    lv_image_cache_drop(&slot->image);
+  }
+  decode_icon(icon, slot->pixels);
+  slot->image.header.magic = LV_IMAGE_HEADER_MAGIC;
+  slot->image.header.cf = LV_COLOR_FORMAT_A8;
+  slot->image.header.w = WEATHER_ICON_SIZE;
+  slot->image.header.h = WEATHER_ICON_SIZE;
+  slot->image.header.stride = WEATHER_ICON_SIZE;
+  slot->image.data_size = sizeof(slot->pixels);
+  slot->image.data = slot->pixels;
+  slot->icon = icon;
+  slot->loaded = true;
+  slot->last_used = uses;
+  Serial.printf("[ICONS] Decoded weather icon %d in %lu us\n", icon, micros() - start);
+  return &slot->image;
+}
+
+const char * weather_name(int code) {
+  switch (code) {
+    case 0: return "Clear sky";
+    case 1: return "Mainly clear";
+    case 2: return "Partly cloudy";
+    case 3: return "Overcast";
+    case 45: return "Fog";
+    case 48: return "Rime fog";
+    case 51: return "Light drizzle";
+    case 53: return "Drizzle";
+    case 55: return "Heavy drizzle";
+    case 56:
+    case 57: return "Freezing drizzle";
+    case 61: return "Light rain";
+    case 63: return "Rain";
+    case 65: return "Heavy rain";
+    case 66:
+    case 67: return "Freezing rain";
+    case 71: return "Light snow";
+    case 73: return "Snow";
+    case 75: return "Heavy snow";
+    case 77: return "Snow grains";
+    case 80:
+    case 81: return "Rain showers";
+    case 82: return "Heavy showers";
+    case 85:
+    case 86: return "Snow showers";
+    case 95: return "Thunderstorm";
+    case 96:
+    case 99: return "Thunderstorm, hail";
+    default: return "";
+  }
+}
@@ -0,0 +1,155 @@
+#include "wifi_manager.h"
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include "daysync_config.h"
+
+enum wifi_state {
+  WIFI_CONNECTING, // an attempt is under way
+  WIFI_CONNECTED,
+  WIFI_WAITING,    // backing off before the next attempt
+};
+
+static const char * wifi_ssid;
+static const char * wifi_password;
+
+static wifi_state state = WIFI_CONNECTING;
+static unsigned long attempt_start = 0; // when the current attempt began
+static unsigned long attempts = 0;      // since the last connection
+static unsigned long next_attempt = 0;
+static unsigned long backoff = WIFI_BACKOFF_MIN;
+static unsigned long lost_at = 0;       // when the connection was lost
+
+// Set by the event callbacks, which run in the WiFi task, and handled in
+// wifi_manager_loop()
+static volatile bool got_ip_event = false;
+static volatile unsigned long got_ip_at = 0;
+static volatile bool disconnected_event = false;
+static volatile unsigned long disconnected_at = 0;
+static volatile uint8_t disconnected_reason = 0;
+
+struct wifi_stats {
+  unsigned long drops;            // connections lost
+  unsigned long failed_attempts;
+  unsigned long offline_ms;       // time without a connection after the first
+  unsigned long last_offline_ms;
+  unsigned long max_offline_ms;
+  unsigned long last_attempt_ms;  // time the successful attempt took
+  unsigned long max_attempt_ms;
+};
+static wifi_stats stats = {0, 0, 0, 0, 0, 0, 0};
+
+static void on_got_ip(WiFiEvent_t event, WiFiEventInfo_t info) {
+  (void)event;
+  (void)info;
+  got_ip_at = millis();
+  got_ip_event = true;
+}
+
+static void on_disconnected(WiFiEvent_t event, WiFiEventInfo_t info) {
+  (void)event;
+  disconnected_reason = info.wifi_sta_disconnected.reason;
+  disconnected_at = millis();
+  disconnected_event = true;
+}
+
+static void start_attempt() {
+  attempts++;
+  attempt_start = millis();
+  state = WIFI_CONNECTING;
+  WiFi.begin(wifi_ssid, wifi_password);
+}
+
+// Wait before the next attempt, twice as long as before
+static void back_off(unsigned long now) {
+  stats.failed_attempts++;
+  next_attempt = now + backoff;
+  Serial.printf("[WIFI] Attempt %lu failed, retrying in %lu ms\n", attempts, backoff);
+  backoff = backoff * 2 > WIFI_BACKOFF_MAX ? WIFI_BACKOFF_MAX : backoff * 2;
+  state = WIFI_WAITING;
+}
+
+void wifi_manager_begin(const char * ssid, const char * password) {
+  wifi_ssid = ssid;
+  wifi_password = password;
+
+  // Reconnecting is done here, with backoff, rather than by the driver
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(false);
+  WiFi.onEvent(on_got_ip, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  WiFi.onEvent(on_disconnected, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+
+  Serial.printf("[WIFI] Connecting to %s\n", ssid);
+  start_attempt();
+}
+
+bool wifi_manager_loop() {
+  unsigned long now = millis();
+
+  if (got_ip_event) {
+    got_ip_event = false;
+    unsigned long at = got_ip_at;
+    bool reconnect = lost_at != 0;
+
+    stats.last_attempt_ms = at - attempt_start;
+    if (stats.last_attempt_ms > stats.max_attempt_ms) {
+      stats.max_attempt_ms = stats.last_attempt_ms;
+    }
+    if (reconnect) {
+      stats.last_offline_ms = at - lost_at;
+      stats.offline_ms += stats.last_offline_ms;
+      if (stats.last_offline_ms > stats.max_offline_ms) {
+        stats.max_offline_ms = stats.last_offline_ms;
+      }
+    }
+    Serial.printf("[WIFI] Connected with IP address %s after %lu attempt(s), %lu ms\n",
+                  WiFi.localIP().toString().c_str(), attempts, stats.last_attempt_ms);
+    if (reconnect) {
+      wifi_report("reconnected");
+    }
+
+    state = WIFI_CONNECTED;
+    attempts = 0;
+    backoff = WIFI_BACKOFF_MIN;
+    lost_at = 0;
+    return true;
+  }
+
+  if (disconnected_event) {
+    disconnected_event = false;
+    uint8_t reason = disconnected_reason;
+    if (state == WIFI_CONNECTED) {
+      stats.drops++;
+      lost_at = disconnected_at;
+      Serial.printf("[WIFI] Connection lost (reason %u)\n", reason);
+      // The first retry is immediate
+      next_attempt = now;
+      state = WIFI_WAITING;
+    } else if (state == WIFI_CONNECTING && reason != WIFI_REASON_ASSOC_LEAVE) {
+      // ASSOC_LEAVE is the previous attempt being dropped by WiFi.begin()
+      back_off(now);
+    }
+  }
+
+  if (state == WIFI_CONNECTING && now - attempt_start > WIFI_CONNECT_TIMEOUT) {
+    back_off(now);
+  }
+  if (state == WIFI_WAITING && (long)(now - next_attempt) >= 0) {
+    Serial.printf("[WIFI] Reconnect attempt %lu\n", attempts + 1);
+    start_attempt();
+  }
+  return false;
+}
+
+unsigned long wifi_manager_attempts() {
+  return attempts;
+}
+
+void wifi_report(const char * tag) {
+  // An outage still going on counts up to now
+  unsigned long offline = stats.offline_ms + (lost_at != 0 ? millis() - lost_at : 0);
+  Serial.printf("[WIFI] ---- %s ---- %s | drops %lu, failed attempts %lu | offline %lu ms total, last %lu ms, max %lu ms | connect %lu ms, max %lu ms\n",
+                tag, state == WIFI_CONNECTED ? "connected" : "offline", stats.drops, stats.failed_attempts,
+                offline, stats.last_offline_ms, stats.max_offline_ms, stats.last_attempt_ms, stats.max_attempt_ms);
+}